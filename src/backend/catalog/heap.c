@@ -79,6 +79,7 @@
 #include "utils/ruleutils.h"
 #include "utils/snapmgr.h"
 #include "utils/syscache.h"
+#include "utils/topocache.h"
 #include "utils/tqual.h"
 
 
@@ -1799,6 +1800,9 @@ heap_drop_with_catalog(Oid relid)
 	 */
 	CheckTableForSerializableConflictIn(rel);
 
+	/* its OID may be reused, so forget its topology */
+	TopologyCacheInvalidate(relid);
+
 	/*
 	 * Delete pg_foreign_table tuple first.
 	 */
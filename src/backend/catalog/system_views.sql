@@ -899,6 +899,15 @@ CREATE VIEW pg_stat_progress_vacuum AS
     FROM pg_stat_get_progress_info('VACUUM') AS S
 		LEFT JOIN pg_database D ON S.datid = D.oid;
 
+CREATE VIEW pg_stat_progress_detach_delete AS
+	SELECT
+		S.pid AS pid, S.datid AS datid, D.datname AS datname,
+		S.relid AS relid,
+		S.param1 AS vertices_total, S.param2 AS labels_total,
+		S.param3 AS labels_scanned, S.param4 AS edges_deleted
+    FROM pg_stat_get_progress_info('DETACH DELETE') AS S
+		LEFT JOIN pg_database D ON S.datid = D.oid;
+
 CREATE VIEW pg_user_mappings AS
     SELECT
         U.oid       AS umid,
@@ -1134,6 +1143,14 @@ LANGUAGE INTERNAL
 STRICT IMMUTABLE PARALLEL SAFE
 AS 'jsonb_insert';
 
+CREATE OR REPLACE FUNCTION
+  pagerank(vlabel text, elabel text, damping float8 DEFAULT 0.85,
+           iterations int4 DEFAULT 20, OUT id graphid, OUT rank float8)
+RETURNS SETOF record
+LANGUAGE INTERNAL
+STRICT STABLE PARALLEL RESTRICTED
+AS 'graph_pagerank';
+
 -- The default permissions for functions mean that anyone can execute them.
 -- A number of functions shouldn't be executable by just anyone, but rather
 -- than use explicit 'superuser()' checks in those functions, we use the GRANT
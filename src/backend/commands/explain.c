@@ -102,6 +102,14 @@ static void show_tablesample(TableSampleClause *tsc, PlanState *planstate,
 				 List *ancestors, ExplainState *es);
 static void show_sort_info(SortState *sortstate, ExplainState *es);
 static void show_hash_info(HashState *hashstate, ExplainState *es);
+static void show_dijkstra_info(DijkstraState *dstate, ExplainState *es);
+static void show_vle_info(NestLoopVLEState *vlestate, ExplainState *es);
+static void show_shortestpath_info(ShortestpathState *spstate,
+					   ExplainState *es);
+static void show_traversal_depths(const char *label, const char *grouplabel,
+					  TraversalDepthStats *stats, int nstats,
+					  ExplainState *es);
+static void show_cypher_access_info(PlanState *planstate, ExplainState *es);
 static void show_tidbitmap_info(BitmapHeapScanState *planstate,
 					ExplainState *es);
 static void show_instrumentation_count(const char *qlabel, int which,
@@ -1125,6 +1133,9 @@ ExplainNode(PlanState *planstate, List *ancestors,
 		case T_Dijkstra:
 			pname = sname = "Dijkstra";
 			break;
+		case T_Shortestpath:
+			pname = sname = "Shortestpath";
+			break;
 		default:
 			pname = sname = "???";
 			break;
@@ -1635,6 +1646,8 @@ ExplainNode(PlanState *planstate, List *ancestors,
 			if (plan->qual)
 				show_instrumentation_count("Rows Removed by Filter", 2,
 										   planstate, es);
+			if (es->analyze && es->verbose)
+				show_vle_info(castNode(NestLoopVLEState, planstate), es);
 			break;
 		case T_MergeJoin:
 			show_upper_qual(((MergeJoin *) plan)->mergeclauses,
@@ -1699,10 +1712,22 @@ ExplainNode(PlanState *planstate, List *ancestors,
 		case T_Hash:
 			show_hash_info(castNode(HashState, planstate), es);
 			break;
+		case T_Dijkstra:
+			if (es->analyze)
+				show_dijkstra_info(castNode(DijkstraState, planstate), es);
+			break;
+		case T_Shortestpath:
+			if (es->analyze && es->verbose)
+				show_shortestpath_info(castNode(ShortestpathState, planstate),
+									   es);
+			break;
 		default:
 			break;
 	}
 
+	if (es->analyze)
+		show_cypher_access_info(planstate, es);
+
 	/* Show buffer usage */
 	if (es->buffers && planstate->instrument)
 		show_buffer_usage(es, &planstate->instrument->bufusage);
@@ -2443,6 +2468,189 @@ show_hash_info(HashState *hashstate, ExplainState *es)
 	}
 }
 
+/*
+ * If it's EXPLAIN ANALYZE, show hits/misses of the adjacency cache for a
+ * Dijkstra node
+ */
+static void
+show_dijkstra_info(DijkstraState *dstate, ExplainState *es)
+{
+	long		spaceKb = (dstate->adj_space + 1023) / 1024;
+
+	if (es->format != EXPLAIN_FORMAT_TEXT)
+	{
+		ExplainPropertyLong("Adjacency Cache Hits", dstate->adj_hits, es);
+		ExplainPropertyLong("Adjacency Cache Misses", dstate->adj_misses, es);
+		ExplainPropertyLong("Adjacency Cache Memory Usage", spaceKb, es);
+	}
+	else
+	{
+		appendStringInfoSpaces(es->str, es->indent * 2);
+		appendStringInfo(es->str,
+						 "Adjacency Cache: Hits: %ld  Misses: %ld  Memory Usage: %ldkB\n",
+						 dstate->adj_hits, dstate->adj_misses, spaceKb);
+	}
+
+	if (OidIsValid(((Dijkstra *) dstate->ps.plan)->topology))
+		ExplainPropertyLong("Topology Cache Edges", dstate->topology_edges, es);
+
+	if (!es->verbose)
+		return;
+
+	if (es->format != EXPLAIN_FORMAT_TEXT)
+	{
+		ExplainPropertyLong("Priority Queue Pushes", dstate->pq_pushes, es);
+		ExplainPropertyLong("Priority Queue Pops", dstate->pq_pops, es);
+		ExplainPropertyLong("Stale Entries", dstate->pq_stale, es);
+		ExplainPropertyLong("Edges Relaxed", dstate->edges_relaxed, es);
+		ExplainPropertyLong("Peak Visited Vertices", dstate->max_visited, es);
+		ExplainPropertyLong("Resumed Searches", dstate->searches_resumed, es);
+	}
+	else
+	{
+		appendStringInfoSpaces(es->str, es->indent * 2);
+		appendStringInfo(es->str,
+						 "Priority Queue: Pushes: %ld  Pops: %ld  Stale: %ld\n",
+						 dstate->pq_pushes, dstate->pq_pops, dstate->pq_stale);
+		appendStringInfoSpaces(es->str, es->indent * 2);
+		appendStringInfo(es->str,
+						 "Edges Relaxed: %ld  Peak Visited Vertices: %ld  Resumed Searches: %ld\n",
+						 dstate->edges_relaxed, dstate->max_visited,
+						 dstate->searches_resumed);
+	}
+
+	if (((Dijkstra *) dstate->ps.plan)->loopless)
+		ExplainPropertyLong("Spur Searches", dstate->spur_searches, es);
+}
+
+/*
+ * If it's EXPLAIN ANALYZE VERBOSE, show what a NestLoopVLE node did at each
+ * depth and which path arrays it built
+ */
+static void
+show_vle_info(NestLoopVLEState *vlestate, ExplainState *es)
+{
+	NestLoopVLE *nlv = (NestLoopVLE *) vlestate->nls.js.ps.plan;
+	List	   *arrays = NIL;
+
+	show_traversal_depths("Depth", "Depths", vlestate->depthStats,
+						  vlestate->ndepthStats, es);
+
+	if (!nlv->skipIds)
+		arrays = lappend(arrays, "ids");
+	if (vlestate->hasPath && !nlv->skipEdges)
+		arrays = lappend(arrays, "edges");
+	if (arrays == NIL && es->format == EXPLAIN_FORMAT_TEXT)
+		arrays = list_make1("none");
+	ExplainPropertyList("Path Arrays", arrays, es);
+
+	if (es->format != EXPLAIN_FORMAT_TEXT)
+	{
+		ExplainPropertyInteger("Max Path Array Size", vlestate->maxPathLen,
+							   es);
+	}
+	else
+	{
+		appendStringInfoSpaces(es->str, es->indent * 2);
+		appendStringInfo(es->str, "Max Path Array Size: %d\n",
+						 vlestate->maxPathLen);
+	}
+}
+
+/*
+ * If it's EXPLAIN ANALYZE VERBOSE, show what each search of a Shortestpath
+ * node did at each depth
+ */
+static void
+show_shortestpath_info(ShortestpathState *spstate, ExplainState *es)
+{
+	show_traversal_depths("Forward Depth", "Forward Depths",
+						  spstate->fwd_stats, spstate->fwd_nstats, es);
+	show_traversal_depths("Backward Depth", "Backward Depths",
+						  spstate->bwd_stats, spstate->bwd_nstats, es);
+}
+
+static void
+show_traversal_depths(const char *label, const char *grouplabel,
+					  TraversalDepthStats *stats, int nstats, ExplainState *es)
+{
+	bool		opened_group = false;
+	int			depth;
+
+	for (depth = 0; depth < nstats; depth++)
+	{
+		TraversalDepthStats *s = &stats[depth];
+
+		if (s->rescans == 0 && s->edges == 0)
+			continue;
+
+		if (es->format != EXPLAIN_FORMAT_TEXT)
+		{
+			if (!opened_group)
+			{
+				ExplainOpenGroup(grouplabel, grouplabel, false, es);
+				opened_group = true;
+			}
+			ExplainOpenGroup(label, NULL, true, es);
+			ExplainPropertyInteger("Depth", depth, es);
+			ExplainPropertyLong("Frontier", s->frontier, es);
+			ExplainPropertyLong("Rescans", s->rescans, es);
+			ExplainPropertyLong("Edges", s->edges, es);
+			ExplainPropertyLong("Rejected Edges", s->rejected, es);
+			ExplainCloseGroup(label, NULL, true, es);
+		}
+		else
+		{
+			appendStringInfoSpaces(es->str, es->indent * 2);
+			appendStringInfo(es->str,
+							 "%s %d: Frontier: %ld  Rescans: %ld  Edges: %ld  Rejected: %ld\n",
+							 label, depth, s->frontier, s->rescans, s->edges,
+							 s->rejected);
+		}
+	}
+
+	if (opened_group)
+		ExplainCloseGroup(grouplabel, grouplabel, false, es);
+}
+
+/*
+ * If it's EXPLAIN ANALYZE, show the number of detoasts of property maps
+ * avoided by sharing them among the property accesses of a node
+ */
+static void
+show_cypher_access_info(PlanState *planstate, ExplainState *es)
+{
+	bool		hascaches = false;
+	long		nsaved = 0;
+
+	if (planstate->qual != NULL &&
+		planstate->qual->cypheraccess_caches != NIL)
+	{
+		hascaches = true;
+		nsaved += planstate->qual->cypheraccess_nsaved;
+	}
+	if (planstate->ps_ProjInfo != NULL &&
+		planstate->ps_ProjInfo->pi_state.cypheraccess_caches != NIL)
+	{
+		hascaches = true;
+		nsaved += planstate->ps_ProjInfo->pi_state.cypheraccess_nsaved;
+	}
+
+	if (!hascaches)
+		return;
+
+	if (es->format != EXPLAIN_FORMAT_TEXT)
+	{
+		ExplainPropertyLong("Property Map Detoasts Avoided", nsaved, es);
+	}
+	else if (nsaved > 0)
+	{
+		appendStringInfoSpaces(es->str, es->indent * 2);
+		appendStringInfo(es->str, "Property Map Detoasts Avoided: %ld\n",
+						 nsaved);
+	}
+}
+
 /*
  * If it's EXPLAIN ANALYZE, show exact/lossy pages for a BitmapHeapScan node
  */
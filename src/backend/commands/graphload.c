@@ -0,0 +1,495 @@
+/*
+ * graphload.c
+ *	  Bulk loading of vertices and edges into graph labels
+ *
+ * load_vertices() and load_edges() read the rows of a source relation (a
+ * table filled by COPY, a foreign table over a file, and so on) and write
+ * the elements with heap_multi_insert() in batches, without evaluating the
+ * defaults and the Cypher expressions of CREATE for each row.
+ *
+ * The keys of the start and end vertices of edges are mapped to graphids by
+ * joining the source with the vertex label, so the mapping spills to disk by
+ * the hash join of the executor if it doesn't fit in work_mem.
+ *
+ * If the target label is empty, its indexes are built after the load instead
+ * of being updated for each element.  Like COPY FROM, WAL is skipped if the
+ * label has been created or truncated in the current transaction and
+ * wal_level is minimal.
+ *
+ * Copyright (c) 2017 by Bitnine Global, Inc.
+ *
+ * IDENTIFICATION
+ *	  src/backend/commands/graphload.c
+ */
+
+#include "postgres.h"
+
+#include "ag_const.h"
+#include "access/heapam.h"
+#include "access/htup_details.h"
+#include "access/xact.h"
+#include "access/xlog.h"
+#include "catalog/ag_graph_fn.h"
+#include "catalog/ag_label.h"
+#include "catalog/dependency.h"
+#include "catalog/index.h"
+#include "commands/sequence.h"
+#include "executor/executor.h"
+#include "executor/nodeModifyGraph.h"
+#include "executor/spi.h"
+#include "miscadmin.h"
+#include "storage/bufmgr.h"
+#include "storage/lmgr.h"
+#include "tcop/utility.h"
+#include "utils/acl.h"
+#include "utils/builtins.h"
+#include "utils/graph.h"
+#include "utils/lsyscache.h"
+#include "utils/memutils.h"
+#include "utils/rel.h"
+#include "utils/syscache.h"
+
+/* see flushBufferedTuples() in nodeModifyGraph.c */
+#define MAX_BUFFERED_TUPLES		1000
+#define MAX_BUFFERED_BYTES		65535
+
+/* rows fetched from the source at a time */
+#define LOAD_FETCH_SIZE			1000
+
+typedef struct GraphLoadState
+{
+	Relation	rel;
+	bool		isedge;
+	uint16		labid;
+	Oid			seqid;			/* sequence of local IDs */
+	bool		build_indexes;	/* build indexes after the load */
+	int			hi_options;
+	CommandId	mycid;
+	EState	   *estate;
+	ResultRelInfo *resultRelInfo;
+	TupleTableSlot *slot;
+	BulkInsertState bistate;
+	MemoryContext bufferedCxt;
+	HeapTuple  *bufferedTuples;
+	int			nBufferedTuples;
+	Size		bufferedTuplesSize;
+	int64		nloaded;
+} GraphLoadState;
+
+static Oid	get_load_relid(text *labname, char labkind);
+static char *get_qualified_relname(Oid relid);
+static void begin_load(GraphLoadState *lstate, Oid relid, bool isedge);
+static void load_from_query(GraphLoadState *lstate, char *query);
+static void add_element(GraphLoadState *lstate, Datum start, Datum end,
+			Datum prop);
+static void flush_elements(GraphLoadState *lstate);
+static void end_load(GraphLoadState *lstate);
+
+/*
+ * load_vertices(vlabel, source) - load a vertex for each row of source
+ *
+ * The columns of a row become the properties of its vertex.  NULL values are
+ * not stored.
+ */
+Datum
+graph_load_vertices(PG_FUNCTION_ARGS)
+{
+	Oid			relid = get_load_relid(PG_GETARG_TEXT_PP(0), LABEL_KIND_VERTEX);
+	Oid			srcid = PG_GETARG_OID(1);
+	GraphLoadState lstate;
+	char	   *query;
+
+	query = psprintf("SELECT NULL::graphid, NULL::graphid, "
+					 "jsonb_strip_nulls(to_jsonb(r)) FROM %s r",
+					 get_qualified_relname(srcid));
+
+	begin_load(&lstate, relid, false);
+	load_from_query(&lstate, query);
+	end_load(&lstate);
+
+	PG_RETURN_INT64(lstate.nloaded);
+}
+
+/*
+ * load_edges(elabel, source, vlabel, key) - load an edge for each row of
+ * source
+ *
+ * The first two columns of source are the keys of the start and end vertices
+ * of the edge.  A key matches the vertex of vlabel (including its child
+ * labels) whose property `key` is equal to it.  The other columns become the
+ * properties of the edge.  Rows whose vertices are not found are skipped and
+ * a row matching several vertices makes an edge for each of them.
+ */
+Datum
+graph_load_edges(PG_FUNCTION_ARGS)
+{
+	Oid			relid = get_load_relid(PG_GETARG_TEXT_PP(0), LABEL_KIND_EDGE);
+	Oid			srcid = PG_GETARG_OID(1);
+	Oid			vrelid = get_load_relid(PG_GETARG_TEXT_PP(2), LABEL_KIND_VERTEX);
+	char	   *key = text_to_cstring(PG_GETARG_TEXT_PP(3));
+	char	   *keycols[2];
+	int			nkeycols = 0;
+	int16		attnum;
+	char	   *srcname;
+	char	   *vlabname;
+	char	   *qkey;
+	GraphLoadState lstate;
+	char	   *query;
+
+	srcname = get_qualified_relname(srcid);
+	for (attnum = 1; nkeycols < 2; attnum++)
+	{
+		HeapTuple	tuple;
+		Form_pg_attribute attr;
+
+		tuple = SearchSysCache2(ATTNUM, ObjectIdGetDatum(srcid),
+								Int16GetDatum(attnum));
+		if (!HeapTupleIsValid(tuple))
+			ereport(ERROR,
+					(errcode(ERRCODE_INVALID_PARAMETER_VALUE),
+					 errmsg("source relation \"%s\" must have the keys of start and end vertices as its first two columns",
+							srcname)));
+
+		attr = (Form_pg_attribute) GETSTRUCT(tuple);
+		if (!attr->attisdropped)
+			keycols[nkeycols++] = pstrdup(NameStr(attr->attname));
+		ReleaseSysCache(tuple);
+	}
+
+	vlabname = get_qualified_relname(vrelid);
+	qkey = quote_literal_cstr(key);
+
+	query = psprintf("SELECT s.id, e.id, "
+					 "jsonb_strip_nulls(to_jsonb(r) - %s - %s) "
+					 "FROM %s r "
+					 "JOIN %s s ON s.properties -> %s = to_jsonb(r.%s) "
+					 "JOIN %s e ON e.properties -> %s = to_jsonb(r.%s)",
+					 quote_literal_cstr(keycols[0]),
+					 quote_literal_cstr(keycols[1]),
+					 srcname,
+					 vlabname, qkey, quote_identifier(keycols[0]),
+					 vlabname, qkey, quote_identifier(keycols[1]));
+
+	begin_load(&lstate, relid, true);
+	load_from_query(&lstate, query);
+	end_load(&lstate);
+
+	PG_RETURN_INT64(lstate.nloaded);
+}
+
+/*
+ * Find the table of a label in the current graph.  The table of the label to
+ * load is locked in begin_load().
+ */
+static Oid
+get_load_relid(text *labname, char labkind)
+{
+	char	   *name = text_to_cstring(labname);
+	HeapTuple	tuple;
+	Form_ag_label labtup;
+	Oid			relid;
+
+	tuple = SearchSysCache2(LABELNAMEGRAPH, CStringGetDatum(name),
+							ObjectIdGetDatum(get_graph_path_oid()));
+	if (!HeapTupleIsValid(tuple))
+		ereport(ERROR,
+				(errcode(ERRCODE_UNDEFINED_OBJECT),
+				 errmsg("label \"%s\" does not exist", name)));
+
+	labtup = (Form_ag_label) GETSTRUCT(tuple);
+	if (labtup->labkind != labkind)
+		ereport(ERROR,
+				(errcode(ERRCODE_WRONG_OBJECT_TYPE),
+				 errmsg("\"%s\" is not %s label", name,
+						(labkind == LABEL_KIND_VERTEX ? "a vertex" : "an edge"))));
+	relid = labtup->relid;
+	ReleaseSysCache(tuple);
+
+	return relid;
+}
+
+static char *
+get_qualified_relname(Oid relid)
+{
+	char	   *relname = get_rel_name(relid);
+
+	if (relname == NULL)
+		ereport(ERROR,
+				(errcode(ERRCODE_UNDEFINED_TABLE),
+				 errmsg("relation with OID %u does not exist", relid)));
+
+	return quote_qualified_identifier(get_namespace_name(get_rel_namespace(relid)),
+									  relname);
+}
+
+static void
+begin_load(GraphLoadState *lstate, Oid relid, bool isedge)
+{
+	Relation	rel;
+	AclResult	aclresult;
+	RangeTblEntry *rte;
+	ResultRelInfo *resultRelInfo;
+	EState	   *estate;
+
+	PreventCommandIfReadOnly(isedge ? "load_edges()" : "load_vertices()");
+	PreventCommandIfParallelMode(isedge ? "load_edges()" : "load_vertices()");
+
+	/* this blocks other writers, so that indexes can be built at the end */
+	rel = heap_open(relid, ShareRowExclusiveLock);
+
+	aclresult = pg_class_aclcheck(relid, GetUserId(), ACL_INSERT);
+	if (aclresult != ACLCHECK_OK)
+		aclcheck_error(aclresult, ACL_KIND_CLASS, RelationGetRelationName(rel));
+
+	if (rel->trigdesc != NULL)
+		ereport(ERROR,
+				(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+				 errmsg("cannot bulk load into label \"%s\" because it has triggers",
+						RelationGetRelationName(rel))));
+
+	lstate->rel = rel;
+	lstate->isedge = isedge;
+	lstate->labid = (uint16) get_relid_labid(relid);
+
+	lstate->seqid = getOwnedSequence(relid, get_attnum(relid,
+													   AG_ELEM_LOCAL_ID));
+	aclresult = pg_class_aclcheck(lstate->seqid, GetUserId(),
+								  ACL_USAGE | ACL_UPDATE);
+	if (aclresult != ACLCHECK_OK)
+		ereport(ERROR,
+				(errcode(ERRCODE_INSUFFICIENT_PRIVILEGE),
+				 errmsg("permission denied for sequence %s",
+						get_rel_name(lstate->seqid))));
+
+	lstate->build_indexes = (RelationGetNumberOfBlocks(rel) == 0);
+
+	/* see CopyFrom() */
+	lstate->hi_options = 0;
+	if (rel->rd_createSubid != InvalidSubTransactionId ||
+		rel->rd_newRelfilenodeSubid != InvalidSubTransactionId)
+	{
+		lstate->hi_options |= HEAP_INSERT_SKIP_FSM;
+		if (!XLogIsNeeded())
+			lstate->hi_options |= HEAP_INSERT_SKIP_WAL;
+	}
+
+	lstate->mycid = GetCurrentCommandId(true);
+
+	estate = CreateExecutorState();
+
+	rte = makeNode(RangeTblEntry);
+	rte->rtekind = RTE_RELATION;
+	rte->relid = relid;
+	rte->relkind = rel->rd_rel->relkind;
+	rte->requiredPerms = ACL_INSERT;
+
+	resultRelInfo = makeNode(ResultRelInfo);
+	InitResultRelInfo(resultRelInfo, rel, 1, NULL, 0);
+	if (!lstate->build_indexes)
+		ExecOpenIndices(resultRelInfo, false);
+
+	estate->es_result_relations = resultRelInfo;
+	estate->es_num_result_relations = 1;
+	estate->es_result_relation_info = resultRelInfo;
+	estate->es_range_table = list_make1(rte);
+
+	lstate->estate = estate;
+	lstate->resultRelInfo = resultRelInfo;
+	lstate->slot = ExecInitExtraTupleSlot(estate);
+	ExecSetSlotDescriptor(lstate->slot, RelationGetDescr(rel));
+
+	lstate->bistate = GetBulkInsertState();
+
+	lstate->bufferedCxt = AllocSetContextCreate(CurrentMemoryContext,
+												"graph load buffer",
+												ALLOCSET_DEFAULT_SIZES);
+	lstate->bufferedTuples = palloc(sizeof(HeapTuple) * MAX_BUFFERED_TUPLES);
+	lstate->nBufferedTuples = 0;
+	lstate->bufferedTuplesSize = 0;
+	lstate->nloaded = 0;
+}
+
+/*
+ * Load an element for each row of the query.  The query returns the start
+ * and end graphids (NULL for vertices) and the property map.
+ */
+static void
+load_from_query(GraphLoadState *lstate, char *query)
+{
+	SPIPlanPtr	plan;
+	Portal		portal;
+
+	if (SPI_connect() != SPI_OK_CONNECT)
+		elog(ERROR, "SPI_connect failed");
+
+	plan = SPI_prepare(query, 0, NULL);
+	if (plan == NULL)
+		elog(ERROR, "SPI_prepare failed: %s", query);
+
+	/*
+	 * The elements are inserted with the current command ID, which the
+	 * snapshot of the query cannot see.
+	 */
+	portal = SPI_cursor_open(NULL, plan, NULL, NULL, true);
+
+	for (;;)
+	{
+		uint64		i;
+
+		SPI_cursor_fetch(portal, true, LOAD_FETCH_SIZE);
+		if (SPI_processed == 0)
+			break;
+
+		for (i = 0; i < SPI_processed; i++)
+		{
+			HeapTuple	tuple = SPI_tuptable->vals[i];
+			TupleDesc	tupdesc = SPI_tuptable->tupdesc;
+			Datum		start;
+			Datum		end;
+			Datum		prop;
+			bool		isnull;
+
+			CHECK_FOR_INTERRUPTS();
+
+			start = SPI_getbinval(tuple, tupdesc, 1, &isnull);
+			end = SPI_getbinval(tuple, tupdesc, 2, &isnull);
+			prop = SPI_getbinval(tuple, tupdesc, 3, &isnull);
+
+			add_element(lstate, start, end, prop);
+		}
+
+		SPI_freetuptable(SPI_tuptable);
+	}
+
+	SPI_cursor_close(portal);
+
+	if (lstate->nBufferedTuples > 0)
+		flush_elements(lstate);
+
+	if (SPI_finish() != SPI_OK_FINISH)
+		elog(ERROR, "SPI_finish failed");
+}
+
+static void
+add_element(GraphLoadState *lstate, Datum start, Datum end, Datum prop)
+{
+	TupleTableSlot *slot = lstate->slot;
+	int			natts = slot->tts_tupleDescriptor->natts;
+	int			propattnum;
+	Graphid		id;
+	HeapTuple	tuple;
+	MemoryContext oldmctx;
+
+	oldmctx = MemoryContextSwitchTo(lstate->bufferedCxt);
+
+	GraphidSet(&id, lstate->labid,
+			   (uint64) nextval_internal(lstate->seqid, false));
+
+	ExecClearTuple(slot);
+	MemSet(slot->tts_isnull, true, natts * sizeof(bool));
+
+	slot->tts_values[0] = GraphidGetDatum(id);
+	slot->tts_isnull[0] = false;
+	if (lstate->isedge)
+	{
+		slot->tts_values[1] = start;
+		slot->tts_isnull[1] = false;
+		slot->tts_values[2] = end;
+		slot->tts_isnull[2] = false;
+		propattnum = 4;
+	}
+	else
+	{
+		propattnum = 2;
+	}
+	slot->tts_values[propattnum - 1] = prop;
+	slot->tts_isnull[propattnum - 1] = false;
+
+	setSlotPropColumns(slot, propattnum);
+	ExecStoreVirtualTuple(slot);
+
+	if (lstate->rel->rd_att->constr != NULL)
+		ExecConstraints(lstate->resultRelInfo, slot, lstate->estate);
+
+	tuple = ExecCopySlotTuple(slot);
+	ExecClearTuple(slot);
+
+	MemoryContextSwitchTo(oldmctx);
+
+	lstate->bufferedTuples[lstate->nBufferedTuples++] = tuple;
+	lstate->bufferedTuplesSize += tuple->t_len;
+
+	if (lstate->nBufferedTuples == MAX_BUFFERED_TUPLES ||
+		lstate->bufferedTuplesSize > MAX_BUFFERED_BYTES)
+		flush_elements(lstate);
+}
+
+static void
+flush_elements(GraphLoadState *lstate)
+{
+	EState	   *estate = lstate->estate;
+	ResultRelInfo *resultRelInfo = lstate->resultRelInfo;
+	MemoryContext oldmctx;
+
+	/*
+	 * heap_multi_insert leaks memory, so switch to short-lived memory context
+	 * before calling it.
+	 */
+	oldmctx = MemoryContextSwitchTo(GetPerTupleMemoryContext(estate));
+	heap_multi_insert(lstate->rel, lstate->bufferedTuples,
+					  lstate->nBufferedTuples, lstate->mycid,
+					  lstate->hi_options, lstate->bistate);
+	MemoryContextSwitchTo(oldmctx);
+
+	if (resultRelInfo->ri_NumIndices > 0)
+	{
+		int			i;
+
+		for (i = 0; i < lstate->nBufferedTuples; i++)
+		{
+			HeapTuple	tuple = lstate->bufferedTuples[i];
+
+			ExecStoreTuple(tuple, lstate->slot, InvalidBuffer, false);
+			ExecInsertIndexTuples(lstate->slot, &(tuple->t_self), estate,
+								  false, NULL, NIL);
+		}
+
+		ExecClearTuple(lstate->slot);
+	}
+
+	lstate->nloaded += lstate->nBufferedTuples;
+
+	ResetPerTupleExprContext(estate);
+	MemoryContextReset(lstate->bufferedCxt);
+	lstate->nBufferedTuples = 0;
+	lstate->bufferedTuplesSize = 0;
+}
+
+static void
+end_load(GraphLoadState *lstate)
+{
+	Relation	rel = lstate->rel;
+
+	FreeBulkInsertState(lstate->bistate);
+
+	ExecResetTupleTable(lstate->estate->es_tupleTable, false);
+	ExecCloseIndices(lstate->resultRelInfo);
+	FreeExecutorState(lstate->estate);
+
+	/* see CopyFrom() */
+	if (lstate->hi_options & HEAP_INSERT_SKIP_WAL)
+		heap_sync(rel);
+
+	if (lstate->build_indexes && lstate->nloaded > 0)
+	{
+		CommandCounterIncrement();
+		reindex_relation(RelationGetRelid(rel),
+						 REINDEX_REL_PROCESS_TOAST |
+						 REINDEX_REL_CHECK_CONSTRAINTS, 0);
+	}
+
+	MemoryContextDelete(lstate->bufferedCxt);
+	pfree(lstate->bufferedTuples);
+
+	heap_close(rel, NoLock);
+}
@@ -49,6 +49,7 @@
 #include "executor/nodeSamplescan.h"
 #include "executor/nodeSeqscan.h"
 #include "executor/nodeSetOp.h"
+#include "executor/nodeShortestpath.h"
 #include "executor/nodeSort.h"
 #include "executor/nodeSubplan.h"
 #include "executor/nodeSubqueryscan.h"
@@ -295,6 +296,10 @@ ExecReScan(PlanState *node)
 			ExecReScanDijkstra((DijkstraState *) node);
 			break;
 
+		case T_ShortestpathState:
+			ExecReScanShortestpath((ShortestpathState *) node);
+			break;
+
 		default:
 			elog(ERROR, "unrecognized node type: %d", (int) nodeTag(node));
 			break;
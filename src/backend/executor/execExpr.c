@@ -83,6 +83,8 @@ static bool isIdentity(CypherListCompExpr *listcompexpr);
 static void initExprSaveIter(Expr *node, ExprEvalStep *next_step,
 							 PlanState *parent, ExprState *state,
 							 Datum *resv, bool *resnull);
+static void ExecInitCypherAccessCaches(ExprState *state, Node *node);
+static bool cypher_access_args_walker(Node *node, List **caches);
 static void ExecInitCypherAccess(ExprEvalStep *scratch,
 								 CypherAccessExpr *accessexpr,
 								 PlanState *parent, ExprState *state);
@@ -142,6 +144,9 @@ ExecInitExpr(Expr *node, PlanState *parent)
 	/* Insert EEOP_*_FETCHSOME steps as needed */
 	ExecInitExprSlots(state, (Node *) node);
 
+	/* Share property maps among property accesses */
+	ExecInitCypherAccessCaches(state, (Node *) node);
+
 	/* Compile the expression proper */
 	ExecInitExprRec(node, parent, state, &state->resvalue, &state->resnull);
 
@@ -194,6 +199,9 @@ ExecInitQual(List *qual, PlanState *parent)
 	/* Insert EEOP_*_FETCHSOME steps as needed */
 	ExecInitExprSlots(state, (Node *) qual);
 
+	/* Share property maps among property accesses */
+	ExecInitCypherAccessCaches(state, (Node *) qual);
+
 	/*
 	 * ExecQual() needs to return false for an expression returning NULL. That
 	 * allows us to short-circuit the evaluation the first time a NULL is
@@ -335,6 +343,9 @@ ExecBuildProjectionInfo(List *targetList,
 	/* Insert EEOP_*_FETCHSOME steps as needed */
 	ExecInitExprSlots(state, (Node *) targetList);
 
+	/* Share property maps among property accesses */
+	ExecInitCypherAccessCaches(state, (Node *) targetList);
+
 	/* Now compile each tlist column */
 	foreach(lc, targetList)
 	{
@@ -2985,6 +2996,101 @@ initExprSaveIter(Expr *node, ExprEvalStep *next_step,
 	state->innermost_cypherlistcomp_iternull = save_iternull;
 }
 
+/*
+ * Find property maps accessed more than once in `node` and push a step that
+ * invalidates their detoasted values at the beginning of each evaluation.
+ * See ExecEvalCypherAccessExpr().
+ */
+static void
+ExecInitCypherAccessCaches(ExprState *state, Node *node)
+{
+	List	   *caches = NIL;
+	int			ncaches = 0;
+	CypherAccessCache *cachearr;
+	ListCell   *lc;
+	ExprEvalStep scratch;
+
+	cypher_access_args_walker(node, &caches);
+
+	foreach(lc, caches)
+	{
+		CypherAccessCache *cache = lfirst(lc);
+
+		if (cache->nuses > 1)
+			ncaches++;
+	}
+	if (ncaches == 0)
+		return;
+
+	cachearr = palloc0(sizeof(CypherAccessCache) * ncaches);
+	ncaches = 0;
+	foreach(lc, caches)
+	{
+		CypherAccessCache *cache = lfirst(lc);
+
+		if (cache->nuses > 1)
+		{
+			cachearr[ncaches] = *cache;
+			state->cypheraccess_caches = lappend(state->cypheraccess_caches,
+												 &cachearr[ncaches]);
+			ncaches++;
+		}
+	}
+
+	scratch.opcode = EEOP_CYPHERACCESS_RESET;
+	scratch.d.cypheraccess_reset.caches = cachearr;
+	scratch.d.cypheraccess_reset.ncaches = ncaches;
+	ExprEvalPushStep(state, &scratch);
+}
+
+/*
+ * Count the uses of each Var accessed by CypherAccessExprs.  Aggregates,
+ * window functions and subplans are evaluated by other ExprStates.
+ */
+static bool
+cypher_access_args_walker(Node *node, List **caches)
+{
+	if (node == NULL)
+		return false;
+
+	if (IsA(node, Aggref) || IsA(node, WindowFunc) || IsA(node, SubPlan) ||
+		IsA(node, AlternativeSubPlan))
+		return false;
+
+	if (IsA(node, CypherAccessExpr))
+	{
+		CypherAccessExpr *accessexpr = (CypherAccessExpr *) node;
+
+		if (IsA(accessexpr->arg, Var))
+		{
+			CypherAccessCache *cache = NULL;
+			ListCell   *lc;
+
+			foreach(lc, *caches)
+			{
+				CypherAccessCache *c = lfirst(lc);
+
+				if (equal(c->arg, accessexpr->arg))
+				{
+					cache = c;
+					break;
+				}
+			}
+
+			if (cache == NULL)
+			{
+				cache = palloc0(sizeof(*cache));
+				cache->arg = accessexpr->arg;
+				*caches = lappend(*caches, cache);
+			}
+			cache->nuses++;
+		}
+	}
+
+	return expression_tree_walker(node, cypher_access_args_walker,
+								  (void *) caches);
+}
+
 static void
 ExecInitCypherAccess(ExprEvalStep *scratch, CypherAccessExpr *accessexpr,
 					 PlanState *parent, ExprState *state)
@@ -2993,11 +3099,23 @@ ExecInitCypherAccess(ExprEvalStep *scratch, CypherAccessExpr *accessexpr,
 	bool	   *argnull;
 	int			pathlen;
 	CypherAccessPathElem *path;
+	CypherAccessCache *cache = NULL;
 	int			i;
 	ListCell   *le;
 
 	Assert(exprType((Node *) accessexpr->arg) == JSONBOID);
 
+	foreach(le, state->cypheraccess_caches)
+	{
+		CypherAccessCache *c = lfirst(le);
+
+		if (equal(c->arg, accessexpr->arg))
+		{
+			cache = c;
+			break;
+		}
+	}
+
 	argvalue = (Datum *) palloc(sizeof(Datum));
 	argnull = (bool *) palloc(sizeof(bool));
 	ExecInitExprRec(accessexpr->arg, parent, state, argvalue, argnull);
@@ -3034,6 +3152,7 @@ ExecInitCypherAccess(ExprEvalStep *scratch, CypherAccessExpr *accessexpr,
 	scratch->d.cypheraccessexpr.argnull = argnull;
 	scratch->d.cypheraccessexpr.path = path;
 	scratch->d.cypheraccessexpr.pathlen = pathlen;
+	scratch->d.cypheraccessexpr.cache = cache;
 	ExprEvalPushStep(state, scratch);
 }
 
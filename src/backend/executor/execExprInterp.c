@@ -384,6 +384,7 @@ ExecInterpExpr(ExprState *state, ExprContext *econtext, bool *isnull)
 		&&CASE_EEOP_CYPHERLISTCOMP_ITER_INIT,
 		&&CASE_EEOP_CYPHERLISTCOMP_ITER_NEXT,
 		&&CASE_EEOP_CYPHERLISTCOMP_VAR,
+		&&CASE_EEOP_CYPHERACCESS_RESET,
 		&&CASE_EEOP_CYPHERACCESSEXPR,
 		&&CASE_EEOP_LAST
 	};
@@ -1649,6 +1650,16 @@ ExecInterpExpr(ExprState *state, ExprContext *econtext, bool *isnull)
 			EEO_NEXT();
 		}
 
+		EEO_CASE(EEOP_CYPHERACCESS_RESET)
+		{
+			int			i;
+
+			for (i = 0; i < op->d.cypheraccess_reset.ncaches; i++)
+				op->d.cypheraccess_reset.caches[i].valid = false;
+
+			EEO_NEXT();
+		}
+
 		EEO_CASE(EEOP_CYPHERACCESSEXPR)
 		{
 			ExecEvalCypherAccessExpr(state, op);
@@ -3896,6 +3907,7 @@ ExecEvalCypherListExpr(ExprState *state, ExprEvalStep *op)
 void
 ExecEvalCypherAccessExpr(ExprState *state, ExprEvalStep *op)
 {
+	CypherAccessCache *cache = op->d.cypheraccessexpr.cache;
 	Jsonb	   *argjb;
 	JsonbValue	_vjv;
 	JsonbValue *vjv;
@@ -3914,7 +3926,28 @@ ExecEvalCypherAccessExpr(ExprState *state, ExprEvalStep *op)
 		return;
 	}
 
-	argjb = DatumGetJsonb(*op->d.cypheraccessexpr.argvalue);
+	if (cache != NULL)
+	{
+		/* detoast the shared property map at the first access only */
+		if (!cache->valid)
+		{
+			Datum		argvalue = *op->d.cypheraccessexpr.argvalue;
+
+			cache->extended = VARATT_IS_EXTENDED(DatumGetPointer(argvalue));
+			cache->value = PointerGetDatum(PG_DETOAST_DATUM(argvalue));
+			cache->valid = true;
+		}
+		else if (cache->extended)
+		{
+			state->cypheraccess_nsaved++;
+		}
+
+		argjb = DatumGetJsonb(cache->value);
+	}
+	else
+	{
+		argjb = DatumGetJsonb(*op->d.cypheraccessexpr.argvalue);
+	}
 	if (JB_ROOT_IS_SCALAR(argjb))
 	{
 		vjv = getIthJsonbValueFromContainer(&argjb->root, 0);
@@ -63,6 +63,7 @@
 #include "utils/rls.h"
 #include "utils/ruleutils.h"
 #include "utils/snapmgr.h"
+#include "utils/topocache.h"
 #include "utils/tqual.h"
 
 
@@ -1367,6 +1368,12 @@ InitResultRelInfo(ResultRelInfo *resultRelInfo,
 
 	resultRelInfo->ri_PartitionCheck = partition_check;
 	resultRelInfo->ri_PartitionRoot = partition_root;
+
+	/*
+	 * The relation is locked and is about to be written.  Discard its
+	 * topology from the graph topology cache if it is an edge label.
+	 */
+	TopologyCacheInvalidate(RelationGetRelid(resultRelationDesc));
 }
 
 /*
@@ -108,6 +108,7 @@
 #include "executor/nodeSamplescan.h"
 #include "executor/nodeSeqscan.h"
 #include "executor/nodeSetOp.h"
+#include "executor/nodeShortestpath.h"
 #include "executor/nodeSort.h"
 #include "executor/nodeSubplan.h"
 #include "executor/nodeSubqueryscan.h"
@@ -383,6 +384,11 @@ ExecInitNode(Plan *node, EState *estate, int eflags)
 													estate, eflags);
 			break;
 
+		case T_Shortestpath:
+			result = (PlanState *) ExecInitShortestpath((Shortestpath *) node,
+														estate, eflags);
+			break;
+
 		default:
 			elog(ERROR, "unrecognized node type: %d", (int) nodeTag(node));
 			result = NULL;		/* keep compiler quiet */
@@ -742,6 +748,10 @@ ExecEndNode(PlanState *node)
 			ExecEndDijkstra((DijkstraState *) node);
 			break;
 
+		case T_ShortestpathState:
+			ExecEndShortestpath((ShortestpathState *) node);
+			break;
+
 		default:
 			elog(ERROR, "unrecognized node type: %d", (int) nodeTag(node));
 			break;
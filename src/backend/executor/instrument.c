@@ -165,6 +165,35 @@ InstrAggNode(Instrumentation *dst, Instrumentation *add)
 		BufferUsageAdd(&dst->bufusage, &add->bufusage);
 }
 
+/*
+ * Return the statistics of `depth` in the array `*stats` of `*nstats`
+ * elements, enlarging the array in `mcxt` if it is too small.
+ */
+TraversalDepthStats *
+InstrDepthStats(TraversalDepthStats **stats, int *nstats, int depth,
+				MemoryContext mcxt)
+{
+	if (depth >= *nstats)
+	{
+		int			newsize = Max(depth + 1, Max(*nstats * 2, 8));
+
+		if (*stats == NULL)
+		{
+			*stats = MemoryContextAllocZero(mcxt,
+											newsize * sizeof(**stats));
+		}
+		else
+		{
+			*stats = repalloc(*stats, newsize * sizeof(**stats));
+			MemSet(*stats + *nstats, 0,
+				   (newsize - *nstats) * sizeof(**stats));
+		}
+		*nstats = newsize;
+	}
+
+	return &(*stats)[depth];
+}
+
 /* note current values during parallel executor startup */
 void
 InstrStartParallelQuery(void)
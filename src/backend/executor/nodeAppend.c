@@ -61,9 +61,13 @@
 #include "executor/nodeAppend.h"
 #include "lib/ilist.h"
 #include "miscadmin.h"
+#include "utils/graph.h"
+#include "utils/memutils.h"
 
 static TupleTableSlot *ExecAppend(PlanState *pstate);
 static bool exec_append_initialize_next(AppendState *appendstate);
+static void exec_append_set_labid(AppendState *appendstate);
+static void exec_append_skip_pruned(AppendState *appendstate);
 
 
 /* ----------------------------------------------------------------
@@ -108,6 +112,65 @@ exec_append_initialize_next(AppendState *appendstate)
 	}
 }
 
+/* ----------------------------------------------------------------
+ *		exec_append_set_labid
+ *
+ *		Computes the label ID of the graphid probing the labels
+ *		scanned by the subplans for the current scan.
+ * ----------------------------------------------------------------
+ */
+static void
+exec_append_set_labid(AppendState *appendstate)
+{
+	ExprContext *econtext = appendstate->ps.ps_ExprContext;
+	Datum		value;
+	bool		isnull;
+
+	ResetExprContext(econtext);
+
+	value = ExecEvalExprSwitchContext(appendstate->as_labid_expr, econtext,
+									  &isnull);
+	if (isnull)
+		appendstate->as_labid = -1;
+	else
+		appendstate->as_labid = GraphidGetLabid(DatumGetGraphid(value));
+
+	appendstate->as_labid_ready = true;
+}
+
+/* ----------------------------------------------------------------
+ *		exec_append_skip_pruned
+ *
+ *		Moves past the subplans which scan a label other than the
+ *		label of the probing graphid.  Those subplans cannot return
+ *		anything because every row of a label has the label ID in
+ *		its id.
+ * ----------------------------------------------------------------
+ */
+static void
+exec_append_skip_pruned(AppendState *appendstate)
+{
+	bool		forward;
+
+	if (appendstate->as_labid_expr == NULL || appendstate->as_labid < 0)
+		return;
+
+	forward = ScanDirectionIsForward(appendstate->ps.state->es_direction);
+	while (appendstate->as_whichplan >= 0 &&
+		   appendstate->as_whichplan < appendstate->as_nplans)
+	{
+		int32		labid = appendstate->as_labids[appendstate->as_whichplan];
+
+		if (labid < 0 || labid == appendstate->as_labid)
+			break;
+
+		if (forward)
+			appendstate->as_whichplan++;
+		else
+			appendstate->as_whichplan--;
+	}
+}
+
 /* ----------------------------------------------------------------
  *		ExecInitAppend
  *
@@ -117,6 +180,9 @@ exec_append_initialize_next(AppendState *appendstate)
  *		append node may not be scanned, but this way all of the
  *		structures get allocated in the executor's top level memory
  *		block instead of that of the call to ExecAppend.)
+ *
+ *		Subplans pruned by the label ID of the probing graphid are
+ *		initialized too, since the graphid changes on each rescan.
  * ----------------------------------------------------------------
  */
 AppendState *
@@ -157,8 +223,27 @@ ExecInitAppend(Append *node, EState *estate, int eflags)
 	 * Miscellaneous initialization
 	 *
 	 * Append plans don't have expression contexts because they never call
-	 * ExecQual or ExecProject.
+	 * ExecQual or ExecProject, except for the one to compute the graphid
+	 * probing the labels.
 	 */
+	if (node->labid_expr != NULL)
+	{
+		ExecAssignExprContext(estate, &appendstate->ps);
+
+		appendstate->as_labid_expr = ExecInitExpr(node->labid_expr,
+												  &appendstate->ps);
+		appendstate->as_labids = palloc(nplans * sizeof(int32));
+		i = 0;
+		foreach(lc, node->labids)
+			appendstate->as_labids[i++] = lfirst_int(lc);
+	}
+	else
+	{
+		appendstate->as_labid_expr = NULL;
+		appendstate->as_labids = NULL;
+	}
+	appendstate->as_labid = -1;
+	appendstate->as_labid_ready = false;
 
 	/*
 	 * append nodes still have Result slots, which hold pointers to tuples, so
@@ -208,6 +293,14 @@ ExecAppend(PlanState *pstate)
 {
 	AppendState *node = castNode(AppendState, pstate);
 
+	if (node->as_labid_expr != NULL && !node->as_labid_ready)
+	{
+		exec_append_set_labid(node);
+		exec_append_skip_pruned(node);
+		if (!exec_append_initialize_next(node))
+			return ExecClearTuple(node->ps.ps_ResultTupleSlot);
+	}
+
 	for (;;)
 	{
 		PlanState  *subnode;
@@ -244,6 +337,7 @@ ExecAppend(PlanState *pstate)
 			node->as_whichplan++;
 		else
 			node->as_whichplan--;
+		exec_append_skip_pruned(node);
 		if (!exec_append_initialize_next(node))
 			return ExecClearTuple(node->ps.ps_ResultTupleSlot);
 
@@ -279,6 +373,9 @@ ExecEndAppend(AppendState *node)
 	for (i = 0; i < nplans; i++)
 		ExecEndNode(appendplans[i]);
 
+	if (node->as_labid_expr != NULL)
+		ExecFreeExprContext(&node->ps);
+
 	dlist_foreach_modify(miter, &node->vle_ctxs)
 	{
 		AppendVLECtx *ctx;
@@ -313,6 +410,7 @@ ExecReScanAppend(AppendState *node)
 		if (node->ps.state->es_forceReScan || subnode->chgParam == NULL)
 			ExecReScan(subnode);
 	}
+	node->as_labid_ready = false;
 	node->as_whichplan = 0;
 	exec_append_initialize_next(node);
 }
@@ -325,6 +423,8 @@ ExecUpScanAppend(AppendState *node)
 
 	ctx = dlist_container(AppendVLECtx, list, node->cur_ctx);
 	node->as_whichplan = ctx->as_whichplan;
+	node->as_labid = ctx->as_labid;
+	node->as_labid_ready = ctx->as_labid_ready;
 	if (dlist_has_prev(&node->vle_ctxs, node->cur_ctx))
 		node->cur_ctx = dlist_prev_node(&node->vle_ctxs, node->cur_ctx);
 	else
@@ -345,17 +445,23 @@ ExecDownScanAppend(AppendState *node)
 		node->cur_ctx = dlist_next_node(&node->vle_ctxs, node->cur_ctx);
 		ctx = dlist_container(AppendVLECtx, list, node->cur_ctx);
 		ctx->as_whichplan = node->as_whichplan;
+		ctx->as_labid = node->as_labid;
+		ctx->as_labid_ready = node->as_labid_ready;
 	}
 	else if (node->cur_ctx == NULL && !dlist_is_empty(&node->vle_ctxs))
 	{
 		node->cur_ctx = dlist_head_node(&node->vle_ctxs);
 		ctx = dlist_container(AppendVLECtx, list, node->cur_ctx);
 		ctx->as_whichplan = node->as_whichplan;
+		ctx->as_labid = node->as_labid;
+		ctx->as_labid_ready = node->as_labid_ready;
 	}
 	else
 	{
 		ctx = palloc(sizeof(*ctx));
 		ctx->as_whichplan = node->as_whichplan;
+		ctx->as_labid = node->as_labid;
+		ctx->as_labid_ready = node->as_labid_ready;
 		dlist_push_tail(&node->vle_ctxs, &ctx->list);
 		node->cur_ctx = dlist_tail_node(&node->vle_ctxs);
 	}
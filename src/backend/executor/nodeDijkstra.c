@@ -16,27 +16,68 @@
  *		ExecDijkstra	 	- execute dijkstra's algorithm
  *		ExecInitDijkstra 	- initialize
  *		ExecEndDijkstra 	- shut down
+ *
+ * The edges of a vertex are fetched by rescanning the subplan with the ID of
+ * the vertex. They are kept in an adjacency cache as long as the cache fits
+ * in work_mem, so a vertex that is expanded again (by a stale entry of the
+ * priority queue or by a later rescan with another source) doesn't cost
+ * another scan of the subplan.  enable_dijkstra_cache = off turns the cache
+ * off, and every expansion scans the subplan.
+ *
+ * If every edge weighs the same and nothing but the topology of the edge
+ * label decides which edges to expand, all the edges are put into the
+ * adjacency cache at once from the topology cache (see topocache.c) when the
+ * label is in there, and the subplan is not scanned at all.
+ *
+ * A rescan that changes only the target resumes the search of the previous
+ * scan, so pairs of vertices with the same source (e.g. the sources and the
+ * targets of a MATCH joined as a cross product) cost one search per source.
+ *
+ * If the plan has a heuristic, the subplan also returns an estimate of the
+ * weight from the other side of each edge to the target, and the priority
+ * queue is ordered by the weight so far plus the estimate (A* search).  The
+ * search then goes toward the target instead of expanding every vertex
+ * closer to the source than the target.  The paths found are still the
+ * shortest ones as long as the heuristic never overestimates the weight.
+ *
+ * With LOOPLESS, the paths returned are the k shortest paths that don't
+ * visit a vertex twice (Yen's algorithm).  After the first path is found,
+ * each next path is chosen from candidates that deviate from a path found
+ * so far at one of its vertices (the spur vertex).  A candidate is the part
+ * of that path up to the spur vertex (the root) followed by the shortest
+ * path from the spur vertex to the target that avoids the vertices of the
+ * root and the edges taken at the spur vertex by the paths with the same
+ * root.  The spur paths are found by the same search, so they share the
+ * adjacency cache with each other and with the first path.
  */
 
 #include "postgres.h"
 
 #include "access/htup_details.h"
+#include "catalog/pg_inherits_fn.h"
 #include "catalog/pg_type.h"
 #include "executor/executor.h"
 #include "executor/nodeDijkstra.h"
 #include "executor/tuptable.h"
 #include "lib/pairingheap.h"
+#include "miscadmin.h"
 #include "nodes/execnodes.h"
 #include "nodes/memnodes.h"
 #include "utils/array.h"
 #include "utils/graph.h"
 #include "utils/lsyscache.h"
 #include "utils/memutils.h"
+#include "utils/rls.h"
+#include "utils/topocache.h"
+
+bool		enable_dijkstra_cache = true;
 
 typedef struct vnode
 {
 	Graphid		id;					/* hash key */
 	double		weight;
+	double		heuristic;			/* estimated weight to the target */
+	bool		settled;			/* the weight is the shortest one */
 	List	   *incoming_enodes;
 	ListCell   *out_edge;
 } vnode;
@@ -47,6 +88,47 @@ typedef struct enode
 	vnode	   *prev;
 } enode;
 
+/* edges of a vertex in the adjacency cache */
+typedef struct adjentry
+{
+	Graphid		id;					/* hash key */
+	int			start;				/* index of the first edge */
+	int			nedges;
+} adjentry;
+
+/* an edge taken from the topology cache */
+typedef struct topoedge
+{
+	Graphid		from;
+	Graphid		to;
+	Graphid		id;
+} topoedge;
+
+typedef struct topoedges
+{
+	topoedge   *edges;
+	int			nedges;
+	int			maxedges;
+	bool		reverse;			/* expand from "end" to "start" */
+	bool		full;				/* the edges don't fit in work_mem */
+} topoedges;
+
+/* a path of the k shortest loopless paths */
+typedef struct yen_path
+{
+	pairingheap_node ph_node;
+	int			nedges;
+	int			deviation;			/* index of its spur vertex */
+	Graphid	   *vertices;			/* nedges + 1 vertices */
+	Graphid	   *edges;
+	double	   *weights;			/* weight from the source to each vertex */
+} yen_path;
+
+#define ADJ_INIT_SIZE		1024
+#define ADJ_EDGE_SIZE		(sizeof(Graphid) * 2 + sizeof(double))
+#define ADJ_ENTRY_SIZE		(MAXALIGN(sizeof(adjentry)) + \
+							 MAXALIGN(sizeof(HASHELEMENT)))
+
 static enode *
 new_enode(Graphid id, vnode *prev)
 {
@@ -119,6 +201,7 @@ typedef struct dijkstra_pq_entry
 	pairingheap_node ph_node;
 	Graphid		to;
 	double		weight;
+	double		cost;				/* weight + heuristic of `to` */
 } dijkstra_pq_entry;
 
 static int
@@ -126,16 +209,17 @@ pq_cmp(const pairingheap_node *a, const pairingheap_node *b, void *arg)
 {
 	dijkstra_pq_entry *x = (dijkstra_pq_entry *) a;
 	dijkstra_pq_entry *y = (dijkstra_pq_entry *) b;
-	if (y->weight == x->weight)
+	if (y->cost == x->cost)
 		return 0;
-	else if (y->weight > x->weight)
+	else if (y->cost > x->cost)
 		return 1;
 	else
 		return -1;
 }
 
 static dijkstra_pq_entry *
-pq_add(pairingheap *pq, MemoryContext pq_mcxt, Graphid to, double weight)
+pq_add(pairingheap *pq, MemoryContext pq_mcxt, Graphid to, double weight,
+	   double heuristic)
 {
 	dijkstra_pq_entry *n;
 
@@ -145,6 +229,7 @@ pq_add(pairingheap *pq, MemoryContext pq_mcxt, Graphid to, double weight)
 												 sizeof(dijkstra_pq_entry));
 	n->to = to;
 	n->weight = weight;
+	n->cost = weight + heuristic;
 	pairingheap_add(pq, &n->ph_node);
 	return n;
 }
@@ -199,11 +284,45 @@ eval_array(List *elems, ExprContext *econtext)
 }
 
 static TupleTableSlot *
-proj_path(DijkstraState *node)
+store_path(DijkstraState *node, List *vertexes, List *edges, double weight)
 {
-	Dijkstra   *plan;
+	Dijkstra   *plan = (Dijkstra *) node->ps.plan;
 	ProjectionInfo *projInfo;
 	ExprContext *econtext;
+	TupleTableSlot *slot;
+	Datum	   *tts_values;
+	bool	   *tts_isnull;
+
+	projInfo = node->ps.ps_ProjInfo;
+	slot = projInfo->pi_state.resultslot;
+	econtext = projInfo->pi_exprContext;
+
+	ExecClearTuple(slot);
+
+	tts_values = slot->tts_values;
+	tts_isnull = slot->tts_isnull;
+
+	tts_values[0] = eval_array(vertexes, econtext);
+	tts_isnull[0] = false;
+	tts_values[1] = eval_array(edges, econtext);
+	tts_isnull[1] = false;
+	if (plan->weight_out)
+	{
+		tts_values[2] = (Datum) Float8GetDatum(weight);
+		tts_isnull[2] = false;
+	}
+	else
+	{
+		tts_values[2] = (Datum) 0;
+		tts_isnull[2] = true;
+	}
+
+	return ExecStoreVirtualTuple(slot);
+}
+
+static TupleTableSlot *
+proj_path(DijkstraState *node)
+{
 	vnode	   *end;
 	vnode	   *vertex;
 	enode	   *edge;
@@ -212,11 +331,6 @@ proj_path(DijkstraState *node)
 	List	   *vertexes = NIL;
 	List	   *edges = NIL;
 	ListCell   *null_edge;
-	TupleTableSlot *slot;
-	Datum	   *tts_values;
-	bool	   *tts_isnull;
-
-	plan = (Dijkstra *) node->ps.plan;
 
 	vertex = end = (vnode *) hash_search(node->visited_nodes, &node->target_id,
 										 HASH_FIND, &found);
@@ -238,31 +352,26 @@ proj_path(DijkstraState *node)
 	null_edge = list_nth_cell(edges, 0);
 	edges = list_delete_cell(edges, null_edge, NULL);
 
-	projInfo = node->ps.ps_ProjInfo;
-	slot = projInfo->pi_state.resultslot;
-	econtext = projInfo->pi_exprContext;
-
-	ExecClearTuple(slot);
+	return store_path(node, vertexes, edges, weight);
+}
 
-	tts_values = slot->tts_values;
-	tts_isnull = slot->tts_isnull;
+static TupleTableSlot *
+proj_yen_path(DijkstraState *node, yen_path *path)
+{
+	List	   *vertexes = NIL;
+	List	   *edges = NIL;
+	int			i;
 
-	tts_values[0] = eval_array(vertexes, econtext);
-	tts_isnull[0] = false;
-	tts_values[1] = eval_array(edges, econtext);
-	tts_isnull[1] = false;
-	if (plan->weight_out)
+	for (i = 0; i < path->nedges; i++)
 	{
-		tts_values[2] = (Datum) Float8GetDatum(weight);
-		tts_isnull[2] = false;
-	}
-	else
-	{
-		tts_values[2] = (Datum) 0;
-		tts_isnull[2] = true;
+		vertexes = lappend(vertexes, &path->vertices[i]);
+		edges = lappend(edges, &path->edges[i]);
 	}
+	vertexes = lappend(vertexes, &path->vertices[path->nedges]);
 
-	return ExecStoreVirtualTuple(slot);
+	node->n++;
+
+	return store_path(node, vertexes, edges, path->weights[path->nedges]);
 }
 
 static void
@@ -294,142 +403,865 @@ compute_limit(DijkstraState *node)
 	}
 }
 
-static TupleTableSlot *
-ExecDijkstra(PlanState *pstate)
+static HTAB *
+create_adj_cache(DijkstraState *node)
 {
-	DijkstraState *node = castNode(DijkstraState, pstate);
-	Dijkstra   *dijkstra;
-	PlanState  *outerPlan;
-	ExprContext *econtext;
-	TupleTableSlot *outerTupleSlot;
-	bool		is_null;
-	Datum		start_vid;
-	dijkstra_pq_entry *start_node;
-	Datum		end_vid;
-	vnode	   *vertex;
+	HASHCTL		hash_ctl;
 
-	dijkstra = (Dijkstra *) node->ps.plan;
-	outerPlan = outerPlanState(node);
-	econtext = node->ps.ps_ExprContext;
+	hash_ctl.keysize = sizeof(Graphid);
+	hash_ctl.entrysize = sizeof(adjentry);
+	hash_ctl.hcxt = node->adj_mcxt;
 
-	/*
-	 * Reset per-tuple memory context to free any expression evaluation
-	 * storage allocated in the previous tuple cycle.
-	 */
-	ResetExprContext(econtext);
+	return hash_create("dijkstra's adjacency cache", 1024, &hash_ctl,
+					   HASH_ELEM | HASH_BLOBS | HASH_CONTEXT);
+}
 
-	if (node->is_executed)
+static void
+reset_adj_cache(DijkstraState *node)
+{
+	MemoryContextReset(node->adj_mcxt);
+
+	node->adj_cache = create_adj_cache(node);
+	node->adj_to = NULL;
+	node->adj_eid = NULL;
+	node->adj_weight = NULL;
+	node->adj_heuristic = NULL;
+	node->adj_nedges = 0;
+	node->adj_maxedges = 0;
+	node->adj_space = 0;
+	node->adj_full = !enable_dijkstra_cache;
+	node->adj_complete = false;
+	node->topology_tried = false;
+}
+
+/* make room for one more edge, returns false if it exceeds work_mem */
+static bool
+enlarge_adj_cache(DijkstraState *node)
+{
+	bool		has_heuristic = (((Dijkstra *) node->ps.plan)->heuristic != 0);
+	int			maxedges;
+	Size		edge_size;
+	Size		space;
+
+	if (node->adj_nedges < node->adj_maxedges)
+		return true;
+
+	maxedges = (node->adj_maxedges == 0 ? ADJ_INIT_SIZE :
+				node->adj_maxedges * 2);
+	edge_size = ADJ_EDGE_SIZE;
+	if (has_heuristic)
+		edge_size += sizeof(double);
+	space = node->adj_space + (maxedges - node->adj_maxedges) * edge_size;
+	if (space > work_mem * 1024L)
+		return false;
+
+	if (node->adj_maxedges == 0)
 	{
-		if (node->n < node->max_n)
-			return proj_path(node);
+		node->adj_to = MemoryContextAlloc(node->adj_mcxt,
+										  maxedges * sizeof(Graphid));
+		node->adj_eid = MemoryContextAlloc(node->adj_mcxt,
+										   maxedges * sizeof(Graphid));
+		node->adj_weight = MemoryContextAlloc(node->adj_mcxt,
+											  maxedges * sizeof(double));
+		if (has_heuristic)
+			node->adj_heuristic = MemoryContextAlloc(node->adj_mcxt,
+													 maxedges * sizeof(double));
+	}
+	else
+	{
+		node->adj_to = repalloc(node->adj_to, maxedges * sizeof(Graphid));
+		node->adj_eid = repalloc(node->adj_eid, maxedges * sizeof(Graphid));
+		node->adj_weight = repalloc(node->adj_weight,
+									maxedges * sizeof(double));
+		if (has_heuristic)
+			node->adj_heuristic = repalloc(node->adj_heuristic,
+										   maxedges * sizeof(double));
+	}
+
+	node->adj_maxedges = maxedges;
+	node->adj_space = space;
+
+	return true;
+}
+
+static void
+add_topology_edge(Graphid id, Graphid start, Graphid end, void *arg)
+{
+	topoedges  *topo = (topoedges *) arg;
+	topoedge   *edge;
+
+	if (topo->full)
+		return;
+
+	if (topo->nedges >= topo->maxedges)
+	{
+		int			maxedges;
+
+		maxedges = (topo->maxedges == 0 ? ADJ_INIT_SIZE : topo->maxedges * 2);
+		if (maxedges * sizeof(topoedge) > work_mem * 1024L)
+		{
+			topo->full = true;
+			return;
+		}
+
+		if (topo->maxedges == 0)
+			topo->edges = palloc(maxedges * sizeof(topoedge));
 		else
-			return NULL;
+			topo->edges = repalloc(topo->edges, maxedges * sizeof(topoedge));
+		topo->maxedges = maxedges;
 	}
 
-	node->is_executed = true;
+	edge = &topo->edges[topo->nedges++];
+	edge->from = (topo->reverse ? end : start);
+	edge->to = (topo->reverse ? start : end);
+	edge->id = id;
+}
 
-	compute_limit(node);
+static int
+topoedge_cmp(const void *a, const void *b)
+{
+	const topoedge *ea = (const topoedge *) a;
+	const topoedge *eb = (const topoedge *) b;
+
+	if (ea->from != eb->from)
+		return (ea->from < eb->from ? -1 : 1);
+	if (ea->id != eb->id)
+		return (ea->id < eb->id ? -1 : 1);
+	return 0;
+}
 
-	start_vid = ExecEvalExpr(node->source, econtext, &is_null);
-	start_node = pq_add(node->pq, node->pq_mcxt, DatumGetGraphid(start_vid),
-						0.0);
+/*
+ * Put all the edges of the edge label and its children into the empty
+ * adjacency cache from the topology cache.  Returns false, leaving the
+ * adjacency cache empty, if one of the labels is not in the topology cache
+ * or the edges don't fit in work_mem.  The cached edges are not filtered by
+ * row-level security, so the cache is not used if the label has policies
+ * that apply to the current user.
+ */
+static bool
+load_topology(DijkstraState *node)
+{
+	Dijkstra   *dijkstra = (Dijkstra *) node->ps.plan;
+	Snapshot	snapshot = node->ps.state->es_snapshot;
+	topoedges	topo;
+	List	   *relids;
+	ListCell   *lc;
+	adjentry   *entry = NULL;
+	bool		loaded = true;
+	int			i;
 
-	end_vid = ExecEvalExpr(node->target, econtext, &is_null);
-	node->target_id = DatumGetGraphid(end_vid);
+	Assert(node->adj_nedges == 0);
 
-	vertex = hash_search(node->visited_nodes, &start_node->to, HASH_ENTER,
-						 NULL);
-	vertex->incoming_enodes = NIL;
-	vnode_add_enode(vertex, 0.0, -1, NULL);
+	if (check_enable_rls(dijkstra->topology, InvalidOid, true) == RLS_ENABLED)
+		return false;
+
+	memset(&topo, 0, sizeof(topo));
+	topo.reverse = dijkstra->topology_reverse;
+
+	relids = find_all_inheritors(dijkstra->topology, AccessShareLock, NULL);
+	foreach(lc, relids)
+	{
+		if (!TopologyCacheScanEdges(lfirst_oid(lc), snapshot,
+									add_topology_edge, &topo) || topo.full)
+		{
+			loaded = false;
+			break;
+		}
+	}
+	list_free(relids);
+
+	if (loaded)
+		qsort(topo.edges, topo.nedges, sizeof(topoedge), topoedge_cmp);
+
+	for (i = 0; loaded && i < topo.nedges; i++)
+	{
+		topoedge   *edge = &topo.edges[i];
+
+		if (entry == NULL || entry->id != edge->from)
+		{
+			Size		space = node->adj_space + ADJ_ENTRY_SIZE;
+
+			if (space > work_mem * 1024L)
+			{
+				loaded = false;
+				break;
+			}
+
+			entry = (adjentry *) hash_search(node->adj_cache, &edge->from,
+											 HASH_ENTER, NULL);
+			entry->start = node->adj_nedges;
+			entry->nedges = 0;
+			node->adj_space = space;
+		}
+
+		if (!enlarge_adj_cache(node))
+		{
+			loaded = false;
+			break;
+		}
+
+		node->adj_to[node->adj_nedges] = edge->to;
+		node->adj_eid[node->adj_nedges] = edge->id;
+		node->adj_weight[node->adj_nedges] = dijkstra->topology_weight;
+		node->adj_nedges++;
+		entry->nedges++;
+	}
+
+	if (topo.edges != NULL)
+		pfree(topo.edges);
+
+	if (!loaded)
+	{
+		reset_adj_cache(node);
+		return false;
+	}
+
+	node->topology_edges += topo.nedges;
+
+	return true;
+}
+
+static void
+reset_search(DijkstraState *node)
+{
+	HASHCTL		hash_ctl;
+
+	MemoryContextReset(node->visited_mcxt);
+
+	hash_ctl.keysize = sizeof(Graphid);
+	hash_ctl.entrysize = sizeof(vnode);
+	hash_ctl.hcxt = node->visited_mcxt;
+	node->visited_nodes = hash_create("dijkstra's visited nodes",
+									  1024, &hash_ctl,
+									  HASH_ELEM | HASH_BLOBS | HASH_CONTEXT);
+
+	MemoryContextReset(node->pq_mcxt);
+	pairingheap_reset(node->pq);
+}
+
+static void
+update_max_visited(DijkstraState *node)
+{
+	long		nvisited = hash_get_num_entries(node->visited_nodes);
+
+	if (nvisited > node->max_visited)
+		node->max_visited = nvisited;
+}
+
+/* update the distance of `to` if the edge gives a shorter path to it */
+static void
+relax_edge(DijkstraState *node, vnode *frontier, Graphid to, Graphid eid,
+		   double weight, double heuristic)
+{
+	double		new_weight = frontier->weight + weight;
+	vnode	   *neighbor;
+	bool		found;
+	MemoryContext oldmctx;
+
+	/* the spur path of a loopless path must avoid them */
+	if (node->banned_vertices != NULL &&
+		hash_search(node->banned_vertices, &to, HASH_FIND, NULL) != NULL)
+		return;
+	if (node->banned_edges != NULL &&
+		hash_search(node->banned_edges, &eid, HASH_FIND, NULL) != NULL)
+		return;
+
+	node->edges_relaxed++;
+
+	oldmctx = MemoryContextSwitchTo(node->visited_mcxt);
+
+	neighbor = (vnode *) hash_search(node->visited_nodes, &to, HASH_ENTER,
+									 &found);
+
+	if (!found)
+	{
+		neighbor->heuristic = heuristic;
+		neighbor->settled = false;
+
+		pq_add(node->pq, node->pq_mcxt, to, new_weight, heuristic);
+		node->pq_pushes++;
+
+		neighbor->incoming_enodes = NIL;
+		vnode_add_enode(neighbor, new_weight, eid, frontier);
+	}
+	else if (new_weight < neighbor->weight)
+	{
+		pq_add(node->pq, node->pq_mcxt, to, new_weight, neighbor->heuristic);
+		node->pq_pushes++;
+
+		vnode_update_enode(neighbor, new_weight, eid, frontier);
+	}
+	else if (node->max_n > 1 && new_weight == neighbor->weight &&
+			 !((Dijkstra *) node->ps.plan)->loopless)
+	{
+		/* add a same weight edge */
+		vnode_add_enode(neighbor, new_weight, eid, frontier);
+	}
+
+	MemoryContextSwitchTo(oldmctx);
+}
+
+/* relax the edges of `frontier` by rescanning the subplan */
+static void
+expand_vertex(DijkstraState *node, vnode *frontier)
+{
+	Dijkstra   *dijkstra = (Dijkstra *) node->ps.plan;
+	PlanState  *outerPlan = outerPlanState(node);
+	ExprContext *econtext = node->ps.ps_ExprContext;
+	int			paramno;
+	ParamExecData *prm;
+	ParamExecData saved_prm;
+	adjentry   *entry = NULL;
+	bool		found;
+
+	if (!node->topology_tried)
+	{
+		if (OidIsValid(dijkstra->topology) && enable_dijkstra_cache)
+			node->adj_complete = load_topology(node);
+		node->topology_tried = true;
+	}
+
+	entry = (adjentry *) hash_search(node->adj_cache, &frontier->id,
+									 HASH_FIND, &found);
+	if (found)
+	{
+		int			i;
+
+		node->adj_hits++;
+
+		for (i = entry->start; i < entry->start + entry->nedges; i++)
+			relax_edge(node, frontier, node->adj_to[i], node->adj_eid[i],
+					   node->adj_weight[i],
+					   (node->adj_heuristic != NULL ?
+						node->adj_heuristic[i] : 0.0));
+		return;
+	}
+
+	/* the vertex has no edges */
+	if (node->adj_complete)
+	{
+		node->adj_hits++;
+		return;
+	}
+
+	node->adj_misses++;
+
+	paramno = ((Param *) node->source->expr)->paramid;
+
+	prm = &(econtext->ecxt_param_exec_vals[paramno]);
+	saved_prm = *prm;
+	prm->value = UInt64GetDatum(frontier->id);
+	outerPlan->chgParam = bms_add_member(outerPlan->chgParam, paramno);
+	ExecReScan(outerPlan);
+
+	if (!node->adj_full)
+	{
+		Size		space = node->adj_space + ADJ_ENTRY_SIZE;
+
+		if (space > work_mem * 1024L)
+		{
+			node->adj_full = true;
+		}
+		else
+		{
+			entry = (adjentry *) hash_search(node->adj_cache, &frontier->id,
+											 HASH_ENTER, NULL);
+			entry->start = node->adj_nedges;
+			entry->nedges = 0;
+			node->adj_space = space;
+		}
+	}
+
+	for (;;)
+	{
+		TupleTableSlot *outerTupleSlot;
+		bool		is_null;
+		Datum		to;
+		Datum		eid;
+		Datum		weight;
+		Graphid		to_val;
+		Graphid		eid_val;
+		double		weight_val;
+		double		heuristic_val = 0.0;
+
+		outerTupleSlot = ExecProcNode(outerPlan);
+		if (TupIsNull(outerTupleSlot))
+			break;
+
+		to = slot_getattr(outerTupleSlot, dijkstra->end_id, &is_null);
+		to_val = DatumGetGraphid(to);
+
+		eid = slot_getattr(outerTupleSlot, dijkstra->edge_id, &is_null);
+		eid_val = DatumGetGraphid(eid);
+
+		weight = slot_getattr(outerTupleSlot, dijkstra->weight, &is_null);
+		weight_val = DatumGetFloat8(weight);
+		if (weight_val < 0.0)
+			ereport(ERROR,
+					(errcode(ERRCODE_NUMERIC_VALUE_OUT_OF_RANGE),
+					 errmsg("WEIGHT must be larger than 0")));
+
+		/* NULL heuristic means no estimate */
+		if (dijkstra->heuristic != 0)
+		{
+			Datum		heuristic;
+
+			heuristic = slot_getattr(outerTupleSlot, dijkstra->heuristic,
+									 &is_null);
+			if (!is_null)
+				heuristic_val = DatumGetFloat8(heuristic);
+		}
+
+		if (entry != NULL)
+		{
+			if (enlarge_adj_cache(node))
+			{
+				node->adj_to[node->adj_nedges] = to_val;
+				node->adj_eid[node->adj_nedges] = eid_val;
+				node->adj_weight[node->adj_nedges] = weight_val;
+				if (node->adj_heuristic != NULL)
+					node->adj_heuristic[node->adj_nedges] = heuristic_val;
+				node->adj_nedges++;
+				entry->nedges++;
+			}
+			else
+			{
+				/* give up caching the edges of this vertex */
+				node->adj_nedges = entry->start;
+				hash_search(node->adj_cache, &frontier->id, HASH_REMOVE,
+							NULL);
+				node->adj_space -= ADJ_ENTRY_SIZE;
+				node->adj_full = true;
+				entry = NULL;
+			}
+		}
+
+		relax_edge(node, frontier, to_val, eid_val, weight_val,
+				   heuristic_val);
+	}
+
+	/*
+	 * The param is also the source of the search, which a rescan that
+	 * changes only the target evaluates again.  Restore it.
+	 */
+	*prm = saved_prm;
+}
+
+/*
+ * Pop vertices until the target is popped.  The entry of the target is put
+ * back to the priority queue, so the search can be resumed later toward
+ * another target by calling this again.
+ *
+ * With a heuristic, a vertex that ends another path of the same weight to the
+ * target may be popped after the target, because it can have the same
+ * estimated cost.  If more than one path is wanted, the search goes on until
+ * the smallest cost in the priority queue exceeds the weight of the target.
+ */
+static bool
+continue_search(DijkstraState *node)
+{
+	Dijkstra   *plan = (Dijkstra *) node->ps.plan;
+	bool		same_weight_paths;
+	dijkstra_pq_entry *target_entry = NULL;
+
+	same_weight_paths = (node->max_n > 1 && plan->heuristic != 0 &&
+						 !plan->loopless);
 
 	while (!pairingheap_is_empty(node->pq))
 	{
 		bool		found;
 		dijkstra_pq_entry *min_pq_entry;
 		vnode	   *frontier;
-		int			paramno;
-		ParamExecData *prm;
+
+		CHECK_FOR_INTERRUPTS();
+
+		if (target_entry != NULL)
+		{
+			min_pq_entry = (dijkstra_pq_entry *) pairingheap_first(node->pq);
+			if (min_pq_entry->cost > target_entry->weight)
+				break;
+		}
 
 		min_pq_entry = (dijkstra_pq_entry *) pairingheap_remove_first(node->pq);
-		if (min_pq_entry->to == node->target_id)
-			return proj_path(node);
+		node->pq_pops++;
 
 		frontier = (vnode *) hash_search(node->visited_nodes,
 										 &min_pq_entry->to, HASH_FIND, &found);
 		Assert(found);
 
-		paramno = ((Param *) node->source->expr)->paramid;
+		/* the vertex has been expanded with a shorter distance already */
+		if (min_pq_entry->weight > frontier->weight)
+		{
+			node->pq_stale++;
+			pfree(min_pq_entry);
+			continue;
+		}
 
-		prm = &(econtext->ecxt_param_exec_vals[paramno]);
-		prm->value = UInt64GetDatum(min_pq_entry->to);
-		outerPlan->chgParam = bms_add_member(outerPlan->chgParam, paramno);
-		ExecReScan(outerPlan);
+		if (!frontier->settled)
+		{
+			frontier->settled = true;
+
+			if (frontier->id == node->target_id)
+			{
+				if (same_weight_paths)
+				{
+					target_entry = min_pq_entry;
+					continue;
+				}
+
+				pairingheap_add(node->pq, &min_pq_entry->ph_node);
+				update_max_visited(node);
+				return true;
+			}
+		}
 
 		pfree(min_pq_entry);
 
-		for (;;)
+		expand_vertex(node, frontier);
+	}
+
+	update_max_visited(node);
+
+	if (target_entry != NULL)
+	{
+		pairingheap_add(node->pq, &target_entry->ph_node);
+		return true;
+	}
+
+	return false;
+}
+
+/* search the shortest path from `source` to the target */
+static bool
+search_path(DijkstraState *node, Graphid source)
+{
+	vnode	   *vertex;
+	MemoryContext oldmctx;
+
+	pq_add(node->pq, node->pq_mcxt, source, 0.0, 0.0);
+	node->pq_pushes++;
+
+	oldmctx = MemoryContextSwitchTo(node->visited_mcxt);
+	vertex = hash_search(node->visited_nodes, &source, HASH_ENTER, NULL);
+	vertex->heuristic = 0.0;
+	vertex->settled = false;
+	vertex->incoming_enodes = NIL;
+	vnode_add_enode(vertex, 0.0, -1, NULL);
+	MemoryContextSwitchTo(oldmctx);
+
+	return continue_search(node);
+}
+
+/*
+ * Resume the last search toward the current target.  Vertices that have been
+ * settled already are answered without touching the priority queue.
+ */
+static bool
+resume_search(DijkstraState *node)
+{
+	vnode	   *vertex;
+
+	node->searches_resumed++;
+
+	vertex = (vnode *) hash_search(node->visited_nodes, &node->target_id,
+								   HASH_FIND, NULL);
+	if (vertex != NULL && vertex->settled)
+		return true;
+
+	return continue_search(node);
+}
+
+static int
+yen_path_cmp(const pairingheap_node *a, const pairingheap_node *b, void *arg)
+{
+	yen_path   *x = (yen_path *) a;
+	yen_path   *y = (yen_path *) b;
+	double		xw = x->weights[x->nedges];
+	double		yw = y->weights[y->nedges];
+
+	if (yw == xw)
+		return 0;
+	else if (yw > xw)
+		return 1;
+	else
+		return -1;
+}
+
+/*
+ * Make a path out of `root`, up to its vertex at `spur`, and the path found
+ * by the last search.  `root` is NULL if the search started at the source.
+ */
+static yen_path *
+make_yen_path(DijkstraState *node, yen_path *root, int spur)
+{
+	vnode	   *end;
+	vnode	   *vertex;
+	enode	   *edge;
+	int			nspur = 0;
+	yen_path   *path;
+	int			i;
+
+	end = (vnode *) hash_search(node->visited_nodes, &node->target_id,
+								HASH_FIND, NULL);
+	Assert(end != NULL);
+
+	for (vertex = end; (edge = vnode_get_curr_enode(vertex))->prev != NULL;
+		 vertex = edge->prev)
+		nspur++;
+
+	if (root == NULL)
+		spur = 0;
+
+	path = MemoryContextAlloc(node->yen_mcxt, sizeof(*path));
+	path->nedges = spur + nspur;
+	path->deviation = spur;
+	path->vertices = MemoryContextAlloc(node->yen_mcxt,
+										(path->nedges + 1) * sizeof(Graphid));
+	path->edges = MemoryContextAlloc(node->yen_mcxt,
+									 Max(path->nedges, 1) * sizeof(Graphid));
+	path->weights = MemoryContextAlloc(node->yen_mcxt,
+									   (path->nedges + 1) * sizeof(double));
+
+	if (root != NULL)
+	{
+		memcpy(path->vertices, root->vertices, (spur + 1) * sizeof(Graphid));
+		memcpy(path->edges, root->edges, spur * sizeof(Graphid));
+		memcpy(path->weights, root->weights, (spur + 1) * sizeof(double));
+	}
+
+	i = path->nedges;
+	for (vertex = end; i >= spur; vertex = edge->prev)
+	{
+		edge = vnode_get_curr_enode(vertex);
+
+		path->vertices[i] = vertex->id;
+		path->weights[i] = (root != NULL ? root->weights[spur] : 0.0) +
+			vertex->weight;
+		if (i > spur)
+			path->edges[i - 1] = edge->id;
+		i--;
+	}
+
+	return path;
+}
+
+static bool
+yen_path_equal(yen_path *a, yen_path *b)
+{
+	return (a->nedges == b->nedges &&
+			memcmp(a->edges, b->edges, a->nedges * sizeof(Graphid)) == 0 &&
+			memcmp(a->vertices, b->vertices,
+				   (a->nedges + 1) * sizeof(Graphid)) == 0);
+}
+
+static HTAB *
+create_banned_set(DijkstraState *node, const char *tabname)
+{
+	HASHCTL		hash_ctl;
+
+	hash_ctl.keysize = sizeof(Graphid);
+	hash_ctl.entrysize = sizeof(Graphid);
+	hash_ctl.hcxt = node->yen_mcxt;
+
+	return hash_create(tabname, 64, &hash_ctl,
+					   HASH_ELEM | HASH_BLOBS | HASH_CONTEXT);
+}
+
+/* returns the next shortest loopless path, NULL if there is no more path */
+static yen_path *
+next_yen_path(DijkstraState *node)
+{
+	yen_path   *prev = (yen_path *) llast(node->yen_paths);
+	MemoryContext oldmctx;
+	yen_path   *path;
+	int			spur;
+
+	/*
+	 * Spur vertices before the deviation of the last path have been tried
+	 * when the path it deviates from was the last one.
+	 */
+	for (spur = prev->deviation; spur < prev->nedges; spur++)
+	{
+		ListCell   *lc;
+		int			i;
+		bool		found;
+
+		node->banned_vertices = create_banned_set(node,
+												  "dijkstra's banned vertices");
+		node->banned_edges = create_banned_set(node,
+											   "dijkstra's banned edges");
+
+		/* the edges to the candidates we already have */
+		foreach(lc, node->yen_paths)
+		{
+			yen_path   *p = lfirst(lc);
+
+			if (p->nedges > spur &&
+				memcmp(p->vertices, prev->vertices,
+					   (spur + 1) * sizeof(Graphid)) == 0 &&
+				memcmp(p->edges, prev->edges, spur * sizeof(Graphid)) == 0)
+				hash_search(node->banned_edges, &p->edges[spur], HASH_ENTER,
+							NULL);
+		}
+
+		/* the root; the spur path must not loop back to it */
+		for (i = 0; i < spur; i++)
+			hash_search(node->banned_vertices, &prev->vertices[i], HASH_ENTER,
+						NULL);
+
+		reset_search(node);
+		node->spur_searches++;
+		found = search_path(node, prev->vertices[spur]);
+
+		hash_destroy(node->banned_vertices);
+		hash_destroy(node->banned_edges);
+		node->banned_vertices = NULL;
+		node->banned_edges = NULL;
+
+		if (!found)
+			continue;
+
+		path = make_yen_path(node, prev, spur);
+		foreach(lc, node->yen_seen)
 		{
-			Datum		to;
-			Datum		eid;
-			Datum		weight;
-			Graphid		to_val;
-			Graphid		eid_val;
-			double		weight_val;
-			double		new_weight;
-			vnode	   *neighbor;
-
-			outerTupleSlot = ExecProcNode(outerPlan);
-			if (TupIsNull(outerTupleSlot))
+			if (yen_path_equal(lfirst(lc), path))
 				break;
+		}
+		if (lc != NULL)
+		{
+			pfree(path->vertices);
+			pfree(path->edges);
+			pfree(path->weights);
+			pfree(path);
+			continue;
+		}
 
-			to = slot_getattr(outerTupleSlot, dijkstra->end_id, &is_null);
-			to_val = DatumGetGraphid(to);
+		oldmctx = MemoryContextSwitchTo(node->yen_mcxt);
+		node->yen_seen = lappend(node->yen_seen, path);
+		MemoryContextSwitchTo(oldmctx);
 
-			eid = slot_getattr(outerTupleSlot, dijkstra->edge_id, &is_null);
-			eid_val = DatumGetGraphid(eid);
+		pairingheap_add(node->yen_candidates, &path->ph_node);
+	}
 
-			weight = slot_getattr(outerTupleSlot, dijkstra->weight, &is_null);
-			weight_val = DatumGetFloat8(weight);
-			if (weight_val < 0.0)
-				ereport(ERROR,
-						(errcode(ERRCODE_NUMERIC_VALUE_OUT_OF_RANGE),
-						 errmsg("WEIGHT must be larger than 0")));
+	if (pairingheap_is_empty(node->yen_candidates))
+		return NULL;
 
-			new_weight = frontier->weight + weight_val;
+	path = (yen_path *) pairingheap_remove_first(node->yen_candidates);
 
-			neighbor = (vnode *) hash_search(node->visited_nodes, &to_val,
-											 HASH_ENTER, &found);
+	oldmctx = MemoryContextSwitchTo(node->yen_mcxt);
+	node->yen_paths = lappend(node->yen_paths, path);
+	MemoryContextSwitchTo(oldmctx);
 
-			if (!found)
-			{
-				pq_add(node->pq, node->pq_mcxt, to_val, new_weight);
+	return path;
+}
 
-				neighbor->incoming_enodes = NIL;
-				vnode_add_enode(neighbor, new_weight, eid_val, frontier);
-			}
-			else if (new_weight < neighbor->weight)
-			{
-				pq_add(node->pq, node->pq_mcxt, to_val, new_weight);
+static void
+reset_yen(DijkstraState *node)
+{
+	MemoryContextReset(node->yen_mcxt);
 
-				vnode_update_enode(neighbor, new_weight, eid_val, frontier);
-			}
-			else if (node->max_n > 1 && new_weight == neighbor->weight)
-			{
-				/* add a same weight edge */
-				vnode_add_enode(neighbor, new_weight, eid_val, frontier);
-			}
+	node->yen_paths = NIL;
+	node->yen_seen = NIL;
+	node->yen_candidates = NULL;
+	node->banned_vertices = NULL;
+	node->banned_edges = NULL;
+}
+
+static TupleTableSlot *
+ExecDijkstra(PlanState *pstate)
+{
+	DijkstraState *node = castNode(DijkstraState, pstate);
+	Dijkstra   *plan = (Dijkstra *) node->ps.plan;
+	ExprContext *econtext;
+	bool		is_null;
+	Datum		start_vid;
+	Datum		end_vid;
+	bool		found;
+	yen_path   *path;
+	MemoryContext oldmctx;
+
+	econtext = node->ps.ps_ExprContext;
+
+	/*
+	 * Reset per-tuple memory context to free any expression evaluation
+	 * storage allocated in the previous tuple cycle.
+	 */
+	ResetExprContext(econtext);
+
+	if (node->is_executed)
+	{
+		if (node->n >= node->max_n)
+			return NULL;
+
+		if (!plan->loopless)
+			return proj_path(node);
+
+		path = next_yen_path(node);
+		if (path == NULL)
+		{
+			node->n = node->max_n;
+			return NULL;
 		}
+		return proj_yen_path(node, path);
 	}
 
-	node->n = node->max_n;
-	return NULL;
+	node->is_executed = true;
+
+	compute_limit(node);
+
+	start_vid = ExecEvalExpr(node->source, econtext, &is_null);
+
+	end_vid = ExecEvalExpr(node->target, econtext, &is_null);
+	node->target_id = DatumGetGraphid(end_vid);
+
+	if (node->search_kept && node->max_n == 1 &&
+		node->search_source == DatumGetGraphid(start_vid))
+	{
+		found = resume_search(node);
+	}
+	else
+	{
+		if (node->search_kept)
+			reset_search(node);
+		found = search_path(node, DatumGetGraphid(start_vid));
+	}
+
+	/*
+	 * Keep the search for the next target from the same source.  The paths
+	 * to all the vertices that have been settled are known then, and the
+	 * search goes on from where it stopped for the others.  A heuristic is
+	 * specific to the target, and more than one path per target needs all
+	 * the same weight edges of every vertex, so the search is kept only
+	 * without them.
+	 */
+	node->search_kept = (node->max_n == 1 && plan->heuristic == 0 &&
+						 !plan->loopless);
+	node->search_source = DatumGetGraphid(start_vid);
+
+	if (!found)
+	{
+		node->n = node->max_n;
+		return NULL;
+	}
+
+	if (!plan->loopless)
+		return proj_path(node);
+
+	path = make_yen_path(node, NULL, 0);
+
+	oldmctx = MemoryContextSwitchTo(node->yen_mcxt);
+	node->yen_paths = list_make1(path);
+	node->yen_seen = list_make1(path);
+	node->yen_candidates = pairingheap_allocate(yen_path_cmp, NULL);
+	MemoryContextSwitchTo(oldmctx);
+
+	return proj_yen_path(node, path);
 }
 
 DijkstraState *
 ExecInitDijkstra(Dijkstra *node, EState *estate, int eflags)
 {
 	DijkstraState *dstate;
-	HASHCTL		hash_ctl;
 	PlanState  *outerPlan;
 
 	/* check for unsupported flags */
@@ -455,12 +1287,29 @@ ExecInitDijkstra(Dijkstra *node, EState *estate, int eflags)
 	dstate->pq_mcxt = AllocSetContextCreate(CurrentMemoryContext,
 											"dijkstra's priority queue",
 											ALLOCSET_DEFAULT_SIZES);
-	hash_ctl.keysize = sizeof(Graphid);
-	hash_ctl.entrysize = sizeof(vnode);
-	hash_ctl.hcxt = CurrentMemoryContext;
-	dstate->visited_nodes = hash_create("dijkstra's visited nodes",
-										1024, &hash_ctl,
-										HASH_ELEM | HASH_BLOBS | HASH_CONTEXT);
+	dstate->visited_mcxt = AllocSetContextCreate(CurrentMemoryContext,
+												 "dijkstra's visited nodes",
+												 ALLOCSET_DEFAULT_SIZES);
+	reset_search(dstate);
+	dstate->search_kept = false;
+	dstate->searches_resumed = 0;
+	dstate->yen_mcxt = AllocSetContextCreate(CurrentMemoryContext,
+											 "dijkstra's loopless paths",
+											 ALLOCSET_DEFAULT_SIZES);
+	reset_yen(dstate);
+	dstate->spur_searches = 0;
+	dstate->adj_mcxt = AllocSetContextCreate(CurrentMemoryContext,
+											 "dijkstra's adjacency cache",
+											 ALLOCSET_DEFAULT_SIZES);
+	reset_adj_cache(dstate);
+	dstate->adj_hits = 0;
+	dstate->adj_misses = 0;
+	dstate->topology_edges = 0;
+	dstate->pq_pushes = 0;
+	dstate->pq_pops = 0;
+	dstate->pq_stale = 0;
+	dstate->edges_relaxed = 0;
+	dstate->max_visited = 0;
 
 	dstate->source = ExecInitExpr((Expr *) node->source, (PlanState *) dstate);
 	dstate->target = ExecInitExpr((Expr *) node->target, (PlanState *) dstate);
@@ -503,6 +1352,10 @@ ExecEndDijkstra(DijkstraState *node)
 	ExecClearTuple(node->ps.ps_ResultTupleSlot);
 	ExecClearTuple(node->selfTupleSlot);
 
+	MemoryContextDelete(node->adj_mcxt);
+	MemoryContextDelete(node->visited_mcxt);
+	MemoryContextDelete(node->yen_mcxt);
+
 	/*
 	 * close down subplans
 	 */
@@ -513,10 +1366,27 @@ void
 ExecReScanDijkstra(DijkstraState *node)
 {
 	PlanState  *outerPlan = outerPlanState(node);
-	HASHCTL		hash_ctl;
 
 	compute_limit(node);
 
+	/*
+	 * The cached edges are still valid if the subplan depends only on the
+	 * vertex being expanded.
+	 */
+	if (outerPlan->chgParam != NULL)
+	{
+		Bitmapset  *params = bms_copy(outerPlan->chgParam);
+
+		params = bms_del_member(params,
+								((Param *) node->source->expr)->paramid);
+		if (!bms_is_empty(params))
+		{
+			reset_adj_cache(node);
+			node->search_kept = false;
+		}
+		bms_free(params);
+	}
+
 	/*
 	 * If outerPlan->chgParam is not null then plan will be automatically
 	 * re-scanned by first ExecProcNode.
@@ -527,16 +1397,10 @@ ExecReScanDijkstra(DijkstraState *node)
 	node->n = 0;
 	node->is_executed = false;
 
-	/* reset hash table and priority queue */
-	hash_destroy(node->visited_nodes);
-	hash_ctl.keysize = sizeof(Graphid);
-	hash_ctl.entrysize = sizeof(vnode);
-	hash_ctl.hcxt = CurrentMemoryContext;
-	node->visited_nodes = hash_create("dijkstra's visited nodes",
-									  1024, &hash_ctl,
-									  HASH_ELEM | HASH_BLOBS | HASH_CONTEXT);
-	MemoryContextReset(node->pq_mcxt);
-	pairingheap_reset(node->pq);
+	/* reset hash table and priority queue unless the search can be resumed */
+	if (!node->search_kept)
+		reset_search(node);
+	reset_yen(node);
 
 	ExecClearTuple(node->selfTupleSlot);
 }
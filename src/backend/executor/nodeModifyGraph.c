@@ -11,20 +11,33 @@
 #include "postgres.h"
 
 #include "ag_const.h"
+#include "access/hash.h"
+#include "access/heapam.h"
 #include "access/htup_details.h"
+#include "access/nbtree.h"
+#include "access/relscan.h"
 #include "access/xact.h"
 #include "catalog/ag_graph_fn.h"
+#include "catalog/pg_am.h"
+#include "catalog/pg_inherits_fn.h"
 #include "catalog/pg_type.h"
+#include "commands/progress.h"
+#include "commands/tablespace.h"
 #include "executor/executor.h"
 #include "executor/nodeModifyGraph.h"
 #include "funcapi.h"
 #include "miscadmin.h"
 #include "nodes/graphnodes.h"
 #include "nodes/nodeFuncs.h"
+#include "optimizer/cost.h"
 #include "parser/parse_relation.h"
+#include "pgstat.h"
+#include "storage/buffile.h"
 #include "utils/arrayaccess.h"
 #include "utils/builtins.h"
 #include "utils/datum.h"
+#include "utils/dynahash.h"
+#include "utils/fmgroids.h"
 #include "utils/graph.h"
 #include "utils/jsonb.h"
 #include "utils/lsyscache.h"
@@ -35,14 +48,73 @@
 
 bool		enable_multiple_update = true;
 
+/*
+ * Flush the multi-insert buffers when they have this many tuples or the total
+ * size of the tuples exceeds MAX_BUFFERED_BYTES, like COPY FROM does.
+ */
+#define MAX_BUFFERED_TUPLES		1000
+#define MAX_BUFFERED_BYTES		65535
+
+/*
+ * DETACH DELETE removes the edges of the target vertices in batches of this
+ * many edges.
+ */
+#define DETACH_BATCH_SIZE		1000
+
 /* hash entry */
 typedef struct ModifiedElemEntry
 {
 	Graphid		key;
 	Datum		elem_datum;
 	Oid			type;
+	uint64		seqno;			/* seqno of the batch record loaded last */
 } ModifiedElemEntry;
 
+/* batch numbers are taken from the upper bits of uint32 hash values */
+#define MAX_ELEM_BATCHES		(1 << 16)
+
+/* memory charged to elemTable for an entry */
+#define ELEM_ENTRY_SPACE(elem_datum) \
+	(MAXALIGN(sizeof(ModifiedElemEntry)) + \
+	 VARSIZE_ANY(DatumGetPointer(elem_datum)))
+
+/* header of an entry of elemTable written to a batch file */
+typedef struct ElemBatchRecord
+{
+	Graphid		key;
+	uint64		seqno;			/* order in which the records were made */
+	Oid			type;
+	uint32		len;			/* length of the element that follows */
+} ElemBatchRecord;
+
+/* position of the newest record of a spilled element in its batch file */
+typedef struct SpilledElemEntry
+{
+	Graphid		key;
+	int			batchno;
+	int			fileno;
+	off_t		offset;
+} SpilledElemEntry;
+
+/* position of a final element in elemFinalFile */
+typedef struct FinalElemEntry
+{
+	Graphid		key;
+	int			fileno;
+	off_t		offset;
+} FinalElemEntry;
+
+/* working state of DETACH DELETE for an edge label */
+typedef struct DetachEdgesState
+{
+	ResultRelInfo *resultRelInfo;
+	AttrNumber	start_attno;
+	AttrNumber	end_attno;
+	ItemPointerData tids[DETACH_BATCH_SIZE];	/* edges to remove */
+	int			ntids;
+	int64		ndeleted;
+} DetachEdgesState;
+
 static TupleTableSlot *ExecModifyGraph(PlanState *pstate);
 static void initGraphWRStats(ModifyGraphState *mgstate, GraphWriteOp op);
 static List *ExecInitGraphPattern(List *pattern, ModifyGraphState *mgstate);
@@ -55,6 +127,10 @@ static TupleTableSlot *createPath(ModifyGraphState *mgstate, GraphPath *path,
 								  TupleTableSlot *slot);
 static Datum createVertex(ModifyGraphState *mgstate, GraphVertex *gvertex,
 						  Graphid *vid, TupleTableSlot *slot, bool inPath);
+static void initBufferedTuples(ModifyGraphState *mgstate);
+static void bufferTuple(ModifyGraphState *mgstate,
+						ResultRelInfo *resultRelInfo, HeapTuple tuple);
+static void flushBufferedTuples(ModifyGraphState *mgstate);
 static Datum createEdge(ModifyGraphState *mgstate, GraphEdge *gedge,
 						Graphid start, Graphid end, TupleTableSlot *slot,
 						bool inPath);
@@ -65,6 +141,17 @@ static TupleTableSlot *ExecDeleteGraph(ModifyGraphState *mgstate,
 static bool isDetachRequired(ModifyGraphState *mgstate);
 static void deleteElem(ModifyGraphState *mgstate, Datum elem,
 					   Datum id, Oid type);
+static void detachEdges(ModifyGraphState *mgstate);
+static void scanDetachEdges(ModifyGraphState *mgstate,
+							DetachEdgesState *dstate);
+static void probeDetachEdges(ModifyGraphState *mgstate,
+							 DetachEdgesState *dstate, Relation index,
+							 Graphid *vids, int nvids);
+static bool isDetachVertex(ModifyGraphState *mgstate, Datum vid);
+static void addDetachEdge(ModifyGraphState *mgstate, DetachEdgesState *dstate,
+						  ItemPointer tid);
+static void flushDetachEdges(ModifyGraphState *mgstate,
+							 DetachEdgesState *dstate);
 
 /* SET */
 static TupleTableSlot *ExecSetGraph(ModifyGraphState *mgstate, GSPKind kind,
@@ -90,6 +177,11 @@ static Datum createMergeVertex(ModifyGraphState *mgstate,
 							   Graphid *vid, TupleTableSlot *slot);
 static Datum createMergeEdge(ModifyGraphState *mgstate, GraphEdge *gedge,
 							 Graphid start, Graphid end, TupleTableSlot *slot);
+static bool initMergeKeys(ModifyGraphState *mgstate);
+static void bufferMergeVertex(ModifyGraphState *mgstate,
+							  GraphVertex *gvertex);
+static uint32 mergeKeyHash(const void *key, Size keysize);
+static int	mergeKeyCompare(const void *key1, const void *key2, Size keysize);
 
 /* eager */
 static void enterSetPropTable(ModifyGraphState *mgstate, Oid type, Datum gid,
@@ -100,7 +192,24 @@ static Datum getVertexFinal(ModifyGraphState *mgstate, Datum origin,
 							Graphid gid);
 static Datum getEdgeFinal(ModifyGraphState *mgstate, Datum origin, Graphid gid);
 static Datum getPathFinal(ModifyGraphState *node, Datum origin);
+static Datum getEdgeArrayFinal(ModifyGraphState *mgstate, Datum origin);
+static void setFinalElems(ModifyGraphState *mgstate, TupleTableSlot *slot);
 static void reflectModifiedProp(ModifyGraphState *mgstate);
+static void reflectElemTable(ModifyGraphState *mgstate);
+static void saveFinalElems(ModifyGraphState *mgstate);
+static bool findFinalElem(ModifyGraphState *mgstate, Graphid gid,
+						  Datum *elem);
+static void clearElemTable(ModifyGraphState *mgstate);
+
+/* batches of elemTable */
+static int	getElemBatchNo(ModifyGraphState *mgstate, Graphid gid);
+static void spillElemTable(ModifyGraphState *mgstate);
+static void saveElemBatch(ModifyGraphState *mgstate, int batchno,
+						  Graphid gid, uint64 seqno, Oid type,
+						  Datum elem_datum);
+static void loadElemBatch(ModifyGraphState *mgstate, int batchno);
+static bool findSpilledElem(ModifyGraphState *mgstate, Graphid gid,
+							Datum *elem);
 
 /* common */
 static ResultRelInfo *getResultRelInfo(ModifyGraphState *mgstate, Oid relid);
@@ -147,7 +256,8 @@ ExecInitModifyGraph(ModifyGraph *mgplan, EState *estate, int eflags)
 
 	mgstate->subplan = ExecInitNode(mgplan->subplan, estate, eflags);
 	AssertArg(mgplan->operation != GWROP_MERGE ||
-			  IsA(mgstate->subplan, NestLoopState));
+			  IsA(mgstate->subplan, NestLoopState) ||
+			  IsA(mgstate->subplan, HashJoinState));
 
 	estate->es_snapshot->curcid = svCid;
 
@@ -230,9 +340,29 @@ ExecInitModifyGraph(ModifyGraph *mgplan, EState *estate, int eflags)
 	{
 		mgstate->elemTable = NULL;
 	}
+	mgstate->elemTableSpace = 0;
+	mgstate->nElemBatches = 1;
+	mgstate->elemBatchFiles = NULL;
+	mgstate->elemBatchSeqno = 0;
+	mgstate->elemSpillIndex = NULL;
+	mgstate->elemFinalIndex = NULL;
+	mgstate->elemFinalFile = NULL;
 
 	mgstate->tuplestorestate = tuplestore_begin_heap(false, false, eager_mem);
 
+	/*
+	 * If CREATE doesn't return anything, nobody needs the TID of the created
+	 * elements right away. Buffer them and insert them in batches. MERGE can
+	 * do the same for a single vertex. (see initMergeKeys())
+	 */
+	mgstate->mergeKeyCxt = NULL;
+	if (mgplan->last && !mgstate->eagerness &&
+		mgstate->numResultRelations > 0 &&
+		(mgplan->operation == GWROP_CREATE || initMergeKeys(mgstate)))
+		initBufferedTuples(mgstate);
+	else
+		mgstate->bufferedCxt = NULL;
+
 	return mgstate;
 }
 
@@ -312,15 +442,21 @@ ExecModifyGraph(PlanState *pstate)
 
 		mgstate->child_done = true;
 
+		if (mgstate->bufferedCxt != NULL)
+			flushBufferedTuples(mgstate);
+
 		if (mgstate->elemTable != NULL)
 			reflectModifiedProp(mgstate);
+
+		if (plan->operation == GWROP_DELETE && plan->detach)
+			detachEdges(mgstate);
 	}
 
 	if (mgstate->eagerness)
 	{
+		ExprContext *econtext = mgstate->ps.ps_ExprContext;
 		TupleTableSlot *result;
-		int			natts;
-		int			i;
+		MemoryContext oldmctx;
 
 		/* don't care about scan direction */
 		result = mgstate->ps.ps_ResultTupleSlot;
@@ -331,53 +467,22 @@ ExecModifyGraph(PlanState *pstate)
 
 		slot_getallattrs(result);
 
-		if (mgstate->elemTable == NULL ||
-			hash_get_num_entries(mgstate->elemTable) < 1)
+		/*
+		 * If elemTable has been spilled, reflectModifiedProp() has emptied it
+		 * and left the final elements in elemFinalFile.
+		 */
+		if ((mgstate->elemTable == NULL ||
+			 hash_get_num_entries(mgstate->elemTable) < 1) &&
+			mgstate->elemFinalIndex == NULL)
 			return result;
 
-		natts = result->tts_tupleDescriptor->natts;
-		for (i = 0; i < natts; i++)
-		{
-			Oid			type;
-			Graphid		gid;
-			Datum		elem;
-
-			if (result->tts_isnull[i])
-				continue;
+		/* the final elements are needed only until the next call */
+		ResetExprContext(econtext);
+		oldmctx = MemoryContextSwitchTo(econtext->ecxt_per_tuple_memory);
 
-			type = result->tts_tupleDescriptor->attrs[i]->atttypid;
-			if (type == VERTEXOID)
-			{
-				gid = getVertexIdDatum(result->tts_values[i]);
-				elem = getVertexFinal(mgstate, result->tts_values[i], gid);
-			}
-			else if (type == EDGEOID)
-			{
-				gid = getEdgeIdDatum(result->tts_values[i]);
-				elem = getEdgeFinal(mgstate, result->tts_values[i], gid);
-			}
-			else if (type == GRAPHPATHOID)
-			{
-				elem = getPathFinal(mgstate, result->tts_values[i]);
-			}
-			else if (type == EDGEARRAYOID && plan->operation == GWROP_DELETE)
-			{
-				/*
-				 * The edges are used only for removal,
-				 * not for result output.
-				 *
-				 * This assumes that there are only variable references in the
-				 * target list.
-				 */
-				continue;
-			}
-			else
-			{
-				elog(ERROR, "Invalid graph element type %d.", type);
-			}
+		setFinalElems(mgstate, result);
 
-			setSlotValueByAttnum(result, elem, i + 1);
-		}
+		MemoryContextSwitchTo(oldmctx);
 
 		return result;
 	}
@@ -401,6 +506,38 @@ ExecEndModifyGraph(ModifyGraphState *mgstate)
 	if (mgstate->elemTable != NULL)
 		hash_destroy(mgstate->elemTable);
 
+	if (mgstate->elemBatchFiles != NULL)
+	{
+		for (i = 1; i < mgstate->nElemBatches; i++)
+		{
+			if (mgstate->elemBatchFiles[i] != NULL)
+				BufFileClose(mgstate->elemBatchFiles[i]);
+		}
+	}
+
+	if (mgstate->elemSpillIndex != NULL)
+		hash_destroy(mgstate->elemSpillIndex);
+
+	if (mgstate->elemFinalIndex != NULL)
+		hash_destroy(mgstate->elemFinalIndex);
+
+	if (mgstate->elemFinalFile != NULL)
+		BufFileClose(mgstate->elemFinalFile);
+
+	if (mgstate->bufferedCxt != NULL)
+	{
+		for (i = 0; i < mgstate->numResultRelations; i++)
+		{
+			if (mgstate->bistates[i] != NULL)
+				FreeBulkInsertState(mgstate->bistates[i]);
+		}
+
+		MemoryContextDelete(mgstate->bufferedCxt);
+	}
+
+	if (mgstate->mergeKeyCxt != NULL)
+		MemoryContextDelete(mgstate->mergeKeyCxt);
+
 	resultRelInfo = mgstate->resultRelations;
 	for (i = mgstate->numResultRelations; i > 0; i--)
 	{
@@ -661,6 +798,7 @@ createVertex(ModifyGraphState *mgstate, GraphVertex *gvertex, Graphid *vid,
 	elemTupleSlot->tts_values[1] = vertexProp;
 	MemSet(elemTupleSlot->tts_isnull, false,
 		   elemTupleSlot->tts_tupleDescriptor->natts * sizeof(bool));
+	setSlotPropColumns(elemTupleSlot, 2);
 	ExecStoreVirtualTuple(elemTupleSlot);
 
 	tuple = ExecMaterializeSlot(elemTupleSlot);
@@ -677,26 +815,34 @@ createVertex(ModifyGraphState *mgstate, GraphVertex *gvertex, Graphid *vid,
 	if (resultRelInfo->ri_RelationDesc->rd_att->constr != NULL)
 		ExecConstraints(resultRelInfo, elemTupleSlot, estate);
 
-	/*
-	 * insert the tuple normally
-	 *
-	 * NOTE: heap_insert() returns the cid of the new tuple in the t_self.
-	 */
-	heap_insert(resultRelInfo->ri_RelationDesc, tuple,
-				mgstate->modify_cid + MODIFY_CID_OUTPUT,
-				0, NULL);
+	if (mgstate->bufferedCxt != NULL)
+	{
+		/* the vertex is not in the result, so its TID is not needed */
+		bufferTuple(mgstate, resultRelInfo, tuple);
+	}
+	else
+	{
+		/*
+		 * insert the tuple normally
+		 *
+		 * NOTE: heap_insert() returns the cid of the new tuple in the t_self.
+		 */
+		heap_insert(resultRelInfo->ri_RelationDesc, tuple,
+					mgstate->modify_cid + MODIFY_CID_OUTPUT,
+					0, NULL);
 
-	/* insert index entries for the tuple */
-	if (resultRelInfo->ri_NumIndices > 0)
-		ExecInsertIndexTuples(elemTupleSlot, &(tuple->t_self), estate, false,
-							  NULL, NIL);
+		/* insert index entries for the tuple */
+		if (resultRelInfo->ri_NumIndices > 0)
+			ExecInsertIndexTuples(elemTupleSlot, &(tuple->t_self), estate,
+								  false, NULL, NIL);
 
-	vertex = makeGraphVertexDatum(elemTupleSlot->tts_values[0],
-								  elemTupleSlot->tts_values[1],
-								  PointerGetDatum(&tuple->t_self));
+		vertex = makeGraphVertexDatum(elemTupleSlot->tts_values[0],
+									  elemTupleSlot->tts_values[1],
+									  PointerGetDatum(&tuple->t_self));
 
-	if (gvertex->resno > 0)
-		setSlotValueByAttnum(slot, vertex, gvertex->resno);
+		if (gvertex->resno > 0)
+			setSlotValueByAttnum(slot, vertex, gvertex->resno);
+	}
 
 	if (mgstate->canSetTag)
 	{
@@ -746,6 +892,7 @@ createEdge(ModifyGraphState *mgstate, GraphEdge *gedge, Graphid start,
 	elemTupleSlot->tts_values[3] = edgeProp;
 	MemSet(elemTupleSlot->tts_isnull, false,
 		   elemTupleSlot->tts_tupleDescriptor->natts * sizeof(bool));
+	setSlotPropColumns(elemTupleSlot, 4);
 	ExecStoreVirtualTuple(elemTupleSlot);
 
 	tuple = ExecMaterializeSlot(elemTupleSlot);
@@ -755,22 +902,29 @@ createEdge(ModifyGraphState *mgstate, GraphEdge *gedge, Graphid start,
 	if (resultRelInfo->ri_RelationDesc->rd_att->constr != NULL)
 		ExecConstraints(resultRelInfo, elemTupleSlot, estate);
 
-	heap_insert(resultRelInfo->ri_RelationDesc, tuple,
-				mgstate->modify_cid + MODIFY_CID_OUTPUT,
-				0, NULL);
+	if (mgstate->bufferedCxt != NULL)
+	{
+		bufferTuple(mgstate, resultRelInfo, tuple);
+	}
+	else
+	{
+		heap_insert(resultRelInfo->ri_RelationDesc, tuple,
+					mgstate->modify_cid + MODIFY_CID_OUTPUT,
+					0, NULL);
 
-	if (resultRelInfo->ri_NumIndices > 0)
-		ExecInsertIndexTuples(elemTupleSlot, &(tuple->t_self), estate, false,
-							  NULL, NIL);
+		if (resultRelInfo->ri_NumIndices > 0)
+			ExecInsertIndexTuples(elemTupleSlot, &(tuple->t_self), estate,
+								  false, NULL, NIL);
 
-	edge = makeGraphEdgeDatum(elemTupleSlot->tts_values[0],
-							  elemTupleSlot->tts_values[1],
-							  elemTupleSlot->tts_values[2],
-							  elemTupleSlot->tts_values[3],
-							  PointerGetDatum(&tuple->t_self));
+		edge = makeGraphEdgeDatum(elemTupleSlot->tts_values[0],
+								  elemTupleSlot->tts_values[1],
+								  elemTupleSlot->tts_values[2],
+								  elemTupleSlot->tts_values[3],
+								  PointerGetDatum(&tuple->t_self));
 
-	if (gedge->resno > 0)
-		setSlotValueByAttnum(slot, edge, gedge->resno);
+		if (gedge->resno > 0)
+			setSlotValueByAttnum(slot, edge, gedge->resno);
+	}
 
 	if (mgstate->canSetTag)
 	{
@@ -784,6 +938,114 @@ createEdge(ModifyGraphState *mgstate, GraphEdge *gedge, Graphid start,
 	return edge;
 }
 
+static void
+initBufferedTuples(ModifyGraphState *mgstate)
+{
+	int			n = mgstate->numResultRelations;
+
+	mgstate->bufferedCxt = AllocSetContextCreate(CurrentMemoryContext,
+												 "ModifyGraph buffered tuples",
+												 ALLOCSET_DEFAULT_SIZES);
+	mgstate->bufferedTuples = palloc0(n * sizeof(HeapTuple *));
+	mgstate->nBufferedTuples = palloc0(n * sizeof(int));
+	mgstate->nTotalBufferedTuples = 0;
+	mgstate->bufferedTuplesSize = 0;
+	mgstate->bistates = palloc0(n * sizeof(BulkInsertState));
+}
+
+/* keep a copy of `tuple` to insert it later by flushBufferedTuples() */
+static void
+bufferTuple(ModifyGraphState *mgstate, ResultRelInfo *resultRelInfo,
+			HeapTuple tuple)
+{
+	int			i = resultRelInfo - mgstate->resultRelations;
+	MemoryContext oldmctx;
+
+	if (mgstate->bufferedTuples[i] == NULL)
+		mgstate->bufferedTuples[i] =
+			MemoryContextAlloc(mgstate->ps.state->es_query_cxt,
+							   MAX_BUFFERED_TUPLES * sizeof(HeapTuple));
+
+	oldmctx = MemoryContextSwitchTo(mgstate->bufferedCxt);
+	mgstate->bufferedTuples[i][mgstate->nBufferedTuples[i]++] =
+		heap_copytuple(tuple);
+	MemoryContextSwitchTo(oldmctx);
+
+	mgstate->nTotalBufferedTuples++;
+	mgstate->bufferedTuplesSize += tuple->t_len;
+
+	if (mgstate->nTotalBufferedTuples == MAX_BUFFERED_TUPLES ||
+		mgstate->bufferedTuplesSize > MAX_BUFFERED_BYTES)
+		flushBufferedTuples(mgstate);
+}
+
+/*
+ * Insert the buffered tuples with heap_multi_insert() per label and then
+ * insert index entries for them.
+ */
+static void
+flushBufferedTuples(ModifyGraphState *mgstate)
+{
+	EState	   *estate = mgstate->ps.state;
+	TupleTableSlot *elemTupleSlot = mgstate->elemTupleSlot;
+	ResultRelInfo *savedResultRelInfo = estate->es_result_relation_info;
+	int			i;
+
+	for (i = 0; i < mgstate->numResultRelations; i++)
+	{
+		ResultRelInfo *resultRelInfo = &mgstate->resultRelations[i];
+		Relation	rel = resultRelInfo->ri_RelationDesc;
+		HeapTuple  *tuples = mgstate->bufferedTuples[i];
+		int			ntuples = mgstate->nBufferedTuples[i];
+		MemoryContext oldmctx;
+
+		if (ntuples == 0)
+			continue;
+
+		if (mgstate->bistates[i] == NULL)
+		{
+			oldmctx = MemoryContextSwitchTo(estate->es_query_cxt);
+			mgstate->bistates[i] = GetBulkInsertState();
+			MemoryContextSwitchTo(oldmctx);
+		}
+
+		/*
+		 * heap_multi_insert leaks memory, so switch to short-lived memory
+		 * context before calling it.
+		 */
+		oldmctx = MemoryContextSwitchTo(GetPerTupleMemoryContext(estate));
+		heap_multi_insert(rel, tuples, ntuples,
+						  mgstate->modify_cid + MODIFY_CID_OUTPUT, 0,
+						  mgstate->bistates[i]);
+		MemoryContextSwitchTo(oldmctx);
+
+		if (resultRelInfo->ri_NumIndices > 0)
+		{
+			int			j;
+
+			estate->es_result_relation_info = resultRelInfo;
+			ExecSetSlotDescriptor(elemTupleSlot, RelationGetDescr(rel));
+
+			for (j = 0; j < ntuples; j++)
+			{
+				ExecStoreTuple(tuples[j], elemTupleSlot, InvalidBuffer, false);
+				ExecInsertIndexTuples(elemTupleSlot, &(tuples[j]->t_self),
+									  estate, false, NULL, NIL);
+			}
+
+			ExecClearTuple(elemTupleSlot);
+		}
+
+		mgstate->nBufferedTuples[i] = 0;
+	}
+
+	estate->es_result_relation_info = savedResultRelInfo;
+
+	MemoryContextReset(mgstate->bufferedCxt);
+	mgstate->nTotalBufferedTuples = 0;
+	mgstate->bufferedTuplesSize = 0;
+}
+
 static TupleTableSlot *
 ExecDeleteGraph(ModifyGraphState *mgstate, TupleTableSlot *slot)
 {
@@ -804,8 +1066,7 @@ ExecDeleteGraph(ModifyGraphState *mgstate, TupleTableSlot *slot)
 		bool		isNull;
 
 		type = exprType((Node *) e->expr);
-		if (!(type == VERTEXOID || type == EDGEOID ||
-			  type == GRAPHPATHOID || type == EDGEARRAYOID))
+		if (!(type == VERTEXOID || type == EDGEOID || type == GRAPHPATHOID))
 			ereport(ERROR,
 					(errcode(ERRCODE_DATATYPE_MISMATCH),
 					 errmsg("expected node, relationship, or path")));
@@ -814,16 +1075,9 @@ ExecDeleteGraph(ModifyGraphState *mgstate, TupleTableSlot *slot)
 		elem = ExecEvalExpr(e, econtext, &isNull);
 		if (isNull)
 		{
-			/*
-			 * This assumes that there are only variable references in the
-			 * target list.
-			 */
-			if (type == EDGEARRAYOID)
-				continue;
-			else
-				ereport(NOTICE,
-						(errcode(ERRCODE_NULL_VALUE_NOT_ALLOWED),
-						 errmsg("skipping deletion of NULL graph element")));
+			ereport(NOTICE,
+					(errcode(ERRCODE_NULL_VALUE_NOT_ALLOWED),
+					 errmsg("skipping deletion of NULL graph element")));
 
 			continue;
 		}
@@ -843,7 +1097,6 @@ static bool
 isDetachRequired(ModifyGraphState *mgstate)
 {
 	NestLoopState *nlstate;
-	ModifyGraph *plan;
 
 	/* no vertex in the target list of DELETE */
 	if (!IsA(mgstate->subplan, NestLoopState))
@@ -857,15 +1110,6 @@ isDetachRequired(ModifyGraphState *mgstate)
 	if (nlstate->js.jointype != JOIN_CYPHER_DELETE)
 		return false;
 
-	/*
-	 * All the target edges will be deleted. There may be a chance that no
-	 * edge exists for the vertices in the current slot, but it doesn't
-	 * matter.
-	 */
-	plan = (ModifyGraph *) mgstate->ps.plan;
-	if (plan->detach)
-		return false;
-
 	/*
 	 * true: At least one edge exists for the target vertices in the current
 	 *       slot. (nl_MatchedOuter && !nl_NeedNewOuter)
@@ -953,96 +1197,370 @@ deleteElem(ModifyGraphState *mgstate, Datum elem, Datum gid, Oid type)
 	estate->es_result_relation_info = savedResultRelInfo;
 }
 
-static TupleTableSlot *
-ExecSetGraph(ModifyGraphState *mgstate, GSPKind kind, TupleTableSlot *slot)
+/*
+ * Remove all the edges connected to the vertices removed by DETACH DELETE.
+ *
+ * Looking up the edges of each vertex separately is too slow for vertices
+ * having a lot of edges. Instead, scan each edge label once and remove the
+ * edges whose start or end is one of the target vertices in elemTable. If
+ * there are only a few target vertices compared to the size of a label, probe
+ * the start and end indexes of the label for each vertex instead.
+ */
+static void
+detachEdges(ModifyGraphState *mgstate)
 {
-	ModifyGraph *plan = (ModifyGraph *) mgstate->ps.plan;
-	ExprContext *econtext = mgstate->ps.ps_ExprContext;
-	ListCell   *ls;
-	TupleTableSlot *result = mgstate->ps.ps_ResultTupleSlot;
+	EState	   *estate = mgstate->ps.state;
+	HASH_SEQ_STATUS seq;
+	ModifiedElemEntry *entry;
+	Graphid    *vids;
+	int			nvids = 0;
+	Oid			relid;
+	List	   *edge_relids;
+	int			nlabels;
+	int			nscanned = 0;
+	DetachEdgesState *dstate;
+	CommandId	svCid;
+	const int	index[] = {
+		PROGRESS_DETACH_DELETE_TOTAL_VERTICES,
+		PROGRESS_DETACH_DELETE_TOTAL_LABELS
+	};
+	int64		val[2];
+	ListCell   *lc;
+
+	Assert(mgstate->elemTable != NULL);
+
+	vids = palloc(hash_get_num_entries(mgstate->elemTable) * sizeof(Graphid));
+	hash_seq_init(&seq, mgstate->elemTable);
+	while ((entry = hash_seq_search(&seq)) != NULL)
+	{
+		if (entry->type == VERTEXOID)
+			vids[nvids++] = entry->key;
+	}
+
+	if (nvids == 0)
+	{
+		pfree(vids);
+		return;
+	}
+
+	relid = get_laboid_relid(get_labname_laboid(AG_EDGE, mgstate->graphid));
+	edge_relids = find_all_inheritors(relid, NoLock, NULL);
+	nlabels = list_length(edge_relids);
+
+	dstate = palloc(sizeof(*dstate));
+	dstate->ndeleted = 0;
 
 	/*
-	 * The results of previous clauses should be preserved.
-	 * So, shallow copying is used.
+	 * The edges removed by this clause so far must not be visible, the same
+	 * as the inner side of DELETE JOIN.
 	 */
-	copyVirtualTupleTableSlot(result, slot);
+	svCid = estate->es_snapshot->curcid;
+	estate->es_snapshot->curcid = mgstate->modify_cid + MODIFY_CID_NLJOIN_MATCH;
 
-	foreach(ls, mgstate->sets)
+	pgstat_progress_start_command(PROGRESS_COMMAND_DETACH_DELETE, relid);
+	val[0] = nvids;
+	val[1] = nlabels;
+	pgstat_progress_update_multi_param(2, index, val);
+
+	foreach(lc, edge_relids)
 	{
-		GraphSetProp *gsp = lfirst(ls);
-		Oid			elemtype;
-		Datum		elem_datum;
-		Datum		expr_datum;
-		bool		isNull;
-		Datum		gid;
-		Datum		tid;
-		Datum		newelem;
-		MemoryContext oldmctx;
+		ResultRelInfo *resultRelInfo;
+		Relation	rel;
+		Relation	start_idx = NULL;
+		Relation	end_idx = NULL;
+		BlockNumber nblocks;
+		int			i;
 
-		if (gsp->kind != kind)
-		{
-			Assert(kind != GSP_NORMAL);
-			continue;
-		}
+		resultRelInfo = getResultRelInfo(mgstate, lfirst_oid(lc));
+		rel = resultRelInfo->ri_RelationDesc;
 
-		elemtype = exprType((Node *) gsp->es_elem->expr);
-		if (elemtype != VERTEXOID && elemtype != EDGEOID)
-			elog(ERROR, "expected node or relationship");
+		/* the label being scanned now */
+		pgstat_progress_update_target(RelationGetRelid(rel));
 
-		/* store intermediate results in tuple memory context */
-		oldmctx = MemoryContextSwitchTo(econtext->ecxt_per_tuple_memory);
+		dstate->resultRelInfo = resultRelInfo;
+		dstate->start_attno = attnameAttNum(rel, AG_START_ID, false);
+		dstate->end_attno = attnameAttNum(rel, AG_END_ID, false);
+		dstate->ntids = 0;
 
-		/* get original graph element */
-		elem_datum = ExecEvalExpr(gsp->es_elem, econtext, &isNull);
-		if (isNull)
-			ereport(ERROR,
-					(errcode(ERRCODE_NULL_VALUE_NOT_ALLOWED),
-					 errmsg("updating NULL is not allowed")));
+		/* find the indexes leading with start and end (see makeEdgeIndex()) */
+		for (i = 0; i < resultRelInfo->ri_NumIndices; i++)
+		{
+			Relation	idx = resultRelInfo->ri_IndexRelationDescs[i];
+			IndexInfo  *ii = resultRelInfo->ri_IndexRelationInfo[i];
 
-		/* evaluate SET expression */
+			if (idx->rd_rel->relam != BTREE_AM_OID ||
+				!idx->rd_index->indisvalid || ii->ii_Predicate != NIL)
+				continue;
 
-		if (elemtype == VERTEXOID)
+			if (ii->ii_KeyAttrNumbers[0] == dstate->start_attno)
+				start_idx = idx;
+			else if (ii->ii_KeyAttrNumbers[0] == dstate->end_attno)
+				end_idx = idx;
+		}
+
+		/* each probe reads at least a leaf page and a heap page at random */
+		nblocks = RelationGetNumberOfBlocks(rel);
+		if (start_idx != NULL && end_idx != NULL &&
+			2.0 * nvids * random_page_cost < nblocks * seq_page_cost)
 		{
-			gid = getVertexIdDatum(elem_datum);
-			tid = getVertexTidDatum(elem_datum);
+			probeDetachEdges(mgstate, dstate, start_idx, vids, nvids);
+			probeDetachEdges(mgstate, dstate, end_idx, vids, nvids);
 		}
-		else
+		else if (nblocks > 0)
 		{
-			Assert(elemtype == EDGEOID);
-
-			gid = getEdgeIdDatum(elem_datum);
-			tid = getEdgeTidDatum(elem_datum);
+			scanDetachEdges(mgstate, dstate);
 		}
 
-		findAndReflectNewestValue(mgstate, econtext, gsp, gid);
-		expr_datum = ExecEvalExpr(gsp->es_expr, econtext, &isNull);
-		if (isNull)
-			ereport(ERROR,
-					(errcode(ERRCODE_NULL_VALUE_NOT_ALLOWED),
-					 errmsg("property map cannot be NULL")));
-
-		newelem = makeModifiedElem(econtext, elem_datum, elemtype,
-								   gid, expr_datum, tid);
+		flushDetachEdges(mgstate, dstate);
 
-		MemoryContextSwitchTo(oldmctx);
+		nscanned++;
+		pgstat_progress_update_param(PROGRESS_DETACH_DELETE_LABELS_SCANNED,
+									 nscanned);
+	}
 
-		if (mgstate->elemTable)
-			enterSetPropTable(mgstate, elemtype, gid, newelem);
-		else
-			updateElemProp(mgstate, elemtype, gid, newelem);
+	estate->es_snapshot->curcid = svCid;
 
-		setSlotValueByName(result, newelem, gsp->variable);
-	}
+	pgstat_progress_end_command();
 
-	return (plan->last ? NULL : result);
+	pfree(dstate);
+	list_free(edge_relids);
+	pfree(vids);
 }
 
-static TupleTableSlot *
-copyVirtualTupleTableSlot(TupleTableSlot *dstslot, TupleTableSlot *srcslot)
+/* scan the whole edge label */
+static void
+scanDetachEdges(ModifyGraphState *mgstate, DetachEdgesState *dstate)
 {
-	int natts = srcslot->tts_tupleDescriptor->natts;
+	EState	   *estate = mgstate->ps.state;
+	Relation	rel = dstate->resultRelInfo->ri_RelationDesc;
+	TupleDesc	tupDesc = RelationGetDescr(rel);
+	HeapScanDesc scan;
+	HeapTuple	tuple;
 
-	ExecSetSlotDescriptor(dstslot, srcslot->tts_tupleDescriptor);
+	scan = heap_beginscan(rel, estate->es_snapshot, 0, NULL);
+	while ((tuple = heap_getnext(scan, ForwardScanDirection)) != NULL)
+	{
+		Datum		start;
+		Datum		end;
+		bool		isnull;
+
+		CHECK_FOR_INTERRUPTS();
+
+		start = heap_getattr(tuple, dstate->start_attno, tupDesc, &isnull);
+		if (!isnull && isDetachVertex(mgstate, start))
+		{
+			addDetachEdge(mgstate, dstate, &tuple->t_self);
+			continue;
+		}
+
+		end = heap_getattr(tuple, dstate->end_attno, tupDesc, &isnull);
+		if (!isnull && isDetachVertex(mgstate, end))
+			addDetachEdge(mgstate, dstate, &tuple->t_self);
+	}
+	heap_endscan(scan);
+}
+
+/* look up the edges of each target vertex using the given index */
+static void
+probeDetachEdges(ModifyGraphState *mgstate, DetachEdgesState *dstate,
+				 Relation index, Graphid *vids, int nvids)
+{
+	EState	   *estate = mgstate->ps.state;
+	Relation	rel = dstate->resultRelInfo->ri_RelationDesc;
+	IndexScanDesc scan;
+	ScanKeyData key;
+	int			i;
+
+	scan = index_beginscan(rel, index, estate->es_snapshot, 1, 0);
+	for (i = 0; i < nvids; i++)
+	{
+		HeapTuple	tuple;
+
+		CHECK_FOR_INTERRUPTS();
+
+		ScanKeyInit(&key, 1, BTEqualStrategyNumber, F_GRAPHID_EQ,
+					GraphidGetDatum(vids[i]));
+		index_rescan(scan, &key, 1, NULL, 0);
+
+		while ((tuple = index_getnext(scan, ForwardScanDirection)) != NULL)
+			addDetachEdge(mgstate, dstate, &tuple->t_self);
+	}
+	index_endscan(scan);
+}
+
+static bool
+isDetachVertex(ModifyGraphState *mgstate, Datum vid)
+{
+	Graphid		gid = DatumGetGraphid(vid);
+	ModifiedElemEntry *entry;
+
+	entry = hash_search(mgstate->elemTable, &gid, HASH_FIND, NULL);
+
+	return (entry != NULL && entry->type == VERTEXOID);
+}
+
+static void
+addDetachEdge(ModifyGraphState *mgstate, DetachEdgesState *dstate,
+			  ItemPointer tid)
+{
+	dstate->tids[dstate->ntids++] = *tid;
+
+	if (dstate->ntids >= DETACH_BATCH_SIZE)
+		flushDetachEdges(mgstate, dstate);
+}
+
+static void
+flushDetachEdges(ModifyGraphState *mgstate, DetachEdgesState *dstate)
+{
+	EState	   *estate = mgstate->ps.state;
+	Relation	rel = dstate->resultRelInfo->ri_RelationDesc;
+	CommandId	cid = mgstate->modify_cid + MODIFY_CID_OUTPUT;
+	int			i;
+
+	for (i = 0; i < dstate->ntids; i++)
+	{
+		HTSU_Result	result;
+		HeapUpdateFailureData hufd;
+
+		/* see deleteElem() */
+		result = heap_delete(rel, &dstate->tids[i], cid,
+							 estate->es_crosscheck_snapshot, true, &hufd);
+		switch (result)
+		{
+			case HeapTupleSelfUpdated:
+				/*
+				 * An edge between two target vertices is found twice if the
+				 * indexes are used. It has been removed already.
+				 */
+				if (hufd.cmax == cid)
+					continue;
+
+				ereport(ERROR,
+						(errcode(ERRCODE_INTERNAL_ERROR),
+						 errmsg("modifying the same element more than once cannot happen")));
+				break;
+
+			case HeapTupleMayBeUpdated:
+				break;
+
+			case HeapTupleUpdated:
+				/* TODO: A solution to concurrent update is needed. */
+				ereport(ERROR,
+						(errcode(ERRCODE_T_R_SERIALIZATION_FAILURE),
+						 errmsg("could not serialize access due to concurrent update")));
+				break;
+
+			default:
+				elog(ERROR, "unrecognized heap_update status: %u", result);
+				break;
+		}
+
+		dstate->ndeleted++;
+
+		if (mgstate->canSetTag)
+		{
+			Assert(estate->es_graphwrstats.deleteEdge != UINT_MAX);
+
+			estate->es_graphwrstats.deleteEdge += 1;
+		}
+	}
+
+	dstate->ntids = 0;
+
+	pgstat_progress_update_param(PROGRESS_DETACH_DELETE_EDGES_DELETED,
+								 dstate->ndeleted);
+}
+
+static TupleTableSlot *
+ExecSetGraph(ModifyGraphState *mgstate, GSPKind kind, TupleTableSlot *slot)
+{
+	ModifyGraph *plan = (ModifyGraph *) mgstate->ps.plan;
+	ExprContext *econtext = mgstate->ps.ps_ExprContext;
+	ListCell   *ls;
+	TupleTableSlot *result = mgstate->ps.ps_ResultTupleSlot;
+
+	/*
+	 * The results of previous clauses should be preserved.
+	 * So, shallow copying is used.
+	 */
+	copyVirtualTupleTableSlot(result, slot);
+
+	foreach(ls, mgstate->sets)
+	{
+		GraphSetProp *gsp = lfirst(ls);
+		Oid			elemtype;
+		Datum		elem_datum;
+		Datum		expr_datum;
+		bool		isNull;
+		Datum		gid;
+		Datum		tid;
+		Datum		newelem;
+		MemoryContext oldmctx;
+
+		if (gsp->kind != kind)
+		{
+			Assert(kind != GSP_NORMAL);
+			continue;
+		}
+
+		elemtype = exprType((Node *) gsp->es_elem->expr);
+		if (elemtype != VERTEXOID && elemtype != EDGEOID)
+			elog(ERROR, "expected node or relationship");
+
+		/* store intermediate results in tuple memory context */
+		oldmctx = MemoryContextSwitchTo(econtext->ecxt_per_tuple_memory);
+
+		/* get original graph element */
+		elem_datum = ExecEvalExpr(gsp->es_elem, econtext, &isNull);
+		if (isNull)
+			ereport(ERROR,
+					(errcode(ERRCODE_NULL_VALUE_NOT_ALLOWED),
+					 errmsg("updating NULL is not allowed")));
+
+		/* evaluate SET expression */
+
+		if (elemtype == VERTEXOID)
+		{
+			gid = getVertexIdDatum(elem_datum);
+			tid = getVertexTidDatum(elem_datum);
+		}
+		else
+		{
+			Assert(elemtype == EDGEOID);
+
+			gid = getEdgeIdDatum(elem_datum);
+			tid = getEdgeTidDatum(elem_datum);
+		}
+
+		findAndReflectNewestValue(mgstate, econtext, gsp, gid);
+		expr_datum = ExecEvalExpr(gsp->es_expr, econtext, &isNull);
+		if (isNull)
+			ereport(ERROR,
+					(errcode(ERRCODE_NULL_VALUE_NOT_ALLOWED),
+					 errmsg("property map cannot be NULL")));
+
+		newelem = makeModifiedElem(econtext, elem_datum, elemtype,
+								   gid, expr_datum, tid);
+
+		MemoryContextSwitchTo(oldmctx);
+
+		if (mgstate->elemTable)
+			enterSetPropTable(mgstate, elemtype, gid, newelem);
+		else
+			updateElemProp(mgstate, elemtype, gid, newelem);
+
+		setSlotValueByName(result, newelem, gsp->variable);
+	}
+
+	return (plan->last ? NULL : result);
+}
+
+static TupleTableSlot *
+copyVirtualTupleTableSlot(TupleTableSlot *dstslot, TupleTableSlot *srcslot)
+{
+	int natts = srcslot->tts_tupleDescriptor->natts;
+
+	ExecSetSlotDescriptor(dstslot, srcslot->tts_tupleDescriptor);
 
 	/* shallow copy */
 	memcpy(dstslot->tts_values, srcslot->tts_values, natts * sizeof(Datum));
@@ -1058,22 +1576,21 @@ findAndReflectNewestValue(ModifyGraphState *mgstate, ExprContext *econtext,
 						  GraphSetProp *gsp, Datum gid)
 {
 	ModifiedElemEntry *entry;
-	bool		found;
+	Datum		elem_datum;
 
-	if (mgstate->elemTable)
-	{
-		entry = hash_search(mgstate->elemTable, &gid, HASH_FIND, &found);
-		if (found)
-		{
-			/* reflect results */
-			setSlotValueByName(econtext->ecxt_scantuple,
-							   entry->elem_datum, gsp->variable);
-			setSlotValueByName(econtext->ecxt_innertuple,
-							   entry->elem_datum, gsp->variable);
-			setSlotValueByName(econtext->ecxt_outertuple,
-							   entry->elem_datum, gsp->variable);
-		}
-	}
+	if (mgstate->elemTable == NULL)
+		return;
+
+	entry = hash_search(mgstate->elemTable, &gid, HASH_FIND, NULL);
+	if (entry != NULL)
+		elem_datum = entry->elem_datum;
+	else if (!findSpilledElem(mgstate, DatumGetGraphid(gid), &elem_datum))
+		return;
+
+	/* reflect results */
+	setSlotValueByName(econtext->ecxt_scantuple, elem_datum, gsp->variable);
+	setSlotValueByName(econtext->ecxt_innertuple, elem_datum, gsp->variable);
+	setSlotValueByName(econtext->ecxt_outertuple, elem_datum, gsp->variable);
 }
 
 /* See ExecUpdate() */
@@ -1128,6 +1645,7 @@ updateElemProp(ModifyGraphState *mgstate, Oid elemtype, Datum gid,
 	}
 	MemSet(elemTupleSlot->tts_isnull, false,
 		   elemTupleSlot->tts_tupleDescriptor->natts * sizeof(bool));
+	setSlotPropColumns(elemTupleSlot, (elemtype == VERTEXOID ? 2 : 4));
 	ExecStoreVirtualTuple(elemTupleSlot);
 
 	tuple = ExecMaterializeSlot(elemTupleSlot);
@@ -1212,6 +1730,16 @@ ExecMergeGraph(ModifyGraphState *mgstate, TupleTableSlot *slot)
 		if (mgstate->sets != NIL)
 			slot = ExecSetGraph(mgstate, GSP_ON_MATCH, slot);
 	}
+	else if (mgstate->bufferedCxt != NULL)
+	{
+		MemoryContext oldmctx;
+
+		oldmctx = MemoryContextSwitchTo(econtext->ecxt_per_tuple_memory);
+
+		bufferMergeVertex(mgstate, (GraphVertex *) linitial(path->chain));
+
+		MemoryContextSwitchTo(oldmctx);
+	}
 	else
 	{
 		MemoryContext oldmctx;
@@ -1233,6 +1761,10 @@ ExecMergeGraph(ModifyGraphState *mgstate, TupleTableSlot *slot)
 static bool
 isMatchedMergePattern(PlanState *planstate)
 {
+	/* see add_paths_for_cmerge() */
+	if (IsA(planstate, HashJoinState))
+		return ((HashJoinState *) planstate)->hj_MatchedOuter;
+
 	Assert(IsA(planstate, NestLoopState));
 
 	return ((NestLoopState *) planstate)->nl_MatchedOuter;
@@ -1373,6 +1905,7 @@ createMergeVertex(ModifyGraphState *mgstate, GraphVertex *gvertex,
 	insertSlot->tts_values[1] = vertexProp;
 	MemSet(insertSlot->tts_isnull, false,
 		   insertSlot->tts_tupleDescriptor->natts * sizeof(bool));
+	setSlotPropColumns(insertSlot, 2);
 	ExecStoreVirtualTuple(insertSlot);
 
 	tuple = ExecMaterializeSlot(insertSlot);
@@ -1448,6 +1981,7 @@ createMergeEdge(ModifyGraphState *mgstate, GraphEdge *gedge, Graphid start,
 	insertSlot->tts_values[3] = edgeProp;
 	MemSet(insertSlot->tts_isnull, false,
 		   insertSlot->tts_tupleDescriptor->natts * sizeof(bool));
+	setSlotPropColumns(insertSlot, 4);
 	ExecStoreVirtualTuple(insertSlot);
 
 	tuple = ExecMaterializeSlot(insertSlot);
@@ -1486,117 +2020,335 @@ createMergeEdge(ModifyGraphState *mgstate, GraphEdge *gedge, Graphid start,
 	return edge;
 }
 
-static void
-enterSetPropTable(ModifyGraphState *mgstate, Oid type, Datum gid,
-				  Datum elem_datum)
+/*
+ * MERGE of a single vertex can find the vertices it has created by itself if
+ * nothing is returned and there is no ON MATCH/ON CREATE SET. This returns the
+ * literal property map of the vertex if so, and NULL otherwise.
+ *
+ * MATCH part of MERGE compares each value in a flat literal map with `=`. So,
+ * an input row whose values are all kept in its property map as they are
+ * matches a vertex created by MERGE exactly when their property maps are the
+ * same. The planner may then join MATCH part without seeing the created
+ * vertices. (see add_paths_for_cmerge())
+ */
+CypherMapExpr *
+getMergeKeyMap(GraphWriteOp operation, bool last, bool eager, List *pattern,
+			   List *sets)
 {
-	ModifiedElemEntry *entry;
-	bool		found;
+	GraphPath  *gpath;
+	GraphVertex *gvertex;
+	RowExpr    *rowexpr;
+	Node	   *prop;
+	CypherMapExpr *map;
+	List	   *keys = NIL;
+	ListCell   *le;
 
-	entry = hash_search(mgstate->elemTable, &gid, HASH_ENTER, &found);
-	if (found)
-	{
-		if (enable_multiple_update)
-			pfree(DatumGetPointer(entry->elem_datum));
-		else
-			ereport(ERROR,
-					(errcode(ERRCODE_INTERNAL_ERROR),
-					 errmsg("graph element(%hu," UINT64_FORMAT ") has been SET multiple times",
-							GraphidGetLabid(entry->key),
-							GraphidGetLocid(entry->key))));
-	}
+	if (operation != GWROP_MERGE || !last || eager || sets != NIL)
+		return NULL;
 
-	entry->elem_datum = datumCopy(elem_datum, false, -1);
-	entry->type = type;
-}
+	gpath = linitial(pattern);
+	if (list_length(gpath->chain) != 1)
+		return NULL;
 
-static void
-enterDelPropTable(ModifyGraphState *mgstate, Datum elem, Oid type)
-{
-	Datum		gid;
-	bool		found;
-	ModifiedElemEntry *entry;
+	gvertex = linitial(gpath->chain);
+	if (!IsA(gvertex->expr, RowExpr))
+		return NULL;
+	rowexpr = (RowExpr *) gvertex->expr;
+	Assert(list_length(rowexpr->args) == 2);
 
-	if (type == VERTEXOID)
+	/* COALESCE(jsonb_strip_nulls(map), default) (see makeNewVertex()) */
+	prop = lsecond(rowexpr->args);
+	if (!IsA(prop, CoalesceExpr))
+		return NULL;
+	prop = linitial(((CoalesceExpr *) prop)->args);
+	if (!IsA(prop, FuncExpr) ||
+		((FuncExpr *) prop)->funcid != F_JSONB_STRIP_NULLS)
+		return NULL;
+	prop = linitial(((FuncExpr *) prop)->args);
+	if (!IsA(prop, CypherMapExpr))
+		return NULL;
+	map = (CypherMapExpr *) prop;
+
+	le = list_head(map->keyvals);
+	while (le != NULL)
 	{
-		gid = getVertexIdDatum(elem);
+		Const	   *k;
+		Node	   *v;
+		Value	   *key;
+
+		k = lfirst(le);
+		le = lnext(le);
+		v = lfirst(le);
+		le = lnext(le);
+
+		/* nested maps are compared key by key, and the last duplicate wins */
+		Assert(IsA(k, Const));
+		key = makeString(TextDatumGetCString(k->constvalue));
+		if (IsA(v, CypherMapExpr) || list_member(keys, key))
+			return NULL;
+
+		keys = lappend(keys, key);
+	}
 
-		entry = hash_search(mgstate->elemTable, &gid, HASH_ENTER, &found);
-		if (found)
-			return;
+	return map;
+}
 
-		entry->elem_datum = datumCopy(elem, false, -1);
-		entry->type = type;
-	}
-	else if (type == EDGEOID)
-	{
-		gid = getEdgeIdDatum(elem);
+/*
+ * If MERGE can find the vertices it has created by itself, this prepares the
+ * expressions of the vertex so that the vertices can be buffered.
+ */
+static bool
+initMergeKeys(ModifyGraphState *mgstate)
+{
+	ModifyGraph *plan = (ModifyGraph *) mgstate->ps.plan;
+	CypherMapExpr *map;
+	GraphVertex *gvertex;
+	RowExpr    *rowexpr;
 
-		entry = hash_search(mgstate->elemTable, &gid, HASH_ENTER, &found);
-		if (found)
-			return;
+	map = getMergeKeyMap(plan->operation, plan->last, mgstate->eagerness,
+						 mgstate->pattern, mgstate->sets);
+	if (map == NULL)
+		return false;
 
-		entry->elem_datum = datumCopy(elem, false, -1);
-		entry->type = type;
-	}
-	else if (type == GRAPHPATHOID)
-	{
-		List	   *vtxList = NIL;
-		List	   *edgeList = NIL;
-		ListCell   *lc;
+	gvertex = linitial(((GraphPath *) linitial(mgstate->pattern))->chain);
+	rowexpr = (RowExpr *) gvertex->expr;
 
-		Assert(type == GRAPHPATHOID);
+	mgstate->mergeIdExpr = ExecInitExpr(linitial(rowexpr->args),
+										(PlanState *) mgstate);
+	mgstate->mergeMapExpr = ExecInitExpr((Expr *) map, (PlanState *) mgstate);
+	mgstate->mergeNumKeys = list_length(map->keyvals) / 2;
 
-		getElemListInPath(elem, &vtxList, &edgeList);
+	/* the created vertices are remembered for the whole statement */
+	mgstate->mergeKeyCxt = AllocSetContextCreate(CurrentMemoryContext,
+												 "MERGE key table",
+												 ALLOCSET_DEFAULT_SIZES);
+	mgstate->mergeKeyTable = NULL;
 
-		foreach(lc, vtxList)
-		{
-			Datum		vtx = (Datum) lfirst(lc);
+	return true;
+}
 
-			gid = getVertexIdDatum(vtx);
-			entry = hash_search(mgstate->elemTable, &gid, HASH_ENTER, &found);
-			if (found)
-				continue;
+/* See createMergeVertex() */
+static void
+bufferMergeVertex(ModifyGraphState *mgstate, GraphVertex *gvertex)
+{
+	EState	   *estate = mgstate->ps.state;
+	ExprContext *econtext = mgstate->ps.ps_ExprContext;
+	ResultRelInfo *resultRelInfo;
+	ResultRelInfo *savedResultRelInfo;
+	bool		isNull;
+	Datum		vertexId;
+	Datum		map;
+	Jsonb	   *prop_map;
+	bool		found;
+	TupleTableSlot *insertSlot = mgstate->elemTupleSlot;
+	HeapTuple	tuple;
+	Jsonb	  **key;
 
-			entry->elem_datum = datumCopy(vtx, false, -1);
-			entry->type = VERTEXOID;
+	map = ExecEvalExpr(mgstate->mergeMapExpr, econtext, &isNull);
+	Assert(!isNull);
+	prop_map = DatumGetJsonb(DirectFunctionCall1(jsonb_strip_nulls, map));
+
+	/*
+	 * A row whose value has been dropped from the map, or changed by
+	 * stripping NULL values in it, cannot match any vertex created by MERGE.
+	 * Other rows match the vertex with the same property map.
+	 */
+	if (JB_ROOT_COUNT(DatumGetJsonb(map)) == mgstate->mergeNumKeys &&
+		compareJsonbContainers(&DatumGetJsonb(map)->root,
+							   &prop_map->root) == 0 &&
+		mgstate->mergeKeyTable != NULL &&
+		hash_search(mgstate->mergeKeyTable, &prop_map, HASH_FIND,
+					NULL) != NULL)
+		return;
+
+	vertexId = ExecEvalExpr(mgstate->mergeIdExpr, econtext, &isNull);
+	if (isNull)
+		ereport(ERROR,
+				(errcode(ERRCODE_NULL_VALUE_NOT_ALLOWED),
+				 errmsg("NULL is not allowed in MERGE")));
+
+	resultRelInfo = getResultRelInfo(mgstate, gvertex->relid);
+	savedResultRelInfo = estate->es_result_relation_info;
+	estate->es_result_relation_info = resultRelInfo;
+
+	ExecClearTuple(insertSlot);
+
+	ExecSetSlotDescriptor(insertSlot,
+						  RelationGetDescr(resultRelInfo->ri_RelationDesc));
+	insertSlot->tts_values[0] = vertexId;
+	insertSlot->tts_values[1] = JsonbGetDatum(prop_map);
+	MemSet(insertSlot->tts_isnull, false,
+		   insertSlot->tts_tupleDescriptor->natts * sizeof(bool));
+	setSlotPropColumns(insertSlot, 2);
+	ExecStoreVirtualTuple(insertSlot);
+
+	tuple = ExecMaterializeSlot(insertSlot);
+	tuple->t_tableOid = RelationGetRelid(resultRelInfo->ri_RelationDesc);
+
+	if (resultRelInfo->ri_RelationDesc->rd_att->constr != NULL)
+		ExecConstraints(resultRelInfo, insertSlot, estate);
+
+	if (mgstate->mergeKeyTable == NULL)
+	{
+		HASHCTL		ctl;
+
+		memset(&ctl, 0, sizeof(ctl));
+		ctl.keysize = sizeof(Jsonb *);
+		ctl.entrysize = sizeof(Jsonb *);
+		ctl.hash = mergeKeyHash;
+		ctl.match = mergeKeyCompare;
+		ctl.hcxt = mgstate->mergeKeyCxt;
+
+		mgstate->mergeKeyTable =
+				hash_create("MERGE key table", MAX_BUFFERED_TUPLES, &ctl,
+							HASH_ELEM | HASH_FUNCTION | HASH_COMPARE |
+							HASH_CONTEXT);
+	}
+
+	/* later rows may match this vertex, even if this row cannot */
+	key = hash_search(mgstate->mergeKeyTable, &prop_map, HASH_ENTER, &found);
+	if (!found)
+	{
+		*key = MemoryContextAlloc(mgstate->mergeKeyCxt, VARSIZE(prop_map));
+		memcpy(*key, prop_map, VARSIZE(prop_map));
+	}
+
+	bufferTuple(mgstate, resultRelInfo, tuple);
+
+	if (mgstate->canSetTag)
+	{
+		Assert(estate->es_graphwrstats.insertVertex != UINT_MAX);
+
+		estate->es_graphwrstats.insertVertex++;
+	}
+
+	estate->es_result_relation_info = savedResultRelInfo;
+}
+
+static uint32
+mergeKeyHash(const void *key, Size keysize)
+{
+	Jsonb	   *prop_map = *((Jsonb *const *) key);
+
+	return DatumGetUInt32(DirectFunctionCall1(jsonb_hash,
+											  PointerGetDatum(prop_map)));
+}
+
+static int
+mergeKeyCompare(const void *key1, const void *key2, Size keysize)
+{
+	Jsonb	   *prop_map1 = *((Jsonb *const *) key1);
+	Jsonb	   *prop_map2 = *((Jsonb *const *) key2);
+
+	return compareJsonbContainers(&prop_map1->root, &prop_map2->root);
+}
+
+static void
+enterSetPropTable(ModifyGraphState *mgstate, Oid type, Datum gid,
+				  Datum elem_datum)
+{
+	ModifiedElemEntry *entry;
+	bool		found;
+	int			batchno;
+
+	batchno = getElemBatchNo(mgstate, DatumGetGraphid(gid));
+	if (batchno != 0)
+	{
+		if (!enable_multiple_update &&
+			hash_search(mgstate->elemSpillIndex, &gid, HASH_FIND, NULL) != NULL)
+			ereport(ERROR,
+					(errcode(ERRCODE_INTERNAL_ERROR),
+					 errmsg("graph element(%hu," UINT64_FORMAT ") has been SET multiple times",
+							GraphidGetLabid(DatumGetGraphid(gid)),
+							GraphidGetLocid(DatumGetGraphid(gid)))));
+
+		saveElemBatch(mgstate, batchno, DatumGetGraphid(gid),
+					  mgstate->elemBatchSeqno++, type, elem_datum);
+		return;
+	}
+
+	entry = hash_search(mgstate->elemTable, &gid, HASH_ENTER, &found);
+	if (found)
+	{
+		if (enable_multiple_update)
+		{
+			mgstate->elemTableSpace -= ELEM_ENTRY_SPACE(entry->elem_datum);
+			pfree(DatumGetPointer(entry->elem_datum));
+		}
+		else
+		{
+			ereport(ERROR,
+					(errcode(ERRCODE_INTERNAL_ERROR),
+					 errmsg("graph element(%hu," UINT64_FORMAT ") has been SET multiple times",
+							GraphidGetLabid(entry->key),
+							GraphidGetLocid(entry->key))));
 		}
+	}
 
-		foreach(lc, edgeList)
+	entry->elem_datum = datumCopy(elem_datum, false, -1);
+	entry->type = type;
+	entry->seqno = 0;
+
+	mgstate->elemTableSpace += ELEM_ENTRY_SPACE(entry->elem_datum);
+	if (mgstate->elemTableSpace > eager_mem * 1024L)
+		spillElemTable(mgstate);
+}
+
+static void
+enterDelPropTable(ModifyGraphState *mgstate, Datum elem, Oid type)
+{
+	Datum		gid;
+	bool		found;
+	ModifiedElemEntry *entry;
+
+	if (type == VERTEXOID)
+	{
+		gid = getVertexIdDatum(elem);
+
+		entry = hash_search(mgstate->elemTable, &gid, HASH_ENTER, &found);
+		if (found)
+			return;
+
+		entry->elem_datum = datumCopy(elem, false, -1);
+		entry->type = type;
+	}
+	else if (type == EDGEOID)
+	{
+		gid = getEdgeIdDatum(elem);
+
+		entry = hash_search(mgstate->elemTable, &gid, HASH_ENTER, &found);
+		if (found)
+			return;
+
+		entry->elem_datum = datumCopy(elem, false, -1);
+		entry->type = type;
+	}
+	else if (type == GRAPHPATHOID)
+	{
+		List	   *vtxList = NIL;
+		List	   *edgeList = NIL;
+		ListCell   *lc;
+
+		Assert(type == GRAPHPATHOID);
+
+		getElemListInPath(elem, &vtxList, &edgeList);
+
+		foreach(lc, vtxList)
 		{
-			Datum		edge = (Datum) lfirst(lc);
+			Datum		vtx = (Datum) lfirst(lc);
 
-			gid = getEdgeIdDatum(edge);
+			gid = getVertexIdDatum(vtx);
 			entry = hash_search(mgstate->elemTable, &gid, HASH_ENTER, &found);
 			if (found)
 				continue;
 
-			entry->elem_datum = datumCopy(edge, false, -1);
-			entry->type = EDGEOID;
+			entry->elem_datum = datumCopy(vtx, false, -1);
+			entry->type = VERTEXOID;
 		}
-	}
-	else if (type == EDGEARRAYOID)
-	{
-		AnyArrayType *edges;
-		int			nedges;
-		int16		typlen;
-		bool		typbyval;
-		char		typalign;
-		array_iter	it;
-		int			i;
-		Datum		edge;
-		bool		isnull;
 
-		edges = DatumGetAnyArray(elem);
-		nedges = ArrayGetNItems(AARR_NDIM(edges), AARR_DIMS(edges));
-
-		get_typlenbyvalalign(AARR_ELEMTYPE(edges), &typlen,
-							 &typbyval, &typalign);
-
-		array_iter_setup(&it, edges);
-		for (i = 0; i < nedges; i++)
+		foreach(lc, edgeList)
 		{
-			edge = array_iter_next(&it, &isnull, i, typlen, typbyval, typalign);
+			Datum		edge = (Datum) lfirst(lc);
 
 			gid = getEdgeIdDatum(edge);
 			entry = hash_search(mgstate->elemTable, &gid, HASH_ENTER, &found);
@@ -1675,36 +2427,32 @@ static Datum
 getVertexFinal(ModifyGraphState *mgstate, Datum origin, Graphid gid)
 {
 	ModifyGraph *plan = (ModifyGraph *) mgstate->ps.plan;
-	ModifiedElemEntry *entry;
-
-	entry = hash_search(mgstate->elemTable, &gid, HASH_FIND, NULL);
+	Datum		elem;
 
 	/* unmodified vertex */
-	if (entry == NULL)
+	if (!findFinalElem(mgstate, gid, &elem))
 		return origin;
 
 	if (plan->operation == GWROP_DELETE)
 		return (Datum) 0;
 	else
-		return entry->elem_datum;
+		return elem;
 }
 
 static Datum
 getEdgeFinal(ModifyGraphState *mgstate, Datum origin, Graphid gid)
 {
 	ModifyGraph *plan = (ModifyGraph *) mgstate->ps.plan;
-	ModifiedElemEntry *entry;
-
-	entry = hash_search(mgstate->elemTable, &gid, HASH_FIND, NULL);
+	Datum		elem;
 
 	/* unmodified edge */
-	if (entry == NULL)
+	if (!findFinalElem(mgstate, gid, &elem))
 		return origin;
 
 	if (plan->operation == GWROP_DELETE)
 		return (Datum) 0;
 	else
-		return entry->elem_datum;
+		return elem;
 }
 
 static Datum
@@ -1796,15 +2544,153 @@ getPathFinal(ModifyGraphState *mgstate, Datum origin)
 	return result;
 }
 
+/* edges of a variable length relationship */
+static Datum
+getEdgeArrayFinal(ModifyGraphState *mgstate, Datum origin)
+{
+	ArrayType  *arr = DatumGetArrayTypeP(origin);
+	int16		typlen;
+	bool		typbyval;
+	char		typalign;
+	Datum	   *edges;
+	int			nedges;
+	int			i;
+	bool		modified = false;
+	Datum		result;
+
+	get_typlenbyvalalign(EDGEOID, &typlen, &typbyval, &typalign);
+	deconstruct_array(arr, EDGEOID, typlen, typbyval, typalign, &edges, NULL,
+					  &nedges);
+
+	for (i = 0; i < nedges; i++)
+	{
+		Datum		edge;
+
+		edge = getEdgeFinal(mgstate, edges[i], getEdgeIdDatum(edges[i]));
+		Assert(edge != (Datum) 0);
+
+		if (edge != edges[i])
+			modified = true;
+
+		edges[i] = edge;
+	}
+
+	if (modified)
+		result = PointerGetDatum(construct_array(edges, nedges, EDGEOID,
+												 typlen, typbyval, typalign));
+	else
+		result = origin;
+
+	pfree(edges);
+
+	return result;
+}
+
+/* replace the graph elements in `slot` with their final values */
+static void
+setFinalElems(ModifyGraphState *mgstate, TupleTableSlot *slot)
+{
+	ModifyGraph *plan = (ModifyGraph *) mgstate->ps.plan;
+	int			natts = slot->tts_tupleDescriptor->natts;
+	int			i;
+
+	for (i = 0; i < natts; i++)
+	{
+		Oid			type;
+		Graphid		gid;
+		Datum		elem;
+
+		if (slot->tts_isnull[i])
+			continue;
+
+		type = slot->tts_tupleDescriptor->attrs[i]->atttypid;
+		if (type == VERTEXOID)
+		{
+			gid = getVertexIdDatum(slot->tts_values[i]);
+			elem = getVertexFinal(mgstate, slot->tts_values[i], gid);
+		}
+		else if (type == EDGEOID)
+		{
+			gid = getEdgeIdDatum(slot->tts_values[i]);
+			elem = getEdgeFinal(mgstate, slot->tts_values[i], gid);
+		}
+		else if (type == GRAPHPATHOID)
+		{
+			elem = getPathFinal(mgstate, slot->tts_values[i]);
+		}
+		else if (type == EDGEARRAYOID)
+		{
+			/*
+			 * The edges are used only for removal,
+			 * not for result output.
+			 *
+			 * This assumes that there are only variable references in the
+			 * target list.
+			 */
+			if (plan->operation == GWROP_DELETE)
+				continue;
+
+			elem = getEdgeArrayFinal(mgstate, slot->tts_values[i]);
+		}
+		else
+		{
+			elog(ERROR, "Invalid graph element type %d.", type);
+		}
+
+		setSlotValueByAttnum(slot, elem, i + 1);
+	}
+}
+
+/*
+ * Write the modified elements in elemTable to heap. If elemTable has been
+ * spilled, do it batch by batch. The final elements of each batch are saved
+ * to elemFinalFile so that the result of eager plan can be completed in the
+ * same single pass that returns it.
+ */
 static void
 reflectModifiedProp(ModifyGraphState *mgstate)
+{
+	int			batchno;
+
+	Assert(mgstate->elemTable != NULL);
+
+	/* loadElemBatch() moves the records, and nobody looks them up anymore */
+	if (mgstate->elemSpillIndex != NULL)
+	{
+		hash_destroy(mgstate->elemSpillIndex);
+		mgstate->elemSpillIndex = NULL;
+	}
+
+	for (batchno = 0; batchno < mgstate->nElemBatches; batchno++)
+	{
+		if (batchno > 0)
+			loadElemBatch(mgstate, batchno);
+
+		reflectElemTable(mgstate);
+
+		if (mgstate->nElemBatches > 1)
+		{
+			if (mgstate->eagerness)
+				saveFinalElems(mgstate);
+
+			clearElemTable(mgstate);
+		}
+	}
+}
+
+static void
+reflectElemTable(ModifyGraphState *mgstate)
 {
 	ModifyGraph	*plan = (ModifyGraph *) mgstate->ps.plan;
 	ExprContext *econtext = mgstate->ps.ps_ExprContext;
+	MemoryContext tmpcxt = NULL;
 	HASH_SEQ_STATUS	seq;
 	ModifiedElemEntry *entry;
 
-	Assert(mgstate->elemTable != NULL);
+	if (mgstate->eagerness)
+		tmpcxt = AllocSetContextCreate(CurrentMemoryContext,
+									   "ModifyGraph modified element",
+									   ALLOCSET_SMALL_SIZES);
 
 	hash_seq_init(&seq, mgstate->elemTable);
 	while ((entry = hash_seq_search(&seq)) != NULL)
@@ -1824,6 +2710,7 @@ reflectModifiedProp(ModifyGraphState *mgstate)
 			{
 				Datum		property;
 				Datum		newelem;
+				MemoryContext oldmctx;
 
 				if (entry->type == VERTEXOID)
 					property = getVertexPropDatum(entry->elem_datum);
@@ -1832,15 +2719,402 @@ reflectModifiedProp(ModifyGraphState *mgstate)
 				else
 					elog(ERROR, "unexpected graph type %d", entry->type);
 
+				/*
+				 * The datum of the formed tuple is not the start of a
+				 * palloc'd chunk, so keep a flat copy of it which can be
+				 * pfree'd by clearElemTable().
+				 */
+				oldmctx = MemoryContextSwitchTo(tmpcxt);
 				newelem = makeModifiedElem(econtext, entry->elem_datum,
 										   entry->type, gid, property,
 										   PointerGetDatum(ctid));
+				MemoryContextSwitchTo(
+						GetMemoryChunkContext(DatumGetPointer(entry->elem_datum)));
+				newelem = datumCopy(newelem, false, -1);
+				MemoryContextSwitchTo(oldmctx);
+				MemoryContextReset(tmpcxt);
 
 				pfree(DatumGetPointer(entry->elem_datum));
 				entry->elem_datum = newelem;
 			}
 		}
 	}
+
+	if (tmpcxt != NULL)
+		MemoryContextDelete(tmpcxt);
+}
+
+/*
+ * Move the final elements in elemTable to elemFinalFile. Only the position of
+ * each element is kept in memory.
+ */
+static void
+saveFinalElems(ModifyGraphState *mgstate)
+{
+	HASH_SEQ_STATUS	seq;
+	ModifiedElemEntry *entry;
+
+	if (mgstate->elemFinalIndex == NULL)
+	{
+		HASHCTL		ctl;
+
+		memset(&ctl, 0, sizeof(ctl));
+		ctl.keysize = sizeof(Graphid);
+		ctl.entrysize = sizeof(FinalElemEntry);
+		ctl.hcxt = mgstate->ps.state->es_query_cxt;
+
+		mgstate->elemFinalIndex =
+				hash_create("final object index", 1024, &ctl,
+							HASH_ELEM | HASH_BLOBS | HASH_CONTEXT);
+
+		mgstate->elemFinalFile = BufFileCreateTemp(false);
+	}
+
+	hash_seq_init(&seq, mgstate->elemTable);
+	while ((entry = hash_seq_search(&seq)) != NULL)
+	{
+		FinalElemEntry *fentry;
+		ElemBatchRecord rec;
+
+		fentry = hash_search(mgstate->elemFinalIndex, &entry->key, HASH_ENTER,
+							 NULL);
+		BufFileTell(mgstate->elemFinalFile, &fentry->fileno, &fentry->offset);
+
+		rec.key = entry->key;
+		rec.seqno = entry->seqno;
+		rec.type = entry->type;
+		rec.len = VARSIZE_ANY(DatumGetPointer(entry->elem_datum));
+
+		if (BufFileWrite(mgstate->elemFinalFile, &rec,
+						 sizeof(rec)) != sizeof(rec) ||
+			BufFileWrite(mgstate->elemFinalFile,
+						 DatumGetPointer(entry->elem_datum),
+						 rec.len) != rec.len)
+			ereport(ERROR,
+					(errcode_for_file_access(),
+					 errmsg("could not write to ModifyGraph temporary file: %m")));
+	}
+}
+
+/* find the final element of gid in elemTable or elemFinalFile */
+static bool
+findFinalElem(ModifyGraphState *mgstate, Graphid gid, Datum *elem)
+{
+	ModifiedElemEntry *entry;
+	FinalElemEntry *fentry;
+	ElemBatchRecord rec;
+	char	   *data;
+
+	entry = hash_search(mgstate->elemTable, &gid, HASH_FIND, NULL);
+	if (entry != NULL)
+	{
+		*elem = entry->elem_datum;
+		return true;
+	}
+
+	if (mgstate->elemFinalIndex == NULL)
+		return false;
+
+	fentry = hash_search(mgstate->elemFinalIndex, &gid, HASH_FIND, NULL);
+	if (fentry == NULL)
+		return false;
+
+	if (BufFileSeek(mgstate->elemFinalFile, fentry->fileno, fentry->offset,
+					SEEK_SET) != 0)
+		ereport(ERROR,
+				(errcode_for_file_access(),
+				 errmsg("could not seek in ModifyGraph temporary file: %m")));
+
+	if (BufFileRead(mgstate->elemFinalFile, &rec, sizeof(rec)) != sizeof(rec))
+		ereport(ERROR,
+				(errcode_for_file_access(),
+				 errmsg("could not read from ModifyGraph temporary file: %m")));
+	Assert(rec.key == gid);
+
+	data = palloc(rec.len);
+	if (BufFileRead(mgstate->elemFinalFile, data, rec.len) != rec.len)
+		ereport(ERROR,
+				(errcode_for_file_access(),
+				 errmsg("could not read from ModifyGraph temporary file: %m")));
+
+	*elem = PointerGetDatum(data);
+	return true;
+}
+
+static void
+clearElemTable(ModifyGraphState *mgstate)
+{
+	HASH_SEQ_STATUS	seq;
+	ModifiedElemEntry *entry;
+
+	hash_seq_init(&seq, mgstate->elemTable);
+	while ((entry = hash_seq_search(&seq)) != NULL)
+	{
+		pfree(DatumGetPointer(entry->elem_datum));
+		hash_search(mgstate->elemTable, &entry->key, HASH_REMOVE, NULL);
+	}
+
+	mgstate->elemTableSpace = 0;
+}
+
+/*
+ * elemTable is partitioned by Graphid like the hash table of hash join. Use
+ * the upper bits of the hash value because dynahash uses the lower ones.
+ */
+static int
+getElemBatchNo(ModifyGraphState *mgstate, Graphid gid)
+{
+	uint32		hashvalue;
+
+	if (mgstate->nElemBatches == 1)
+		return 0;
+
+	hashvalue = DatumGetUInt32(hash_any((unsigned char *) &gid,
+										sizeof(gid)));
+
+	return hashvalue >> (32 - my_log2(mgstate->nElemBatches));
+}
+
+/*
+ * Double the number of batches and move the entries of elemTable that no
+ * longer belong to batch 0 to their batch files. (see
+ * ExecHashIncreaseNumBatches())
+ *
+ * The position of the newest record of each spilled element is kept in
+ * elemSpillIndex so that SET can still see its newest value. (see
+ * findSpilledElem())
+ */
+static void
+spillElemTable(ModifyGraphState *mgstate)
+{
+	int			oldnbatch = mgstate->nElemBatches;
+	int			nbatch;
+	HASH_SEQ_STATUS	seq;
+	ModifiedElemEntry *entry;
+
+	if (oldnbatch >= MAX_ELEM_BATCHES)
+		ereport(ERROR,
+				(errcode(ERRCODE_PROGRAM_LIMIT_EXCEEDED),
+				 errmsg("too many modified graph elements to fit in %d batches",
+						MAX_ELEM_BATCHES),
+				 errhint("Consider increasing the configuration parameter \"eager_mem\".")));
+
+	nbatch = oldnbatch * 2;
+
+	if (mgstate->elemBatchFiles == NULL)
+	{
+		HASHCTL		ctl;
+
+		PrepareTempTablespaces();
+
+		memset(&ctl, 0, sizeof(ctl));
+		ctl.keysize = sizeof(Graphid);
+		ctl.entrysize = sizeof(SpilledElemEntry);
+		ctl.hcxt = mgstate->ps.state->es_query_cxt;
+
+		mgstate->elemSpillIndex =
+				hash_create("spilled object index", 1024, &ctl,
+							HASH_ELEM | HASH_BLOBS | HASH_CONTEXT);
+
+		mgstate->elemBatchFiles =
+			MemoryContextAllocZero(mgstate->ps.state->es_query_cxt,
+								   nbatch * sizeof(BufFile *));
+	}
+	else
+	{
+		mgstate->elemBatchFiles = repalloc(mgstate->elemBatchFiles,
+										   nbatch * sizeof(BufFile *));
+		MemSet(mgstate->elemBatchFiles + oldnbatch, 0,
+			   (nbatch - oldnbatch) * sizeof(BufFile *));
+	}
+
+	mgstate->nElemBatches = nbatch;
+
+	hash_seq_init(&seq, mgstate->elemTable);
+	while ((entry = hash_seq_search(&seq)) != NULL)
+	{
+		int			batchno = getElemBatchNo(mgstate, entry->key);
+
+		if (batchno == 0)
+			continue;
+
+		saveElemBatch(mgstate, batchno, entry->key,
+					  mgstate->elemBatchSeqno++, entry->type,
+					  entry->elem_datum);
+
+		mgstate->elemTableSpace -= ELEM_ENTRY_SPACE(entry->elem_datum);
+		pfree(DatumGetPointer(entry->elem_datum));
+		hash_search(mgstate->elemTable, &entry->key, HASH_REMOVE, NULL);
+	}
+}
+
+/* See ExecHashJoinSaveTuple() */
+static void
+saveElemBatch(ModifyGraphState *mgstate, int batchno, Graphid gid,
+			  uint64 seqno, Oid type, Datum elem_datum)
+{
+	BufFile    *file = mgstate->elemBatchFiles[batchno];
+	ElemBatchRecord rec;
+
+	if (file == NULL)
+	{
+		file = BufFileCreateTemp(false);
+		mgstate->elemBatchFiles[batchno] = file;
+	}
+
+	if (mgstate->elemSpillIndex != NULL)
+	{
+		SpilledElemEntry *sentry;
+
+		sentry = hash_search(mgstate->elemSpillIndex, &gid, HASH_ENTER, NULL);
+		sentry->batchno = batchno;
+		BufFileTell(file, &sentry->fileno, &sentry->offset);
+	}
+
+	rec.key = gid;
+	rec.seqno = seqno;
+	rec.type = type;
+	rec.len = VARSIZE_ANY(DatumGetPointer(elem_datum));
+
+	if (BufFileWrite(file, &rec, sizeof(rec)) != sizeof(rec) ||
+		BufFileWrite(file, DatumGetPointer(elem_datum),
+					 rec.len) != rec.len)
+		ereport(ERROR,
+				(errcode_for_file_access(),
+				 errmsg("could not write to ModifyGraph temporary file: %m")));
+}
+
+/*
+ * Load the entries in the batch file into the emptied elemTable. Entries that
+ * belong to a later batch, because the number of batches has been increased
+ * after they were written, are moved to the file of that batch. Moving changes
+ * the order of records in a file, so an element that has been SET multiple
+ * times is resolved by the sequence numbers of its records.
+ */
+static void
+loadElemBatch(ModifyGraphState *mgstate, int batchno)
+{
+	BufFile    *file = mgstate->elemBatchFiles[batchno];
+	ElemBatchRecord rec;
+	size_t		nread;
+
+	if (file == NULL)
+		return;
+
+	if (BufFileSeek(file, 0, 0L, SEEK_SET) != 0)
+		ereport(ERROR,
+				(errcode_for_file_access(),
+				 errmsg("could not rewind ModifyGraph temporary file: %m")));
+
+	for (;;)
+	{
+		char	   *elem;
+		int			newbatchno;
+		ModifiedElemEntry *entry;
+		bool		found;
+
+		nread = BufFileRead(file, &rec, sizeof(rec));
+		if (nread == 0)
+			break;
+		if (nread != sizeof(rec))
+			ereport(ERROR,
+					(errcode_for_file_access(),
+					 errmsg("could not read from ModifyGraph temporary file: %m")));
+
+		elem = palloc(rec.len);
+		if (BufFileRead(file, elem, rec.len) != rec.len)
+			ereport(ERROR,
+					(errcode_for_file_access(),
+					 errmsg("could not read from ModifyGraph temporary file: %m")));
+
+		newbatchno = getElemBatchNo(mgstate, rec.key);
+		if (newbatchno != batchno)
+		{
+			Assert(newbatchno > batchno);
+
+			saveElemBatch(mgstate, newbatchno, rec.key, rec.seqno, rec.type,
+						  PointerGetDatum(elem));
+			pfree(elem);
+			continue;
+		}
+
+		entry = hash_search(mgstate->elemTable, &rec.key, HASH_ENTER, &found);
+		if (found)
+		{
+			if (!enable_multiple_update)
+				ereport(ERROR,
+						(errcode(ERRCODE_INTERNAL_ERROR),
+						 errmsg("graph element(%hu," UINT64_FORMAT ") has been SET multiple times",
+								GraphidGetLabid(rec.key),
+								GraphidGetLocid(rec.key))));
+
+			if (entry->seqno > rec.seqno)
+			{
+				pfree(elem);
+				continue;
+			}
+
+			pfree(DatumGetPointer(entry->elem_datum));
+		}
+
+		entry->elem_datum = PointerGetDatum(elem);
+		entry->type = rec.type;
+		entry->seqno = rec.seqno;
+	}
+
+	BufFileClose(file);
+	mgstate->elemBatchFiles[batchno] = NULL;
+}
+
+/*
+ * Find the newest value of gid that has been spilled to a batch file. Records
+ * are only appended to the batch files while elements are SET, so go back to
+ * the end of the file after reading the record.
+ */
+static bool
+findSpilledElem(ModifyGraphState *mgstate, Graphid gid, Datum *elem)
+{
+	SpilledElemEntry *sentry;
+	BufFile    *file;
+	int			endfileno;
+	off_t		endoffset;
+	ElemBatchRecord rec;
+	char	   *data;
+
+	if (mgstate->elemSpillIndex == NULL)
+		return false;
+
+	sentry = hash_search(mgstate->elemSpillIndex, &gid, HASH_FIND, NULL);
+	if (sentry == NULL)
+		return false;
+
+	file = mgstate->elemBatchFiles[sentry->batchno];
+	BufFileTell(file, &endfileno, &endoffset);
+
+	if (BufFileSeek(file, sentry->fileno, sentry->offset, SEEK_SET) != 0)
+		ereport(ERROR,
+				(errcode_for_file_access(),
+				 errmsg("could not seek in ModifyGraph temporary file: %m")));
+
+	if (BufFileRead(file, &rec, sizeof(rec)) != sizeof(rec))
+		ereport(ERROR,
+				(errcode_for_file_access(),
+				 errmsg("could not read from ModifyGraph temporary file: %m")));
+	Assert(rec.key == gid);
+
+	data = palloc(rec.len);
+	if (BufFileRead(file, data, rec.len) != rec.len)
+		ereport(ERROR,
+				(errcode_for_file_access(),
+				 errmsg("could not read from ModifyGraph temporary file: %m")));
+
+	if (BufFileSeek(file, endfileno, endoffset, SEEK_SET) != 0)
+		ereport(ERROR,
+				(errcode_for_file_access(),
+				 errmsg("could not seek in ModifyGraph temporary file: %m")));
+
+	*elem = PointerGetDatum(data);
+	return true;
 }
 
 static ResultRelInfo *
@@ -1947,6 +3221,52 @@ setSlotValueByAttnum(TupleTableSlot *slot, Datum value, int attnum)
 	slot->tts_isnull[attnum - 1] = (value == (Datum) 0) ? true : false;
 }
 
+/*
+ * Fill the property columns of a label (see makePropColumnElements()) with
+ * the values of the corresponding keys in the property map at `propattnum`.
+ * The columns follow the columns of the base vertex/edge label.
+ */
+void
+setSlotPropColumns(TupleTableSlot *slot, int propattnum)
+{
+	TupleDesc	tupDesc = slot->tts_tupleDescriptor;
+	Jsonb	   *prop = NULL;
+	int			i;
+
+	for (i = propattnum; i < tupDesc->natts; i++)
+	{
+		Form_pg_attribute attr = tupDesc->attrs[i];
+		JsonbValue	vkey;
+		JsonbValue *v;
+
+		if (attr->attisdropped)
+		{
+			slot->tts_values[i] = (Datum) 0;
+			slot->tts_isnull[i] = true;
+			continue;
+		}
+
+		if (prop == NULL)
+			prop = DatumGetJsonb(slot->tts_values[propattnum - 1]);
+
+		vkey.type = jbvString;
+		vkey.val.string.val = NameStr(attr->attname);
+		vkey.val.string.len = strlen(vkey.val.string.val);
+
+		v = findJsonbValueFromContainer(&prop->root, JB_FOBJECT, &vkey);
+		if (v == NULL)
+		{
+			slot->tts_values[i] = (Datum) 0;
+			slot->tts_isnull[i] = true;
+		}
+		else
+		{
+			slot->tts_values[i] = JsonbGetDatum(JsonbValueToJsonb(v));
+			slot->tts_isnull[i] = false;
+		}
+	}
+}
+
 static Datum *
 makeDatumArray(ExprContext *econtext, int len)
 {
@@ -19,17 +19,24 @@
 
 #include "postgres.h"
 
+#include "ag_const.h"
+#include "access/heapam.h"
+#include "access/htup_details.h"
 #include "catalog/pg_type.h"
 #include "executor/execdebug.h"
 #include "executor/nodeNestloopVle.h"
 #include "fmgr.h"
 #include "miscadmin.h"
 #include "nodes/pg_list.h"
+#include "parser/parse_relation.h"
+#include "storage/bufmgr.h"
 #include "utils/array.h"
 #include "utils/datum.h"
 #include "utils/graph.h"
+#include "utils/hashutils.h"
 #include "utils/lsyscache.h"
 #include "utils/memutils.h"
+#include "utils/rel.h"
 
 
 #define OUTER_PREV_VARNO	0
@@ -40,7 +47,32 @@
 #define INNER_ID_VARNO		1
 #define INNER_EDGE_VARNO	2
 
+/*
+ * Graphid elements of VLEArrayExpr beyond the first VLEARRAY_LINEAR_MAX ones
+ * are also kept in a hash set, so that hasElem() doesn't have to scan the
+ * whole array for long paths.
+ */
+#define VLEARRAY_LINEAR_MAX	8
 
+typedef struct VLEIdEntry
+{
+	Graphid		id;
+	char		status;
+} VLEIdEntry;
+
+#define SH_PREFIX vleids
+#define SH_ELEMENT_TYPE VLEIdEntry
+#define SH_KEY_TYPE Graphid
+#define SH_KEY id
+#define SH_HASH_KEY(tb, key) murmurhash32((uint32) ((key) ^ ((key) >> 32)))
+#define SH_EQUAL(tb, a, b) ((a) == (b))
+#define SH_SCOPE static inline
+#define SH_DEFINE
+#define SH_DECLARE
+#include "lib/simplehash.h"
+
+
+static TraversalDepthStats *getDepthStats(NestLoopVLEState *node);
 static bool incrDepth(NestLoopVLEState *node);
 static bool decrDepth(NestLoopVLEState *node);
 static bool isMaxDepth(NestLoopVLEState *node);
@@ -54,6 +86,10 @@ static void storeStartAndBindVar(NestLoopVLEState *node,
 static void clearVleCtxs(dlist_head *vleCtxs);
 static void copyStartAndBindVar(TupleTableSlot *dst, TupleTableSlot *src);
 static void replaceResult(NestLoopVLEState *node, TupleTableSlot *slot);
+static TupleTableSlot *replaceOuterResult(NestLoopVLEState *node,
+										  TupleTableSlot *outerTupleSlot);
+static void fillEdges(NestLoopVLEState *node);
+static Relation getEdgeRel(NestLoopVLEState *node, uint16 labid);
 static void initArray(VLEArrayExpr *array, Oid typid, ExprContext *econtext);
 static Datum evalArray(VLEArrayExpr *array);
 static void clearArray(VLEArrayExpr *array);
@@ -79,6 +115,7 @@ ExecNestLoopVLE(PlanState *pstate)
 	ExprState  *otherqual;
 	ExprContext *econtext;
 	TupleTableSlot *result;
+	TraversalDepthStats *stats;
 
 	CHECK_FOR_INTERRUPTS();
 
@@ -143,7 +180,7 @@ ExecNestLoopVLE(PlanState *pstate)
 
 			/* in the case that minHops is 0 or 1 (starting point) */
 			if (!node->selfLoop && (node->curhops >= nlv->minHops))
-				result = outerTupleSlot;
+				result = replaceOuterResult(node, outerTupleSlot);
 
 			if (incrDepth(node))
 			{
@@ -151,6 +188,10 @@ ExecNestLoopVLE(PlanState *pstate)
 
 				bindNestParam(nlv, econtext, outerTupleSlot, innerPlan);
 
+				stats = getDepthStats(node);
+				if (stats != NULL)
+					stats->rescans++;
+
 				/*
 				 * now rescan the inner plan
 				 */
@@ -164,6 +205,14 @@ ExecNestLoopVLE(PlanState *pstate)
 				ExecReScan(innerPlan);
 				node->nls.js.ps.state->es_forceReScan = false;
 			}
+			else if (!node->selfLoop)
+			{
+				/*
+				 * the path of the outer tuple cannot be extended, so the next
+				 * outer tuple starts a new one
+				 */
+				popRowidAndGid(node);
+			}
 
 			if (result != NULL)
 				return result;
@@ -202,6 +251,10 @@ ExecNestLoopVLE(PlanState *pstate)
 
 		econtext->ecxt_innertuple = innerTupleSlot;
 
+		stats = getDepthStats(node);
+		if (stats != NULL)
+			stats->edges++;
+
 		/*
 		 * at this point we have a new pair of inner and outer tuples so we
 		 * test the inner and outer tuples to see if they satisfy the node's
@@ -223,6 +276,9 @@ ExecNestLoopVLE(PlanState *pstate)
 				 */
 				ENLV1_printf("qualification succeeded, projecting tuple");
 
+				if (stats != NULL)
+					stats->frontier++;
+
 				/* store current context before modifying outertuple */
 				if (!isMaxDepth(node))
 					storeStartAndBindVar(node, econtext->ecxt_outertuple);
@@ -263,6 +319,9 @@ ExecNestLoopVLE(PlanState *pstate)
 		else
 		{
 			InstrCountFiltered1(node, 1);
+
+			if (stats != NULL)
+				stats->rejected++;
 		}
 
 		/*
@@ -348,6 +407,11 @@ ExecInitNestLoopVLE(NestLoopVLE *node, EState *estate, int eflags)
 
 	nlvstate->selfLoop = false;
 	nlvstate->curhops = (node->minHops == 0) ? 0 : 1;
+	nlvstate->edgeRels = NIL;
+
+	nlvstate->depthStats = NULL;
+	nlvstate->ndepthStats = 0;
+	nlvstate->maxPathLen = 0;
 
 	innerTupleDesc =
 			innerPlanState(nlvstate)->ps_ResultTupleSlot->tts_tupleDescriptor;
@@ -385,6 +449,8 @@ ExecInitNestLoopVLE(NestLoopVLE *node, EState *estate, int eflags)
 void
 ExecEndNestLoopVLE(NestLoopVLEState *node)
 {
+	ListCell   *lc;
+
 	NLV1_printf("ExecEndNestLoopVLE: %s\n", "ending node processing");
 
 	/*
@@ -402,6 +468,9 @@ ExecEndNestLoopVLE(NestLoopVLEState *node)
 	if (node->hasPath)
 		clearArray(&node->edges);
 
+	foreach(lc, node->edgeRels)
+		heap_close((Relation) lfirst(lc), AccessShareLock);
+
 	/*
 	 * close down subplans
 	 */
@@ -449,6 +518,17 @@ ExecReScanNestLoopVLE(NestLoopVLEState *node)
 		clearArray(&node->edges);
 }
 
+/* statistics of the current depth if it's EXPLAIN ANALYZE */
+static TraversalDepthStats *
+getDepthStats(NestLoopVLEState *node)
+{
+	if (node->nls.js.ps.instrument == NULL)
+		return NULL;
+
+	return InstrDepthStats(&node->depthStats, &node->ndepthStats,
+						   node->curhops, node->nls.js.ps.state->es_query_cxt);
+}
+
 static bool
 incrDepth(NestLoopVLEState *node)
 {
@@ -597,16 +677,190 @@ copyStartAndBindVar(TupleTableSlot *dst, TupleTableSlot *src)
 	ExecStoreVirtualTuple(dst);
 }
 
+/*
+ * The arrays are built only if the upper query reads them.  `ids` and
+ * `edges` themselves are stacks that share the prefix of the current path
+ * with every path that extends it.
+ */
 static void
 replaceResult(NestLoopVLEState *node, TupleTableSlot *slot)
 {
-	slot->tts_values[OUTER_IDS_VARNO] = evalArray(&node->ids);
-	slot->tts_isnull[OUTER_IDS_VARNO] = false;
+	NestLoopVLE *nlv = (NestLoopVLE *) node->nls.js.ps.plan;
+
+	if (nlv->skipIds)
+	{
+		slot->tts_values[OUTER_IDS_VARNO] = (Datum) 0;
+		slot->tts_isnull[OUTER_IDS_VARNO] = true;
+	}
+	else
+	{
+		slot->tts_values[OUTER_IDS_VARNO] = evalArray(&node->ids);
+		slot->tts_isnull[OUTER_IDS_VARNO] = false;
+	}
 	if (node->hasPath)
 	{
-		slot->tts_values[OUTER_EDGES_VARNO] = evalArray(&node->edges);
-		slot->tts_isnull[OUTER_EDGES_VARNO] = false;
+		if (nlv->skipEdges)
+		{
+			slot->tts_values[OUTER_EDGES_VARNO] = (Datum) 0;
+			slot->tts_isnull[OUTER_EDGES_VARNO] = true;
+		}
+		else
+		{
+			fillEdges(node);
+			slot->tts_values[OUTER_EDGES_VARNO] = evalArray(&node->edges);
+			slot->tts_isnull[OUTER_EDGES_VARNO] = false;
+		}
+	}
+}
+
+/*
+ * The outer tuple is returned as is for the starting point, but the edge in
+ * it is compact.  Return a copy of it that has the filled edge instead.
+ */
+static TupleTableSlot *
+replaceOuterResult(NestLoopVLEState *node, TupleTableSlot *outerTupleSlot)
+{
+	NestLoopVLE *nlv = (NestLoopVLE *) node->nls.js.ps.plan;
+	TupleTableSlot *slot = node->nls.js.ps.ps_ResultTupleSlot;
+	int			natts;
+	int			i;
+
+	if (!node->hasPath || nlv->skipEdges || node->edges.nelems == 0)
+		return outerTupleSlot;
+
+	slot_getallattrs(outerTupleSlot);
+	natts = outerTupleSlot->tts_tupleDescriptor->natts;
+	Assert(natts <= slot->tts_tupleDescriptor->natts);
+
+	ExecClearTuple(slot);
+	for (i = 0; i < slot->tts_tupleDescriptor->natts; i++)
+	{
+		if (i < natts)
+		{
+			slot->tts_values[i] = outerTupleSlot->tts_values[i];
+			slot->tts_isnull[i] = outerTupleSlot->tts_isnull[i];
+		}
+		else
+		{
+			slot->tts_values[i] = (Datum) 0;
+			slot->tts_isnull[i] = true;
+		}
 	}
+
+	fillEdges(node);
+	slot->tts_values[OUTER_EDGES_VARNO] = evalArray(&node->edges);
+	slot->tts_isnull[OUTER_EDGES_VARNO] = false;
+
+	return ExecStoreVirtualTuple(slot);
+}
+
+/*
+ * Edges from the subplans are compact; their property maps are NULL so that
+ * the maps are not carried through every hop.  Fetch the property map of
+ * each compact edge on the stack by its ctid, with the snapshot of the scan
+ * that found the edge, and replace the edge with the full one.  Paths that
+ * share the edge then don't have to fetch it again.
+ */
+static void
+fillEdges(NestLoopVLEState *node)
+{
+	EState	   *estate = node->nls.js.ps.state;
+	VLEArrayExpr *edges = &node->edges;
+	MemoryContext arraymcxt = GetMemoryChunkContext(edges->elements);
+	MemoryContext oldmcxt;
+	int			i;
+
+	/* the full edges are built in the per-tuple context and copied */
+	oldmcxt = MemoryContextSwitchTo(
+					node->nls.js.ps.ps_ExprContext->ecxt_per_tuple_memory);
+
+	for (i = edges->nelems - 1; i >= 0; i--)
+	{
+		Datum		edge = edges->elements[i];
+		HeapTupleHeader tuphdr = DatumGetHeapTupleHeader(edge);
+		HeapTupleData tmptup;
+		Datum		id;
+		Relation	rel;
+		HeapTupleData tuple;
+		Buffer		buffer;
+		Datum		prop_map;
+		bool		isnull;
+		Datum		full;
+
+		tmptup.t_len = HeapTupleHeaderGetDatumLength(tuphdr);
+		ItemPointerSetInvalid(&tmptup.t_self);
+		tmptup.t_tableOid = InvalidOid;
+		tmptup.t_data = tuphdr;
+
+		/* the edges below a filled one have been filled already */
+		if (!heap_attisnull(&tmptup, Anum_edge_properties))
+			break;
+
+		id = getEdgeIdDatum(edge);
+		rel = getEdgeRel(node, GraphidGetLabid(DatumGetGraphid(id)));
+
+		tuple.t_self = *((ItemPointer) DatumGetPointer(getEdgeTidDatum(edge)));
+		if (!heap_fetch(rel, estate->es_snapshot, &tuple, &buffer, false,
+						NULL))
+			elog(ERROR, "could not fetch edge %hu." UINT64_FORMAT,
+				 GraphidGetLabid(DatumGetGraphid(id)),
+				 GraphidGetLocid(DatumGetGraphid(id)));
+
+		prop_map = heap_getattr(&tuple,
+								attnameAttNum(rel, AG_ELEM_PROP_MAP, false),
+								RelationGetDescr(rel), &isnull);
+		Assert(!isnull);
+		prop_map = PointerGetDatum(PG_DETOAST_DATUM_COPY(prop_map));
+
+		ReleaseBuffer(buffer);
+
+		/*
+		 * The datum of the formed tuple is not the start of a palloc'd chunk,
+		 * so it cannot be pfree'd by popElem().  Store a flat copy instead.
+		 */
+		full = makeGraphEdgeDatum(id, getEdgeStartDatum(edge),
+								  getEdgeEndDatum(edge), prop_map,
+								  getEdgeTidDatum(edge));
+
+		MemoryContextSwitchTo(arraymcxt);
+		edges->elements[i] = datumCopy(full, false, -1);
+		MemoryContextSwitchTo(
+					node->nls.js.ps.ps_ExprContext->ecxt_per_tuple_memory);
+
+		pfree(DatumGetPointer(edge));
+	}
+
+	MemoryContextSwitchTo(oldmcxt);
+}
+
+/* the scan of the edges has locked the label already */
+static Relation
+getEdgeRel(NestLoopVLEState *node, uint16 labid)
+{
+	NestLoopVLE *nlv = (NestLoopVLE *) node->nls.js.ps.plan;
+	Oid			relid;
+	ListCell   *lc;
+	Relation	rel;
+	MemoryContext oldmcxt;
+
+	relid = get_labid_relid(nlv->graphOid, labid);
+	if (!OidIsValid(relid))
+		elog(ERROR, "cache lookup failed for label %hu", labid);
+
+	foreach(lc, node->edgeRels)
+	{
+		rel = (Relation) lfirst(lc);
+		if (RelationGetRelid(rel) == relid)
+			return rel;
+	}
+
+	rel = heap_open(relid, AccessShareLock);
+
+	oldmcxt = MemoryContextSwitchTo(node->nls.js.ps.state->es_query_cxt);
+	node->edgeRels = lappend(node->edgeRels, rel);
+	MemoryContextSwitchTo(oldmcxt);
+
+	return rel;
 }
 
 #define VLEARRAY_INIT_SIZE 10
@@ -623,6 +877,7 @@ initArray(VLEArrayExpr *array, Oid typid, ExprContext *econtext)
 	array->telems = VLEARRAY_INIT_SIZE;
 	array->elements = palloc(sizeof(Datum) * array->telems);
 	array->nelems = 0;
+	array->elemset = NULL;
 	array->econtext = econtext;
 }
 
@@ -630,11 +885,6 @@ static Datum
 evalArray(VLEArrayExpr *array)
 {
 	MemoryContext oldContext;
-	Datum	   *values;
-	bool	   *nulls;
-	int			i;
-	int			dims[1];
-	int			lbs[1];
 	ArrayType  *result;
 
 	if (array->nelems == 0)
@@ -642,22 +892,12 @@ evalArray(VLEArrayExpr *array)
 
 	oldContext = MemoryContextSwitchTo(array->econtext->ecxt_per_tuple_memory);
 
-	values = palloc(array->nelems * sizeof(*values));
-	nulls = palloc(array->nelems * sizeof(*nulls));
-	for (i = 0; i < array->nelems; i++)
-	{
-		values[i] = array->elements[i];
-		nulls[i] = false;
-	}
-
-	dims[0] = array->nelems;
-	lbs[0] = 1;
-
-	result = construct_md_array(values, nulls, 1, dims, lbs,
-								array->element_typeid,
-								array->elemlength,
-								array->elembyval,
-								array->elemalign);
+	/* the elements are never NULL, so they can be copied in place */
+	result = construct_array(array->elements, array->nelems,
+							 array->element_typeid,
+							 array->elemlength,
+							 array->elembyval,
+							 array->elemalign);
 
 	MemoryContextSwitchTo(oldContext);
 
@@ -667,10 +907,17 @@ evalArray(VLEArrayExpr *array)
 static void
 clearArray(VLEArrayExpr *array)
 {
-	if (!array->elembyval)
+	int			i;
+
+	if (array->elemset != NULL)
 	{
-		int i;
+		for (i = VLEARRAY_LINEAR_MAX; i < array->nelems; i++)
+			vleids_delete(array->elemset,
+						  DatumGetGraphid(array->elements[i]));
+	}
 
+	if (!array->elembyval)
+	{
 		for (i = 0; i < array->nelems; i++)
 			pfree(DatumGetPointer(array->elements[i]));
 	}
@@ -688,6 +935,21 @@ addElem(VLEArrayExpr *array, Datum elem)
 								   sizeof(Datum) * array->telems);
 	}
 
+	if (array->element_typeid == GRAPHIDOID &&
+		array->nelems >= VLEARRAY_LINEAR_MAX)
+	{
+		bool		found;
+
+		if (array->elemset == NULL)
+		{
+			MemoryContext mcxt = GetMemoryChunkContext(array->elements);
+
+			array->elemset = vleids_create(mcxt, VLEARRAY_INIT_SIZE, NULL);
+		}
+
+		vleids_insert(array->elemset, DatumGetGraphid(elem), &found);
+	}
+
 	array->elements[array->nelems++] = elem;
 }
 
@@ -697,6 +959,9 @@ popElem(VLEArrayExpr *array)
 	if (array->nelems > 0)
 	{
 		array->nelems--;
+		if (array->elemset != NULL && array->nelems >= VLEARRAY_LINEAR_MAX)
+			vleids_delete(array->elemset,
+						  DatumGetGraphid(array->elements[array->nelems]));
 		if (!array->elembyval)
 			pfree(DatumGetPointer(array->elements[array->nelems]));
 	}
@@ -705,15 +970,22 @@ popElem(VLEArrayExpr *array)
 static bool
 hasElem(VLEArrayExpr *array, Datum elem)
 {
-	int i;
+	Graphid		id = DatumGetGraphid(elem);
+	int			nlinear;
+	int			i;
+
+	Assert(array->element_typeid == GRAPHIDOID);
 
-	for (i = 0; i < array->nelems; i++)
+	nlinear = Min(array->nelems, VLEARRAY_LINEAR_MAX);
+	for (i = 0; i < nlinear; i++)
 	{
-		if (DatumGetBool(DirectFunctionCall2(graphid_eq,
-											 array->elements[i], elem)))
+		if (DatumGetGraphid(array->elements[i]) == id)
 			return true;
 	}
 
+	if (array->nelems > VLEARRAY_LINEAR_MAX)
+		return (vleids_lookup(array->elemset, id) != NULL);
+
 	return false;
 }
 
@@ -760,6 +1032,8 @@ addIdAndEdge(NestLoopVLEState *node, Datum id, Datum edge)
 {
 	addElem(&node->ids, datumCopy(id, node->ids.elembyval,
 								  node->ids.elemlength));
+	if (node->ids.nelems > node->maxPathLen)
+		node->maxPathLen = node->ids.nelems;
 	if (edge != (Datum) 0)
 		addElem(&node->edges, datumCopy(edge, node->edges.elembyval,
 										node->edges.elemlength));
@@ -0,0 +1,673 @@
+/*
+ * nodeShortestpath.c
+ *	  routines to support finding the shortest paths between two nodes in
+ *	  unweighted graph using bidirectional breadth-first search
+ *
+ * Portions Copyright (c) 2017, Bitnine Inc.
+ * Portions Copyright (c) 1996-2016, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ * IDENTIFICATION
+ *	  src/backend/executor/nodeShortestpath.c
+ */
+
+/*
+ *	 INTERFACE ROUTINES
+ *		ExecShortestpath	 	- execute bidirectional breadth-first search
+ *		ExecInitShortestpath 	- initialize
+ *		ExecEndShortestpath 	- shut down
+ *
+ * The subplan returns (next vertex, edge) pairs for the edges adjacent to a
+ * vertex. It is parameterized by two PARAM_EXEC params; the one for the
+ * source is used to expand forward and the one for the target is used to
+ * expand backward. Only one of them is set at a time and the other one is
+ * set to NULL so that the subplan returns the edges of one direction only.
+ *
+ * Each search keeps its visited nodes in a hash table. Every visited node
+ * remembers the edges through which it was reached first (all of them for
+ * allshortestpaths()), so a path is built only once, where the two searches
+ * meet.
+ */
+
+#include "postgres.h"
+
+#include "catalog/pg_type.h"
+#include "executor/executor.h"
+#include "executor/nodeShortestpath.h"
+#include "miscadmin.h"
+#include "nodes/execnodes.h"
+#include "utils/array.h"
+#include "utils/graph.h"
+#include "utils/lsyscache.h"
+#include "utils/memutils.h"
+
+typedef struct spnode
+{
+	Graphid		id;					/* hash key */
+	int			hops;				/* distance from the root of the search */
+	List	   *links;				/* list of splink's toward the root */
+} spnode;
+
+typedef struct splink
+{
+	Graphid		eid;
+	spnode	   *next;
+} splink;
+
+/* an edge between a node of each search */
+typedef struct spmeet
+{
+	spnode	   *fwd;
+	Graphid		eid;
+	spnode	   *bwd;				/* NULL if the source is the target */
+} spmeet;
+
+/* one of the paths from a node to the root of the search */
+typedef struct spchain
+{
+	int			len;
+	spnode	  **nodes;				/* nodes[len - 1] is the root */
+	ListCell  **links;				/* links[i] connects nodes[i] and i + 1 */
+} spchain;
+
+static HTAB *
+create_visited(ShortestpathState *node, const char *tabname)
+{
+	HASHCTL		hash_ctl;
+
+	hash_ctl.keysize = sizeof(Graphid);
+	hash_ctl.entrysize = sizeof(spnode);
+	hash_ctl.hcxt = node->sp_mcxt;
+
+	return hash_create(tabname, 1024, &hash_ctl,
+					   HASH_ELEM | HASH_BLOBS | HASH_CONTEXT);
+}
+
+static spnode *
+add_root(HTAB *visited, Graphid id)
+{
+	spnode	   *root;
+
+	root = (spnode *) hash_search(visited, &id, HASH_ENTER, NULL);
+	root->hops = 0;
+	root->links = NIL;
+
+	return root;
+}
+
+static void
+add_meet(ShortestpathState *node, spnode *fwd, Graphid eid, spnode *bwd)
+{
+	spmeet	   *meet;
+
+	meet = palloc(sizeof(*meet));
+	meet->fwd = fwd;
+	meet->eid = eid;
+	meet->bwd = bwd;
+
+	node->meets = lappend(node->meets, meet);
+}
+
+static void
+set_param(ExprContext *econtext, int paramno, Graphid id, bool isnull)
+{
+	ParamExecData *prm = &(econtext->ecxt_param_exec_vals[paramno]);
+
+	prm->value = isnull ? (Datum) 0 : GraphidGetDatum(id);
+	prm->isnull = isnull;
+}
+
+static int
+get_paramno(ExprState *expr)
+{
+	Param	   *param = (Param *) expr->expr;
+
+	if (!IsA(param, Param) || param->paramkind != PARAM_EXEC)
+		elog(ERROR, "source and target of shortestpath must be parameters");
+
+	return param->paramid;
+}
+
+/*
+ * Expand the frontier of one of the searches by one hop. Returns true if the
+ * two searches meet.
+ */
+static bool
+expand_frontier(ShortestpathState *node, bool forward)
+{
+	Shortestpath *plan = (Shortestpath *) node->ps.plan;
+	PlanState  *outerPlan = outerPlanState(node);
+	ExprContext *econtext = node->ps.ps_ExprContext;
+	HTAB	   *visited;
+	HTAB	   *other;
+	List	   *frontier;
+	List	   *next_frontier = NIL;
+	int			hops;
+	int			paramno;
+	int			other_paramno;
+	TraversalDepthStats *stats = NULL;
+	ListCell   *lc;
+	MemoryContext oldmctx;
+
+	if (forward)
+	{
+		visited = node->fwd_visited;
+		other = node->bwd_visited;
+		frontier = node->fwd_frontier;
+		hops = ++node->fwd_hops;
+		paramno = get_paramno(node->source);
+		other_paramno = get_paramno(node->target);
+
+		if (node->ps.instrument != NULL)
+			stats = InstrDepthStats(&node->fwd_stats, &node->fwd_nstats, hops,
+									node->ps.state->es_query_cxt);
+	}
+	else
+	{
+		visited = node->bwd_visited;
+		other = node->fwd_visited;
+		frontier = node->bwd_frontier;
+		hops = ++node->bwd_hops;
+		paramno = get_paramno(node->target);
+		other_paramno = get_paramno(node->source);
+
+		if (node->ps.instrument != NULL)
+			stats = InstrDepthStats(&node->bwd_stats, &node->bwd_nstats, hops,
+									node->ps.state->es_query_cxt);
+	}
+
+	set_param(econtext, other_paramno, 0, true);
+
+	oldmctx = MemoryContextSwitchTo(node->sp_mcxt);
+
+	foreach(lc, frontier)
+	{
+		spnode	   *vertex = lfirst(lc);
+
+		CHECK_FOR_INTERRUPTS();
+
+		set_param(econtext, paramno, vertex->id, false);
+		outerPlan->chgParam = bms_add_member(outerPlan->chgParam, paramno);
+		outerPlan->chgParam = bms_add_member(outerPlan->chgParam,
+											 other_paramno);
+
+		/*
+		 * sp_mcxt is reset on rescan, so the subplan must not allocate its
+		 * own state (e.g. a heap scan started lazily) there.
+		 */
+		MemoryContextSwitchTo(oldmctx);
+		ExecReScan(outerPlan);
+		MemoryContextSwitchTo(node->sp_mcxt);
+
+		if (stats != NULL)
+			stats->rescans++;
+
+		for (;;)
+		{
+			TupleTableSlot *slot;
+			Datum		datum;
+			bool		isnull;
+			Graphid		next_id;
+			Graphid		eid;
+			spnode	   *neighbor;
+			spnode	   *meet;
+			bool		found;
+
+			MemoryContextSwitchTo(oldmctx);
+			slot = ExecProcNode(outerPlan);
+			MemoryContextSwitchTo(node->sp_mcxt);
+			if (TupIsNull(slot))
+				break;
+
+			if (stats != NULL)
+				stats->edges++;
+
+			datum = slot_getattr(slot, plan->end_id, &isnull);
+			if (isnull)
+				continue;
+			next_id = DatumGetGraphid(datum);
+			datum = slot_getattr(slot, plan->edge_id, &isnull);
+			eid = DatumGetGraphid(datum);
+
+			neighbor = (spnode *) hash_search(visited, &next_id, HASH_ENTER,
+											  &found);
+			if (!found)
+			{
+				neighbor->hops = hops;
+				neighbor->links = NIL;
+				next_frontier = lappend(next_frontier, neighbor);
+
+				if (stats != NULL)
+					stats->frontier++;
+			}
+			else if (neighbor->hops != hops || !plan->all_paths)
+			{
+				/* `neighbor` is already reached through a shorter path */
+				if (stats != NULL)
+					stats->rejected++;
+				continue;
+			}
+
+			if (neighbor->links == NIL || plan->all_paths)
+			{
+				splink	   *link = palloc(sizeof(*link));
+
+				link->eid = eid;
+				link->next = vertex;
+				neighbor->links = lappend(neighbor->links, link);
+			}
+
+			meet = (spnode *) hash_search(other, &next_id, HASH_FIND, NULL);
+			if (meet == NULL)
+				continue;
+
+			if (forward)
+				add_meet(node, vertex, eid, meet);
+			else
+				add_meet(node, meet, eid, vertex);
+
+			if (!plan->all_paths)
+			{
+				MemoryContextSwitchTo(oldmctx);
+				return true;
+			}
+		}
+	}
+
+	MemoryContextSwitchTo(oldmctx);
+
+	list_free(frontier);
+	if (forward)
+		node->fwd_frontier = next_frontier;
+	else
+		node->bwd_frontier = next_frontier;
+
+	return (node->meets != NIL);
+}
+
+/*
+ * Find the meets of the two searches. Since every meet found while expanding
+ * a level has the same length, all the shortest paths go through the meets
+ * found at the first level where the searches meet.
+ */
+static void
+search(ShortestpathState *node)
+{
+	Shortestpath *plan = (Shortestpath *) node->ps.plan;
+	ExprContext *econtext = node->ps.ps_ExprContext;
+	Datum		source;
+	Datum		target;
+	bool		source_isnull;
+	bool		target_isnull;
+	int			source_paramno;
+	int			target_paramno;
+	ParamExecData saved_source;
+	ParamExecData saved_target;
+	spnode	   *source_node;
+	spnode	   *target_node;
+	MemoryContext oldmctx;
+
+	source = ExecEvalExpr(node->source, econtext, &source_isnull);
+	target = ExecEvalExpr(node->target, econtext, &target_isnull);
+	if (source_isnull || target_isnull)
+		return;
+
+	oldmctx = MemoryContextSwitchTo(node->sp_mcxt);
+
+	node->fwd_visited = create_visited(node, "shortestpath forward nodes");
+	node->bwd_visited = create_visited(node, "shortestpath backward nodes");
+
+	source_node = add_root(node->fwd_visited, DatumGetGraphid(source));
+	target_node = add_root(node->bwd_visited, DatumGetGraphid(target));
+
+	if (source_node->id == target_node->id)
+	{
+		/* paths must not have the same vertex twice */
+		if (plan->min_hops == 0)
+			add_meet(node, source_node, 0, NULL);
+
+		MemoryContextSwitchTo(oldmctx);
+		return;
+	}
+
+	node->fwd_frontier = list_make1(source_node);
+	node->bwd_frontier = list_make1(target_node);
+	node->fwd_hops = 0;
+	node->bwd_hops = 0;
+
+	MemoryContextSwitchTo(oldmctx);
+
+	/* the params are also used by the others, restore them after search */
+	source_paramno = get_paramno(node->source);
+	target_paramno = get_paramno(node->target);
+	saved_source = econtext->ecxt_param_exec_vals[source_paramno];
+	saved_target = econtext->ecxt_param_exec_vals[target_paramno];
+
+	for (;;)
+	{
+		bool		forward;
+
+		if (node->fwd_frontier == NIL || node->bwd_frontier == NIL)
+			break;
+		if (plan->max_hops >= 0 &&
+			node->fwd_hops + node->bwd_hops >= plan->max_hops)
+			break;
+
+		/* expand the smaller frontier */
+		forward = (list_length(node->fwd_frontier) <=
+				   list_length(node->bwd_frontier));
+		if (expand_frontier(node, forward))
+			break;
+	}
+
+	econtext->ecxt_param_exec_vals[source_paramno] = saved_source;
+	econtext->ecxt_param_exec_vals[target_paramno] = saved_target;
+}
+
+static void
+chain_fill(spchain *chain, int from)
+{
+	int			i;
+
+	for (i = from; i < chain->len; i++)
+	{
+		splink	   *link = lfirst(chain->links[i - 1]);
+
+		chain->nodes[i] = link->next;
+		if (i < chain->len - 1)
+			chain->links[i] = list_head(chain->nodes[i]->links);
+	}
+}
+
+static spchain *
+chain_init(spchain *chain, spnode *start)
+{
+	if (chain == NULL)
+		chain = palloc0(sizeof(*chain));
+
+	if (chain->len < start->hops + 1)
+	{
+		if (chain->nodes != NULL)
+		{
+			pfree(chain->nodes);
+			pfree(chain->links);
+		}
+		chain->nodes = palloc((start->hops + 1) * sizeof(spnode *));
+		chain->links = palloc((start->hops + 1) * sizeof(ListCell *));
+	}
+	chain->len = start->hops + 1;
+
+	chain->nodes[0] = start;
+	if (chain->len > 1)
+	{
+		chain->links[0] = list_head(start->links);
+		chain_fill(chain, 1);
+	}
+
+	return chain;
+}
+
+/* advance to the next path, returns false if there are no more paths */
+static bool
+chain_next(spchain *chain)
+{
+	int			i;
+
+	for (i = chain->len - 2; i >= 0; i--)
+	{
+		ListCell   *next = lnext(chain->links[i]);
+
+		if (next != NULL)
+		{
+			chain->links[i] = next;
+			chain_fill(chain, i + 1);
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static void
+init_meet(ShortestpathState *node)
+{
+	spmeet	   *meet = lfirst(node->curr_meet);
+	MemoryContext oldmctx = MemoryContextSwitchTo(node->sp_mcxt);
+
+	node->fwd_chain = chain_init(node->fwd_chain, meet->fwd);
+	if (meet->bwd != NULL)
+		node->bwd_chain = chain_init(node->bwd_chain, meet->bwd);
+
+	MemoryContextSwitchTo(oldmctx);
+}
+
+/* move to the next path, returns false if there are no more paths */
+static bool
+next_path(ShortestpathState *node)
+{
+	spmeet	   *meet = lfirst(node->curr_meet);
+
+	if (meet->bwd != NULL && chain_next(node->bwd_chain))
+		return true;
+
+	if (chain_next(node->fwd_chain))
+	{
+		if (meet->bwd != NULL)
+			chain_init(node->bwd_chain, meet->bwd);
+		return true;
+	}
+
+	node->curr_meet = lnext(node->curr_meet);
+	if (node->curr_meet == NULL)
+		return false;
+
+	init_meet(node);
+	return true;
+}
+
+static TupleTableSlot *
+proj_path(ShortestpathState *node)
+{
+	ExprContext *econtext = node->ps.ps_ExprContext;
+	TupleTableSlot *slot = node->ps.ps_ResultTupleSlot;
+	spmeet	   *meet = lfirst(node->curr_meet);
+	spchain    *fwd = node->fwd_chain;
+	spchain    *bwd = node->bwd_chain;
+	int			nvertices;
+	Datum	   *vids;
+	Datum	   *eids;
+	int			nv = 0;
+	int			ne = 0;
+	int			i;
+	MemoryContext oldmctx;
+
+	oldmctx = MemoryContextSwitchTo(econtext->ecxt_per_tuple_memory);
+
+	nvertices = fwd->len + (meet->bwd != NULL ? bwd->len : 0);
+	vids = palloc(nvertices * sizeof(Datum));
+	eids = palloc(nvertices * sizeof(Datum));
+
+	/* from the source to the meet */
+	for (i = fwd->len - 1; i >= 0; i--)
+	{
+		vids[nv++] = GraphidGetDatum(fwd->nodes[i]->id);
+		if (i > 0)
+		{
+			splink	   *link = lfirst(fwd->links[i - 1]);
+
+			eids[ne++] = GraphidGetDatum(link->eid);
+		}
+	}
+
+	/* from the meet to the target */
+	if (meet->bwd != NULL)
+	{
+		eids[ne++] = GraphidGetDatum(meet->eid);
+		for (i = 0; i < bwd->len; i++)
+		{
+			vids[nv++] = GraphidGetDatum(bwd->nodes[i]->id);
+			if (i < bwd->len - 1)
+			{
+				splink	   *link = lfirst(bwd->links[i]);
+
+				eids[ne++] = GraphidGetDatum(link->eid);
+			}
+		}
+	}
+
+	ExecClearTuple(slot);
+	slot->tts_values[0] = PointerGetDatum(construct_array(vids, nv,
+														  GRAPHIDOID,
+														  node->elemlength,
+														  node->elembyval,
+														  node->elemalign));
+	slot->tts_isnull[0] = false;
+	slot->tts_values[1] = PointerGetDatum(construct_array(eids, ne,
+														  GRAPHIDOID,
+														  node->elemlength,
+														  node->elembyval,
+														  node->elemalign));
+	slot->tts_isnull[1] = false;
+
+	MemoryContextSwitchTo(oldmctx);
+
+	return ExecStoreVirtualTuple(slot);
+}
+
+static TupleTableSlot *
+ExecShortestpath(PlanState *pstate)
+{
+	ShortestpathState *node = castNode(ShortestpathState, pstate);
+
+	/*
+	 * Reset per-tuple memory context to free any expression evaluation
+	 * storage allocated in the previous tuple cycle.
+	 */
+	ResetExprContext(node->ps.ps_ExprContext);
+
+	if (!node->is_executed)
+	{
+		node->is_executed = true;
+
+		search(node);
+
+		node->curr_meet = list_head(node->meets);
+		if (node->curr_meet == NULL)
+			return NULL;
+
+		init_meet(node);
+	}
+	else
+	{
+		if (node->curr_meet == NULL || !next_path(node))
+			return NULL;
+	}
+
+	return proj_path(node);
+}
+
+ShortestpathState *
+ExecInitShortestpath(Shortestpath *node, EState *estate, int eflags)
+{
+	ShortestpathState *spstate;
+	PlanState  *outerPlan;
+
+	/* check for unsupported flags */
+	Assert(!(eflags & (EXEC_FLAG_BACKWARD | EXEC_FLAG_MARK)));
+
+	/*
+	 * create state structure
+	 */
+	spstate = makeNode(ShortestpathState);
+	spstate->ps.plan = (Plan *) node;
+	spstate->ps.state = estate;
+	spstate->ps.ExecProcNode = ExecShortestpath;
+
+	/*
+	 * Miscellaneous initialization
+	 *
+	 * create expression context for node
+	 */
+	ExecAssignExprContext(estate, &spstate->ps);
+	spstate->sp_mcxt = AllocSetContextCreate(CurrentMemoryContext,
+											 "shortestpath",
+											 ALLOCSET_DEFAULT_SIZES);
+	spstate->is_executed = false;
+	spstate->fwd_stats = NULL;
+	spstate->fwd_nstats = 0;
+	spstate->bwd_stats = NULL;
+	spstate->bwd_nstats = 0;
+	get_typlenbyvalalign(GRAPHIDOID, &spstate->elemlength,
+						 &spstate->elembyval, &spstate->elemalign);
+
+	spstate->source = ExecInitExpr((Expr *) node->source, (PlanState *) spstate);
+	spstate->target = ExecInitExpr((Expr *) node->target, (PlanState *) spstate);
+
+	/*
+	 * initialize child nodes
+	 */
+	outerPlan = ExecInitNode(outerPlan(node), estate, eflags);
+	outerPlanState(spstate) = outerPlan;
+
+	/*
+	 * tuple table initialization
+	 */
+	ExecInitResultTupleSlot(estate, &spstate->ps);
+
+	/*
+	 * initialize tuple type, the result tuple is built by proj_path()
+	 */
+	ExecAssignResultTypeFromTL(&spstate->ps);
+	spstate->ps.ps_ProjInfo = NULL;
+
+	return spstate;
+}
+
+void
+ExecEndShortestpath(ShortestpathState *node)
+{
+	/*
+	 * Free the exprcontext
+	 */
+	ExecFreeExprContext(&node->ps);
+
+	/*
+	 * clean out the tuple table
+	 */
+	ExecClearTuple(node->ps.ps_ResultTupleSlot);
+
+	MemoryContextDelete(node->sp_mcxt);
+
+	/*
+	 * close down subplans
+	 */
+	ExecEndNode(outerPlanState(node));
+}
+
+void
+ExecReScanShortestpath(ShortestpathState *node)
+{
+	PlanState  *outerPlan = outerPlanState(node);
+
+	/*
+	 * If outerPlan->chgParam is not null then plan will be automatically
+	 * re-scanned by first ExecProcNode.
+	 */
+	if (outerPlan->chgParam == NULL)
+		ExecReScan(outerPlan);
+
+	node->is_executed = false;
+
+	/* visited nodes, frontiers and paths are all in sp_mcxt */
+	MemoryContextReset(node->sp_mcxt);
+	node->fwd_visited = NULL;
+	node->bwd_visited = NULL;
+	node->fwd_frontier = NIL;
+	node->bwd_frontier = NIL;
+	node->meets = NIL;
+	node->curr_meet = NULL;
+	node->fwd_chain = NULL;
+	node->bwd_chain = NULL;
+
+	ExecClearTuple(node->ps.ps_ResultTupleSlot);
+}
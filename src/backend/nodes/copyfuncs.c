@@ -244,6 +244,8 @@ _copyAppend(const Append *from)
 	 */
 	COPY_NODE_FIELD(partitioned_rels);
 	COPY_NODE_FIELD(appendplans);
+	COPY_NODE_FIELD(labid_expr);
+	COPY_NODE_FIELD(labids);
 
 	return newnode;
 }
@@ -870,6 +872,9 @@ _copyNestLoopVLE(const NestLoopVLE *from)
 
 	COPY_SCALAR_FIELD(minHops);
 	COPY_SCALAR_FIELD(maxHops);
+	COPY_SCALAR_FIELD(skipIds);
+	COPY_SCALAR_FIELD(skipEdges);
+	COPY_SCALAR_FIELD(graphOid);
 
 	return newnode;
 }
@@ -1194,6 +1199,29 @@ _copyDijkstra(const Dijkstra *from)
 	COPY_NODE_FIELD(source);
 	COPY_NODE_FIELD(target);
 	COPY_NODE_FIELD(limit);
+	COPY_SCALAR_FIELD(loopless);
+	COPY_SCALAR_FIELD(heuristic);
+	COPY_SCALAR_FIELD(topology);
+	COPY_SCALAR_FIELD(topology_reverse);
+	COPY_SCALAR_FIELD(topology_weight);
+
+	return newnode;
+}
+
+static Shortestpath *
+_copyShortestpath(const Shortestpath *from)
+{
+	Shortestpath *newnode = makeNode(Shortestpath);
+
+	CopyPlanFields((const Plan *) from, (Plan *) newnode);
+
+	COPY_SCALAR_FIELD(end_id);
+	COPY_SCALAR_FIELD(edge_id);
+	COPY_NODE_FIELD(source);
+	COPY_NODE_FIELD(target);
+	COPY_SCALAR_FIELD(min_hops);
+	COPY_SCALAR_FIELD(max_hops);
+	COPY_SCALAR_FIELD(all_paths);
 
 	return newnode;
 }
@@ -2156,6 +2184,9 @@ _copyJoinExpr(const JoinExpr *from)
 	COPY_SCALAR_FIELD(rtindex);
 	COPY_SCALAR_FIELD(minHops);
 	COPY_SCALAR_FIELD(maxHops);
+	COPY_SCALAR_FIELD(skipIds);
+	COPY_SCALAR_FIELD(skipEdges);
+	COPY_SCALAR_FIELD(graphOid);
 
 	return newnode;
 }
@@ -2369,6 +2400,9 @@ _copySpecialJoinInfo(const SpecialJoinInfo *from)
 	COPY_NODE_FIELD(semi_rhs_exprs);
 	COPY_SCALAR_FIELD(min_hops);
 	COPY_SCALAR_FIELD(max_hops);
+	COPY_SCALAR_FIELD(skip_ids);
+	COPY_SCALAR_FIELD(skip_edges);
+	COPY_SCALAR_FIELD(graph_oid);
 
 	return newnode;
 }
@@ -3115,6 +3149,18 @@ _copyQuery(const Query *from)
 	COPY_NODE_FIELD(dijkstraSource);
 	COPY_NODE_FIELD(dijkstraTarget);
 	COPY_NODE_FIELD(dijkstraLimit);
+	COPY_SCALAR_FIELD(dijkstraLoopless);
+	COPY_NODE_FIELD(dijkstraHeuristic);
+	COPY_SCALAR_FIELD(dijkstraTopology);
+	COPY_SCALAR_FIELD(dijkstraReverse);
+
+	COPY_NODE_FIELD(shortestpathEndId);
+	COPY_NODE_FIELD(shortestpathEdgeId);
+	COPY_NODE_FIELD(shortestpathSource);
+	COPY_NODE_FIELD(shortestpathTarget);
+	COPY_SCALAR_FIELD(shortestpathMinHops);
+	COPY_SCALAR_FIELD(shortestpathMaxHops);
+	COPY_SCALAR_FIELD(shortestpathAll);
 
 	COPY_SCALAR_FIELD(graph.writeOp);
 	COPY_SCALAR_FIELD(graph.last);
@@ -5336,6 +5382,9 @@ copyObjectImpl(const void *from)
 		case T_Dijkstra:
 			retval = _copyDijkstra(from);
 			break;
+		case T_Shortestpath:
+			retval = _copyShortestpath(from);
+			break;
 
 			/*
 			 * PRIMITIVE NODES
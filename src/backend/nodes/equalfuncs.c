@@ -789,6 +789,9 @@ _equalJoinExpr(const JoinExpr *a, const JoinExpr *b)
 	COMPARE_SCALAR_FIELD(rtindex);
 	COMPARE_SCALAR_FIELD(minHops);
 	COMPARE_SCALAR_FIELD(maxHops);
+	COMPARE_SCALAR_FIELD(skipIds);
+	COMPARE_SCALAR_FIELD(skipEdges);
+	COMPARE_SCALAR_FIELD(graphOid);
 
 	return true;
 }
@@ -952,6 +955,9 @@ _equalSpecialJoinInfo(const SpecialJoinInfo *a, const SpecialJoinInfo *b)
 	COMPARE_NODE_FIELD(semi_rhs_exprs);
 	COMPARE_SCALAR_FIELD(min_hops);
 	COMPARE_SCALAR_FIELD(max_hops);
+	COMPARE_SCALAR_FIELD(skip_ids);
+	COMPARE_SCALAR_FIELD(skip_edges);
+	COMPARE_SCALAR_FIELD(graph_oid);
 
 	return true;
 }
@@ -1062,6 +1068,18 @@ _equalQuery(const Query *a, const Query *b)
 	COMPARE_NODE_FIELD(dijkstraSource);
 	COMPARE_NODE_FIELD(dijkstraTarget);
 	COMPARE_NODE_FIELD(dijkstraLimit);
+	COMPARE_SCALAR_FIELD(dijkstraLoopless);
+	COMPARE_NODE_FIELD(dijkstraHeuristic);
+	COMPARE_SCALAR_FIELD(dijkstraTopology);
+	COMPARE_SCALAR_FIELD(dijkstraReverse);
+
+	COMPARE_NODE_FIELD(shortestpathEndId);
+	COMPARE_NODE_FIELD(shortestpathEdgeId);
+	COMPARE_NODE_FIELD(shortestpathSource);
+	COMPARE_NODE_FIELD(shortestpathTarget);
+	COMPARE_SCALAR_FIELD(shortestpathMinHops);
+	COMPARE_SCALAR_FIELD(shortestpathMaxHops);
+	COMPARE_SCALAR_FIELD(shortestpathAll);
 
 	COMPARE_SCALAR_FIELD(graph.writeOp);
 	COMPARE_SCALAR_FIELD(graph.last);
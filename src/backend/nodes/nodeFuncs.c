@@ -2420,6 +2420,16 @@ query_tree_walker(Query *query,
 		return true;
 	if (walker(query->dijkstraLimit, context))
 		return true;
+	if (walker(query->dijkstraHeuristic, context))
+		return true;
+	if (walker(query->shortestpathEndId, context))
+		return true;
+	if (walker(query->shortestpathEdgeId, context))
+		return true;
+	if (walker(query->shortestpathSource, context))
+		return true;
+	if (walker(query->shortestpathTarget, context))
+		return true;
 	if (!(flags & QTW_IGNORE_CTE_SUBQUERIES))
 	{
 		if (walker((Node *) query->cteList, context))
@@ -3309,6 +3319,11 @@ query_tree_mutator(Query *query,
 	MUTATE(query->dijkstraSource, query->dijkstraSource, Node *);
 	MUTATE(query->dijkstraTarget, query->dijkstraTarget, Node *);
 	MUTATE(query->dijkstraLimit, query->dijkstraLimit, Node *);
+	MUTATE(query->dijkstraHeuristic, query->dijkstraHeuristic, Node *);
+	MUTATE(query->shortestpathEndId, query->shortestpathEndId, Node *);
+	MUTATE(query->shortestpathEdgeId, query->shortestpathEdgeId, Node *);
+	MUTATE(query->shortestpathSource, query->shortestpathSource, Node *);
+	MUTATE(query->shortestpathTarget, query->shortestpathTarget, Node *);
 	if (!(flags & QTW_IGNORE_CTE_SUBQUERIES))
 		MUTATE(query->cteList, query->cteList, List *);
 	else						/* else copy CTE list as-is */
@@ -396,6 +396,8 @@ _outAppend(StringInfo str, const Append *node)
 
 	WRITE_NODE_FIELD(partitioned_rels);
 	WRITE_NODE_FIELD(appendplans);
+	WRITE_NODE_FIELD(labid_expr);
+	WRITE_NODE_FIELD(labids);
 }
 
 static void
@@ -743,6 +745,9 @@ _outNestLoopVLE(StringInfo str, const NestLoopVLE *node)
 
 	WRITE_INT_FIELD(minHops);
 	WRITE_INT_FIELD(maxHops);
+	WRITE_BOOL_FIELD(skipIds);
+	WRITE_BOOL_FIELD(skipEdges);
+	WRITE_OID_FIELD(graphOid);
 }
 
 static void
@@ -1019,6 +1024,27 @@ _outDijkstra(StringInfo str, const Dijkstra *node)
 	WRITE_NODE_FIELD(source);
 	WRITE_NODE_FIELD(target);
 	WRITE_NODE_FIELD(limit);
+	WRITE_BOOL_FIELD(loopless);
+	WRITE_INT_FIELD(heuristic);
+	WRITE_OID_FIELD(topology);
+	WRITE_BOOL_FIELD(topology_reverse);
+	WRITE_FLOAT_FIELD(topology_weight, "%.6f");
+}
+
+static void
+_outShortestpath(StringInfo str, const Shortestpath *node)
+{
+	WRITE_NODE_TYPE("SHORTESTPATH");
+
+	_outPlanInfo(str, (const Plan *) node);
+
+	WRITE_INT_FIELD(end_id);
+	WRITE_INT_FIELD(edge_id);
+	WRITE_NODE_FIELD(source);
+	WRITE_NODE_FIELD(target);
+	WRITE_INT_FIELD(min_hops);
+	WRITE_INT_FIELD(max_hops);
+	WRITE_BOOL_FIELD(all_paths);
 }
 
 static void
@@ -1721,6 +1747,9 @@ _outJoinExpr(StringInfo str, const JoinExpr *node)
 	WRITE_INT_FIELD(rtindex);
 	WRITE_INT_FIELD(minHops);
 	WRITE_INT_FIELD(maxHops);
+	WRITE_BOOL_FIELD(skipIds);
+	WRITE_BOOL_FIELD(skipEdges);
+	WRITE_OID_FIELD(graphOid);
 }
 
 static void
@@ -1859,6 +1888,9 @@ _outJoinPathInfo(StringInfo str, const JoinPath *node)
 	WRITE_NODE_FIELD(joinrestrictinfo);
 	WRITE_INT_FIELD(minhops);
 	WRITE_INT_FIELD(maxhops);
+	WRITE_BOOL_FIELD(skipids);
+	WRITE_BOOL_FIELD(skipedges);
+	WRITE_OID_FIELD(graphoid);
 }
 
 static void
@@ -2250,6 +2282,25 @@ _outDijkstraPath(StringInfo str, const DijkstraPath *node)
 	WRITE_NODE_FIELD(source);
 	WRITE_NODE_FIELD(target);
 	WRITE_NODE_FIELD(limit);
+	WRITE_BOOL_FIELD(loopless);
+	WRITE_NODE_FIELD(heuristic);
+}
+
+static void
+_outShortestpathPath(StringInfo str, const ShortestpathPath *node)
+{
+	WRITE_NODE_TYPE("SHORTESTPATH");
+
+	_outPathInfo(str, (const Path *) node);
+
+	WRITE_NODE_FIELD(subpath);
+	WRITE_NODE_FIELD(end_id);
+	WRITE_NODE_FIELD(edge_id);
+	WRITE_NODE_FIELD(source);
+	WRITE_NODE_FIELD(target);
+	WRITE_INT_FIELD(min_hops);
+	WRITE_INT_FIELD(max_hops);
+	WRITE_BOOL_FIELD(all_paths);
 }
 
 static void
@@ -2632,6 +2683,9 @@ _outSpecialJoinInfo(StringInfo str, const SpecialJoinInfo *node)
 	WRITE_NODE_FIELD(semi_rhs_exprs);
 	WRITE_INT_FIELD(min_hops);
 	WRITE_INT_FIELD(max_hops);
+	WRITE_BOOL_FIELD(skip_ids);
+	WRITE_BOOL_FIELD(skip_edges);
+	WRITE_OID_FIELD(graph_oid);
 }
 
 static void
@@ -3070,6 +3124,18 @@ _outQuery(StringInfo str, const Query *node)
 	WRITE_NODE_FIELD(dijkstraSource);
 	WRITE_NODE_FIELD(dijkstraTarget);
 	WRITE_NODE_FIELD(dijkstraLimit);
+	WRITE_BOOL_FIELD(dijkstraLoopless);
+	WRITE_NODE_FIELD(dijkstraHeuristic);
+	WRITE_OID_FIELD(dijkstraTopology);
+	WRITE_BOOL_FIELD(dijkstraReverse);
+
+	WRITE_NODE_FIELD(shortestpathEndId);
+	WRITE_NODE_FIELD(shortestpathEdgeId);
+	WRITE_NODE_FIELD(shortestpathSource);
+	WRITE_NODE_FIELD(shortestpathTarget);
+	WRITE_INT_FIELD(shortestpathMinHops);
+	WRITE_INT_FIELD(shortestpathMaxHops);
+	WRITE_BOOL_FIELD(shortestpathAll);
 
 	WRITE_ENUM_FIELD(graph.writeOp, GraphWriteOp);
 	WRITE_BOOL_FIELD(graph.last);
@@ -4179,6 +4245,9 @@ outNode(StringInfo str, const void *obj)
 			case T_Dijkstra:
 				_outDijkstra(str, obj);
 				break;
+			case T_Shortestpath:
+				_outShortestpath(str, obj);
+				break;
 			case T_NestLoopParam:
 				_outNestLoopParam(str, obj);
 				break;
@@ -4449,6 +4518,9 @@ outNode(StringInfo str, const void *obj)
 			case T_DijkstraPath:
 				_outDijkstraPath(str, obj);
 				break;
+			case T_ShortestpathPath:
+				_outShortestpathPath(str, obj);
+				break;
 			case T_GatherMergePath:
 				_outGatherMergePath(str, obj);
 				break;
@@ -274,6 +274,18 @@ _readQuery(void)
 	READ_NODE_FIELD(dijkstraSource);
 	READ_NODE_FIELD(dijkstraTarget);
 	READ_NODE_FIELD(dijkstraLimit);
+	READ_BOOL_FIELD(dijkstraLoopless);
+	READ_NODE_FIELD(dijkstraHeuristic);
+	READ_OID_FIELD(dijkstraTopology);
+	READ_BOOL_FIELD(dijkstraReverse);
+
+	READ_NODE_FIELD(shortestpathEndId);
+	READ_NODE_FIELD(shortestpathEdgeId);
+	READ_NODE_FIELD(shortestpathSource);
+	READ_NODE_FIELD(shortestpathTarget);
+	READ_INT_FIELD(shortestpathMinHops);
+	READ_INT_FIELD(shortestpathMaxHops);
+	READ_BOOL_FIELD(shortestpathAll);
 
 	READ_ENUM_FIELD(graph.writeOp, GraphWriteOp);
 	READ_BOOL_FIELD(graph.last);
@@ -1304,6 +1316,9 @@ _readJoinExpr(void)
 	READ_INT_FIELD(rtindex);
 	READ_INT_FIELD(minHops);
 	READ_INT_FIELD(maxHops);
+	READ_BOOL_FIELD(skipIds);
+	READ_BOOL_FIELD(skipEdges);
+	READ_OID_FIELD(graphOid);
 
 	READ_DONE();
 }
@@ -1620,6 +1635,8 @@ _readAppend(void)
 
 	READ_NODE_FIELD(partitioned_rels);
 	READ_NODE_FIELD(appendplans);
+	READ_NODE_FIELD(labid_expr);
+	READ_NODE_FIELD(labids);
 
 	READ_DONE();
 }
@@ -2041,6 +2058,9 @@ _readNestLoopVLE(void)
 
 	READ_INT_FIELD(minHops);
 	READ_INT_FIELD(maxHops);
+	READ_BOOL_FIELD(skipIds);
+	READ_BOOL_FIELD(skipEdges);
+	READ_OID_FIELD(graphOid);
 
 	READ_DONE();
 }
@@ -2322,6 +2342,29 @@ _readDijkstra(void)
 	READ_NODE_FIELD(source);
 	READ_NODE_FIELD(target);
 	READ_NODE_FIELD(limit);
+	READ_BOOL_FIELD(loopless);
+	READ_INT_FIELD(heuristic);
+	READ_OID_FIELD(topology);
+	READ_BOOL_FIELD(topology_reverse);
+	READ_FLOAT_FIELD(topology_weight);
+
+	READ_DONE();
+}
+
+static Shortestpath *
+_readShortestpath(void)
+{
+	READ_LOCALS(Shortestpath);
+
+	ReadCommonPlan(&local_node->plan);
+
+	READ_INT_FIELD(end_id);
+	READ_INT_FIELD(edge_id);
+	READ_NODE_FIELD(source);
+	READ_NODE_FIELD(target);
+	READ_INT_FIELD(min_hops);
+	READ_INT_FIELD(max_hops);
+	READ_BOOL_FIELD(all_paths);
 
 	READ_DONE();
 }
@@ -2845,6 +2888,8 @@ parseNodeString(void)
 		return_value = _readLimit();
 	else if (MATCH("DIJKSTRA", 8))
 		return_value = _readDijkstra();
+	else if (MATCH("SHORTESTPATH", 12))
+		return_value = _readShortestpath();
 	else if (MATCH("NESTLOOPPARAM", 13))
 		return_value = _readNestLoopParam();
 	else if (MATCH("PLANROWMARK", 11))
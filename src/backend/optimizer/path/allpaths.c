@@ -41,6 +41,7 @@
 #include "optimizer/tlist.h"
 #include "optimizer/var.h"
 #include "parser/parse_clause.h"
+#include "parser/parse_graph.h"
 #include "parser/parsetree.h"
 #include "rewrite/rewriteManip.h"
 #include "utils/lsyscache.h"
@@ -132,6 +133,7 @@ static void subquery_push_qual(Query *subquery,
 static void recurse_push_qual(Node *setOp, Query *topquery,
 				  RangeTblEntry *rte, Index rti, Node *qual);
 static void remove_unused_subquery_outputs(Query *subquery, RelOptInfo *rel);
+static void mark_unused_vle_outputs(Query *subquery, RelOptInfo *rel);
 static void add_paths_to_append_rel(PlannerInfo *root, RelOptInfo *rel,
 						List *live_childrels);
 
@@ -319,7 +321,8 @@ set_rel_size(PlannerInfo *root, RelOptInfo *rel,
 			 Index rti, RangeTblEntry *rte)
 {
 	if (rel->reloptkind == RELOPT_BASEREL &&
-		relation_excluded_by_constraints(root, rel, rte))
+		(relation_excluded_by_constraints(root, rel, rte) ||
+		 relation_excluded_by_labid(root, rel, rte)))
 	{
 		/*
 		 * We proved we don't need to scan the rel via constraint exclusion,
@@ -541,9 +544,6 @@ set_rel_consider_parallel(PlannerInfo *root, RelOptInfo *rel,
 	/* This should only be called for baserels and appendrel children. */
 	Assert(IS_SIMPLE_REL(rel));
 
-	if (root->hasVLEJoinRTE)
-		return;
-
 	/* Assorted checks based on rtekind. */
 	switch (rte->rtekind)
 	{
@@ -678,6 +678,16 @@ set_rel_consider_parallel(PlannerInfo *root, RelOptInfo *rel,
 	if (!is_parallel_safe(root, (Node *) rel->reltarget->exprs))
 		return;
 
+	/*
+	 * Relations in a graph traversal are rescanned with Params that are set
+	 * by the traversal itself or by the outer query, and such Params are not
+	 * passed to workers.  The whole traversal can run inside a worker (see
+	 * is_parallel_safe()), but its relations must not be scanned in parallel
+	 * underneath it.
+	 */
+	if (root->hasGraphTraversal)
+		rel->rel_parallel_workers = 0;
+
 	/* We have a winner. */
 	rel->consider_parallel = true;
 }
@@ -1042,7 +1052,8 @@ set_append_rel_size(PlannerInfo *root, RelOptInfo *rel,
 			continue;
 		}
 
-		if (relation_excluded_by_constraints(root, childrel, childRTE))
+		if (relation_excluded_by_constraints(root, childrel, childRTE) ||
+			relation_excluded_by_labid(root, childrel, childRTE))
 		{
 			/*
 			 * This child need not be scanned, so we can omit it from the
@@ -1898,6 +1909,8 @@ set_subquery_pathlist(PlannerInfo *root, RelOptInfo *rel,
 	 */
 	if (!rte->isVLE)
 		remove_unused_subquery_outputs(subquery, rel);
+	else
+		mark_unused_vle_outputs(subquery, rel);
 
 	/*
 	 * We can safely pass the outer tuple_fraction down to the subquery if the
@@ -2994,7 +3007,7 @@ remove_unused_subquery_outputs(Query *subquery, RelOptInfo *rel)
 	if (subquery->commandType == CMD_GRAPHWRITE)
 		return;
 
-	if (subquery->dijkstraSource)
+	if (subquery->dijkstraSource || subquery->shortestpathSource)
 		return;
 
 	/*
@@ -3077,6 +3090,55 @@ remove_unused_subquery_outputs(Query *subquery, RelOptInfo *rel)
 	}
 }
 
+/*
+ * mark_unused_vle_outputs
+ *		Tell the VLE join which path arrays nobody reads
+ *
+ * The columns of a VLE subquery can't be replaced with NULL constants
+ * because NestLoopVLE fills them in itself, but building the ids and edges
+ * arrays for every path it returns costs time proportional to the length of
+ * the path.  The join skips building the arrays the upper query doesn't use.
+ */
+static void
+mark_unused_vle_outputs(Query *subquery, RelOptInfo *rel)
+{
+	Bitmapset  *attrs_used = NULL;
+	JoinExpr   *j;
+	ListCell   *lc;
+
+	if (list_length(subquery->jointree->fromlist) != 1)
+		return;
+	j = linitial(subquery->jointree->fromlist);
+	if (!IsA(j, JoinExpr) || j->jointype != JOIN_VLE)
+		return;
+
+	pull_varattnos((Node *) rel->reltarget->exprs, rel->relid, &attrs_used);
+	foreach(lc, rel->baserestrictinfo)
+	{
+		RestrictInfo *rinfo = (RestrictInfo *) lfirst(lc);
+
+		pull_varattnos((Node *) rinfo->clause, rel->relid, &attrs_used);
+	}
+
+	if (bms_is_member(0 - FirstLowInvalidHeapAttributeNumber, attrs_used))
+		return;
+
+	foreach(lc, subquery->targetList)
+	{
+		TargetEntry *tle = (TargetEntry *) lfirst(lc);
+
+		if (tle->resname == NULL ||
+			bms_is_member(tle->resno - FirstLowInvalidHeapAttributeNumber,
+						  attrs_used))
+			continue;
+
+		if (strcmp(tle->resname, VLE_COLNAME_IDS) == 0)
+			j->skipIds = true;
+		else if (strcmp(tle->resname, VLE_COLNAME_EDGES) == 0)
+			j->skipEdges = true;
+	}
+}
+
 /*
  * create_partial_bitmap_paths
  *	  Build partial bitmap heap path for the relation
@@ -100,6 +100,14 @@
 
 #define LOG2(x)  (log(x) / 0.693147180559945)
 
+/*
+ * VLE without an upper bound is assumed to follow this many hops if there are
+ * no degree statistics.  With statistics, we never look beyond
+ * VLE_MAX_ESTIMATED_HOPS.
+ */
+#define VLE_DEFAULT_MAX_HOPS	10
+#define VLE_MAX_ESTIMATED_HOPS	100
+
 
 double		seq_page_cost = DEFAULT_SEQ_PAGE_COST;
 double		random_page_cost = DEFAULT_RANDOM_PAGE_COST;
@@ -163,6 +171,10 @@ static void set_rel_width(PlannerInfo *root, RelOptInfo *rel);
 static double relation_byte_size(double tuples, int width);
 static double page_size(double tuples, int width);
 static double get_parallel_divisor(Path *path);
+static void estimate_vle_paths(PlannerInfo *root, RelOptInfo *inner_rel,
+				   double inner_rows, SpecialJoinInfo *sjinfo,
+				   double *npaths, double *nscans);
+static double estimate_visited_vertices(PlannerInfo *root, bool bidirectional);
 
 
 /*
@@ -1870,18 +1882,69 @@ cost_material(Path *path,
 	path->total_cost = startup_cost + run_cost;
 }
 
-/* FIXME */
+/*
+ * cost_dijkstra
+ *	  Determines and returns the cost of finding the shortest weighted paths
+ *	  between two vertices by Dijkstra's algorithm.
+ *
+ * 'tuples' is the estimated number of edges adjacent to a vertex, the input
+ * is scanned once for each vertex visited.  Every edge of a visited vertex
+ * goes through the priority queue.  The search is done before the first
+ * path is returned.
+ */
 void
-cost_dijkstra(Path *path,
+cost_dijkstra(Path *path, PlannerInfo *root,
 			  Cost input_startup_cost, Cost input_total_cost,
 			  double tuples, int width)
 {
+	double		nvisited = estimate_visited_vertices(root, false);
+	double		nedges = nvisited * tuples;
 	Cost		startup_cost = input_startup_cost;
-	Cost		run_cost = input_total_cost - input_startup_cost;
+	Cost		run_cost = 0;
 
 	path->rows = tuples;
 
-	run_cost += 10 * cpu_operator_cost * tuples;
+	startup_cost += nvisited * (input_total_cost - input_startup_cost);
+
+	/* hash table and priority queue operations for each edge */
+	startup_cost += nedges * cpu_operator_cost * (2 + LOG2(nedges + 1));
+
+	run_cost += cpu_tuple_cost * path->rows;
+
+	path->startup_cost = startup_cost;
+	path->total_cost = startup_cost + run_cost;
+}
+
+/*
+ * cost_shortestpath
+ *	  Determines and returns the cost of finding the shortest paths between
+ *	  two vertices by bidirectional breadth-first search.
+ *
+ * 'tuples' is the estimated number of edges adjacent to a vertex, the input
+ * is scanned once for each vertex visited.  All the paths are found before
+ * the first one is returned.
+ */
+void
+cost_shortestpath(Path *path, PlannerInfo *root,
+				  Cost input_startup_cost, Cost input_total_cost,
+				  double tuples, bool all_paths)
+{
+	double		nvisited = estimate_visited_vertices(root, true);
+	Cost		startup_cost = input_startup_cost;
+	Cost		run_cost = 0;
+
+	if (all_paths)
+		path->rows = clamp_row_est(tuples);
+	else
+		path->rows = 1;
+
+	startup_cost += nvisited * (input_total_cost - input_startup_cost);
+
+	/* hash table operations for each edge */
+	startup_cost += 2 * cpu_operator_cost * nvisited * tuples;
+
+	/* building the arrays of each path */
+	run_cost += cpu_tuple_cost * path->rows;
 
 	path->startup_cost = startup_cost;
 	path->total_cost = startup_cost + run_cost;
@@ -2344,13 +2407,29 @@ final_cost_nestloop(PlannerInfo *root, NestPath *path,
 	}
 	else if (path->jointype == JOIN_VLE)
 	{
-		SpecialJoinInfo *sjinfo = extra->sjinfo;
-		int			base = (sjinfo->min_hops > 0) ? 1 : 0;
-		int			max_hops = (sjinfo->max_hops == -1) ? 10 : sjinfo->max_hops;
-		int			inner_loop_cnt = max_hops - base;
+		double		npaths;
+		double		nscans;
+		Cost		inner_rescan_start_cost;
+		Cost		inner_rescan_total_cost;
+
+		estimate_vle_paths(root, inner_path->parent, inner_path_rows,
+						   extra->sjinfo, &npaths, &nscans);
+
+		/*
+		 * The preliminary estimate charged one inner scan for each outer
+		 * row.  Every path that doesn't reach the upper bound yet needs
+		 * another one.
+		 */
+		if (nscans > 1)
+		{
+			cost_rescan(root, inner_path,
+						&inner_rescan_start_cost,
+						&inner_rescan_total_cost);
+			run_cost += outer_path_rows * (nscans - 1) *
+						inner_rescan_total_cost;
+		}
 
-		ntuples = outer_path_rows +
-				  outer_path_rows * inner_path_rows * inner_loop_cnt;
+		ntuples = outer_path_rows + outer_path_rows * nscans * inner_path_rows;
 	}
 	else
 	{
@@ -4304,11 +4383,13 @@ calc_joinrel_size_estimate(PlannerInfo *root,
 			break;
 		case JOIN_VLE:
 			{
-				int base = (sjinfo->min_hops > 0) ? 1 : 0;
-				int max_hops = (sjinfo->max_hops == -1) ? 10 : sjinfo->max_hops;
-				int inner_loop_cnt = max_hops - base;
+				double		npaths;
+				double		nscans;
 
-				nrows = outer_rows + outer_rows * inner_rows * inner_loop_cnt;
+				estimate_vle_paths(root, inner_rel, inner_rows, sjinfo,
+								   &npaths, &nscans);
+
+				nrows = outer_rows * npaths;
 			}
 			break;
 		case JOIN_LEFT:
@@ -5209,3 +5290,95 @@ compute_bitmap_pages(PlannerInfo *root, RelOptInfo *baserel, Path *bitmapqual,
 
 	return pages_fetched;
 }
+
+/*
+ * estimate_vle_paths
+ *	  Estimate the number of paths that a VLE join finds for an outer row and
+ *	  the number of inner scans needed to find them.
+ *
+ * An outer row is a path whose length is 0 or 1, and each inner scan extends
+ * a path by one hop.  The edges of a vertex are the rows of an inner scan.  A
+ * vertex reached through an edge is more likely to be a high-degree one, so
+ * every hop after the first one uses the degree of the vertex at the end of a
+ * random edge (see STATISTIC_KIND_DEGREE) instead.  The number of paths grows
+ * geometrically with the length, but we don't let the paths of a length
+ * outnumber the edges of the label.  Without an upper bound, we stop at the
+ * length where the paths stop growing.
+ */
+static void
+estimate_vle_paths(PlannerInfo *root, RelOptInfo *inner_rel,
+				   double inner_rows, SpecialJoinInfo *sjinfo,
+				   double *npaths, double *nscans)
+{
+	GraphDegreeStats degree;
+	bool		have_degree = false;
+	double		fanout = inner_rows;
+	int			base = (sjinfo->min_hops > 0) ? 1 : 0;
+	int			max_hops = sjinfo->max_hops;
+	double		paths = 1.0;
+	int			hops;
+
+	if (inner_rel->subroot != NULL)
+		have_degree = get_graph_degree_stats(inner_rel->subroot, &degree);
+
+	if (have_degree && !degree.isdefault)
+	{
+		fanout = inner_rows * (degree.sb_degree / degree.avg_degree);
+		fanout = Min(fanout, degree.max_degree);
+	}
+
+	if (max_hops < 0)
+	{
+		if (have_degree && !degree.isdefault)
+			max_hops = VLE_MAX_ESTIMATED_HOPS;
+		else
+			max_hops = VLE_DEFAULT_MAX_HOPS;
+	}
+	max_hops = Min(max_hops, VLE_MAX_ESTIMATED_HOPS);
+
+	*npaths = (sjinfo->min_hops <= base) ? 1.0 : 0.0;
+	*nscans = 0.0;
+	for (hops = base + 1; hops <= max_hops; hops++)
+	{
+		double		next_paths;
+
+		*nscans += paths;
+
+		next_paths = paths * ((hops == 1) ? inner_rows : fanout);
+		if (have_degree)
+			next_paths = Min(next_paths, degree.nedges);
+
+		if (hops >= sjinfo->min_hops)
+			*npaths += next_paths;
+
+		/* the rest adds nothing significant */
+		if (sjinfo->max_hops < 0 && next_paths <= paths &&
+			hops >= sjinfo->min_hops)
+			break;
+
+		paths = next_paths;
+	}
+}
+
+/*
+ * estimate_visited_vertices
+ *	  Estimate the number of vertices a shortest path search visits.
+ *
+ * A search from one vertex visits about half of the vertices before it meets
+ * the other vertex.  A bidirectional search meets in the middle, so each
+ * side visits about the square root of the number of vertices.  If we don't
+ * know the number of vertices, assume the search visits one vertex.
+ */
+static double
+estimate_visited_vertices(PlannerInfo *root, bool bidirectional)
+{
+	GraphDegreeStats degree;
+
+	if (!get_graph_degree_stats(root, &degree))
+		return 1.0;
+
+	if (bidirectional)
+		return Max(2.0 * sqrt(degree.nvertices), 1.0);
+	else
+		return Max(degree.nvertices / 2.0, 1.0);
+}
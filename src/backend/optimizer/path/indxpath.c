@@ -177,6 +177,8 @@ static bool match_boolean_index_clause(Node *clause, int indexcol,
 static bool match_special_index_operator(Expr *clause,
 							 Oid opfamily, Oid idxcollation,
 							 bool indexkey_on_left);
+static bool match_prop_eq_to_indexcol(Node *leftop, Oid expr_op,
+						  int indexcol, IndexOptInfo *index);
 static Expr *expand_boolean_index_clause(Node *clause, int indexcol,
 							IndexOptInfo *index);
 static List *expand_indexqual_opclause(RestrictInfo *rinfo,
@@ -188,6 +190,7 @@ static List *prefix_quals(Node *leftop, Oid opfamily, Oid collation,
 			 Const *prefix, Pattern_Prefix_Status pstatus);
 static List *network_prefix_quals(Node *leftop, Oid expr_op, Oid opfamily,
 					 Datum rightop);
+static List *prop_contains_quals(Node *leftop, Node *rightop);
 static Datum string_to_datum(const char *str, Oid datatype);
 static Const *string_to_const(const char *str, Oid datatype);
 
@@ -2453,6 +2456,16 @@ match_clause_to_indexcol(IndexOptInfo *index,
 		return false;
 	}
 
+	/*
+	 * Check for (indexkey.key... = pseudoconstant) where indexkey is a
+	 * property map.  See match_prop_eq_to_indexcol().
+	 */
+	if (plain_op &&
+		match_prop_eq_to_indexcol(leftop, expr_op, indexcol, index) &&
+		!bms_is_member(index_relid, right_relids) &&
+		!contain_volatile_functions(rightop))
+		return true;
+
 	return false;
 }
 
@@ -3361,6 +3374,49 @@ match_boolean_index_clause(Node *clause,
 	return false;
 }
 
+/*
+ * match_prop_eq_to_indexcol
+ *	  Recognize equality on a property of a property map indexed by the
+ *	  given index column.
+ *
+ * Property constraints in Cypher patterns, e.g. (n {a: {b: 1}}), are
+ * transformed into one equality clause per property, n.a.b = 1, so that
+ * indexes on properties can be used for them.  Equality on a property
+ * implies containment of the corresponding nested map in the property map,
+ * so such clauses can also be turned into (properties @> '{"a":{"b":1}}')
+ * indexquals for an index that supports jsonb @> on the property map (GIN).
+ * This way the choice between those indexes is made based on cost.
+ */
+static bool
+match_prop_eq_to_indexcol(Node *leftop, Oid expr_op, int indexcol,
+						  IndexOptInfo *index)
+{
+	CypherAccessExpr *a;
+	ListCell   *le;
+
+	if (expr_op != OID_JSONB_EQ_OP || !IsA(leftop, CypherAccessExpr))
+		return false;
+
+	a = (CypherAccessExpr *) leftop;
+	if (a->path == NIL ||
+		!match_index_to_operand((Node *) a->arg, indexcol, index))
+		return false;
+
+	/* only simple property names (not list indices or slices) */
+	foreach(le, a->path)
+	{
+		Node	   *elem = lfirst(le);
+
+		if (!IsA(elem, Const) ||
+			((Const *) elem)->consttype != TEXTOID ||
+			((Const *) elem)->constisnull)
+			return false;
+	}
+
+	return op_in_opfamily(OID_JSONB_CONTAINS_OP,
+						  index->opfamily[indexcol]);
+}
+
 /*
  * match_special_index_operator
  *	  Recognize restriction clauses that can be used to generate
@@ -3778,6 +3834,13 @@ expand_indexqual_opclause(RestrictInfo *rinfo, Oid opfamily, Oid idxcollation)
 											patt->constvalue);
 			}
 			break;
+
+		case OID_JSONB_EQ_OP:
+			/* accepted by match_prop_eq_to_indexcol() */
+			if (IsA(leftop, CypherAccessExpr) &&
+				!op_in_opfamily(expr_op, opfamily))
+				return prop_contains_quals(leftop, rightop);
+			break;
 	}
 
 	/* Default case: just make a list of the unmodified indexqual */
@@ -4259,6 +4322,44 @@ network_prefix_quals(Node *leftop, Oid expr_op, Oid opfamily, Datum rightop)
 	return result;
 }
 
+/*
+ * Given (prop_map.key... = rightop), generate the indexqual condition
+ * "prop_map @> {key: ... rightop}".  The condition is lossy; the original
+ * clause is still checked on heap tuples.
+ */
+static List *
+prop_contains_quals(Node *leftop, Node *rightop)
+{
+	CypherAccessExpr *a = (CypherAccessExpr *) leftop;
+	List	   *keys = NIL;
+	Node	   *value = rightop;
+	ListCell   *le;
+	Expr	   *expr;
+
+	/* build the nested map from the innermost property outward */
+	foreach(le, a->path)
+		keys = lcons(lfirst(le), keys);
+
+	foreach(le, keys)
+	{
+		CypherMapExpr *m = makeNode(CypherMapExpr);
+
+		m->keyvals = list_make2(copyObject(lfirst(le)), value);
+		m->location = -1;
+
+		value = (Node *) m;
+	}
+
+	/* fold it into a jsonb constant if rightop is a constant */
+	value = eval_const_expressions(NULL, value);
+
+	expr = make_opclause(OID_JSONB_CONTAINS_OP, BOOLOID, false,
+						 a->arg, (Expr *) value,
+						 InvalidOid, InvalidOid);
+
+	return list_make1(make_simple_restrictinfo(expr));
+}
+
 /*
  * Handy subroutines for match_special_index_operator() and friends.
  */
@@ -17,6 +17,7 @@
 #include <math.h>
 
 #include "executor/executor.h"
+#include "executor/nodeModifyGraph.h"
 #include "foreign/fdwapi.h"
 #include "optimizer/cost.h"
 #include "optimizer/pathnode.h"
@@ -343,6 +344,22 @@ add_paths_for_cmerge(PlannerInfo *root, RelOptInfo *joinrel,
 
 	add_cyphermerge_path(root, joinrel, outerrel, innerrel, &extra);
 
+	/*
+	 * MATCH part must see the vertices created by MERGE for the previous input
+	 * rows, unless MERGE finds them by itself. Then, the existing vertices can
+	 * be looked up for all the input rows at once with a hash join. The hash
+	 * table is built before MERGE creates anything, so nothing before MERGE
+	 * may modify the graph.
+	 */
+	if (enable_hashjoin &&
+		root->parse->commandType == CMD_GRAPHWRITE &&
+		root->parse->graph.nr_modify == 0 &&
+		getMergeKeyMap(root->parse->graph.writeOp, root->parse->graph.last,
+					   root->parse->graph.eager, root->parse->graph.pattern,
+					   root->parse->graph.sets) != NULL)
+		hash_inner_and_outer(root, joinrel, outerrel, innerrel,
+							 JOIN_CYPHER_MERGE, &extra);
+
 	if (joinrel->fdwroutine && joinrel->fdwroutine->GetForeignJoinPaths)
 		joinrel->fdwroutine->GetForeignJoinPaths(root, joinrel,
 												 outerrel, innerrel,
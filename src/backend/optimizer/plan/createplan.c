@@ -19,6 +19,7 @@
 #include <limits.h>
 #include <math.h>
 
+#include "ag_const.h"
 #include "access/stratnum.h"
 #include "access/sysattr.h"
 #include "catalog/pg_class.h"
@@ -157,6 +158,8 @@ static ModifyGraph *create_modifygraph_plan(PlannerInfo *root,
 											ModifyGraphPath *best_path);
 static Dijkstra *create_dijkstra_plan(PlannerInfo *root,
 									  DijkstraPath *best_path);
+static Shortestpath *create_shortestpath_plan(PlannerInfo *root,
+											  ShortestpathPath *best_path);
 static Node *replace_nestloop_params(PlannerInfo *root, Node *expr);
 static Node *replace_nestloop_params_mutator(Node *node, PlannerInfo *root);
 static void process_subquery_nestloop_params(PlannerInfo *root,
@@ -210,6 +213,8 @@ static NamedTuplestoreScan *make_namedtuplestorescan(List *qptlist, List *qpqual
 static WorkTableScan *make_worktablescan(List *qptlist, List *qpqual,
 				   Index scanrelid, int wtParam);
 static Append *make_append(List *appendplans, List *tlist, List *partitioned_rels);
+static Expr *find_label_id_probe(PlannerInfo *root, AppendPath *best_path,
+					List **labids);
 static RecursiveUnion *make_recursive_union(List *tlist,
 					 Plan *lefttree,
 					 Plan *righttree,
@@ -223,7 +228,8 @@ static NestLoop *make_nestloop(List *tlist,
 			  List *joinclauses, List *otherclauses, List *nestParams,
 			  Plan *lefttree, Plan *righttree,
 			  JoinType jointype, bool inner_unique,
-			  int minhops, int maxhops);
+			  int minhops, int maxhops, bool skipids, bool skipedges,
+			  Oid graphoid);
 static HashJoin *make_hashjoin(List *tlist,
 			  List *joinclauses, List *otherclauses,
 			  List *hashclauses,
@@ -504,6 +510,10 @@ create_plan_recurse(PlannerInfo *root, Path *best_path, int flags)
 			plan = (Plan *) create_dijkstra_plan(root,
 												 (DijkstraPath *) best_path);
 			break;
+		case T_Shortestpath:
+			plan = (Plan *) create_shortestpath_plan(root,
+											(ShortestpathPath *) best_path);
+			break;
 		default:
 			elog(ERROR, "unrecognized node type: %d",
 				 (int) best_path->pathtype);
@@ -1070,11 +1080,89 @@ create_append_plan(PlannerInfo *root, AppendPath *best_path)
 
 	plan = make_append(subplans, tlist, best_path->partitioned_rels);
 
+	if (best_path->path.param_info != NULL)
+		plan->labid_expr = find_label_id_probe(root, best_path, &plan->labids);
+
 	copy_generic_path_info(&plan->plan, (Path *) best_path);
 
 	return (Plan *) plan;
 }
 
+/*
+ * find_label_id_probe
+ *	  If the appendrel is a label probed by a graphid on its id column through
+ *	  the join clauses it is parameterized by, return the graphid expression
+ *	  and the label ID of each child in *labids.
+ *
+ * Graphid has the label ID in it, so the executor can skip the children
+ * whose label ID is different from that of the probing graphid.  This is much
+ * like partition pruning, and saves a probe of every child for each outer
+ * row.  Like relation_excluded_by_labid(), this is turned off by
+ * constraint_exclusion = off.
+ */
+static Expr *
+find_label_id_probe(PlannerInfo *root, AppendPath *best_path, List **labids)
+{
+	RelOptInfo *rel = best_path->path.parent;
+	RangeTblEntry *rte;
+	AttrNumber	id_attno;
+	Relids		required_outer;
+	Relids		joinrelids;
+	List	   *pclauses = NIL;
+	Expr	   *probe = NULL;
+	ListCell   *lc;
+
+	if (rel->reloptkind != RELOPT_BASEREL ||
+		constraint_exclusion == CONSTRAINT_EXCLUSION_OFF)
+		return NULL;
+
+	rte = planner_rt_fetch(rel->relid, root);
+	if (rte->rtekind != RTE_RELATION || get_relid_labid(rte->relid) < 0)
+		return NULL;
+
+	id_attno = get_attnum(rte->relid, AG_ELEM_ID);
+	if (id_attno == InvalidAttrNumber)
+		return NULL;
+
+	/* see get_baserel_parampathinfo() */
+	required_outer = PATH_REQ_OUTER(&best_path->path);
+	joinrelids = bms_union(rel->relids, required_outer);
+	foreach(lc, rel->joininfo)
+	{
+		RestrictInfo *rinfo = (RestrictInfo *) lfirst(lc);
+
+		if (join_clause_is_movable_into(rinfo, rel->relids, joinrelids))
+			pclauses = lappend(pclauses, rinfo);
+	}
+	pclauses = list_concat(pclauses,
+						   generate_join_implied_equalities(root, joinrelids,
+															required_outer,
+															rel));
+
+	foreach(lc, pclauses)
+	{
+		RestrictInfo *rinfo = (RestrictInfo *) lfirst(lc);
+
+		probe = label_id_probe(rinfo->clause, rel->relid, id_attno);
+		if (probe != NULL)
+			break;
+	}
+	if (probe == NULL)
+		return NULL;
+
+	*labids = NIL;
+	foreach(lc, best_path->subpaths)
+	{
+		Path	   *subpath = (Path *) lfirst(lc);
+		RangeTblEntry *childrte;
+
+		childrte = planner_rt_fetch(subpath->parent->relid, root);
+		*labids = lappend_int(*labids, get_relid_labid(childrte->relid));
+	}
+
+	return (Expr *) replace_nestloop_params(root, (Node *) probe);
+}
+
 /*
  * create_merge_append_plan
  *	  Create a MergeAppend plan for 'best_path' and (recursively) plans
@@ -3769,7 +3857,10 @@ create_nestloop_plan(PlannerInfo *root,
 							  best_path->jointype,
 							  best_path->inner_unique,
 							  best_path->minhops,
-							  best_path->maxhops);
+							  best_path->maxhops,
+							  best_path->skipids,
+							  best_path->skipedges,
+							  best_path->graphoid);
 
 	copy_generic_path_info(&join_plan->join.plan, &best_path->path);
 
@@ -4240,6 +4331,9 @@ create_dijkstra_plan(PlannerInfo *root, DijkstraPath *best_path)
 	TargetEntry *tle;
 	AttrNumber	end_id;
 	AttrNumber	edge_id;
+	AttrNumber	heuristic = 0;
+	Oid			topology = InvalidOid;
+	double		topology_weight = 0.0;
 
 	subplan = create_plan_recurse(root, best_path->subpath, CP_EXACT_TLIST);
 
@@ -4248,11 +4342,63 @@ create_dijkstra_plan(PlannerInfo *root, DijkstraPath *best_path)
 	end_id = tle->resno;
 	tle = tlist_member((Expr *) best_path->edge_id, sub_tlist);
 	edge_id = tle->resno;
+	if (best_path->heuristic != NULL)
+	{
+		tle = tlist_member((Expr *) best_path->heuristic, sub_tlist);
+		heuristic = tle->resno;
+	}
+
+	/*
+	 * If the edges to expand are given by the topology of the edge label and
+	 * every edge weighs the same, the executor can take the edges from the
+	 * topology cache.  A negative weight is left to the subplan to report.
+	 */
+	if (OidIsValid(root->parse->dijkstraTopology))
+	{
+		tle = get_tle_by_resno(sub_tlist, best_path->weight);
+		if (tle != NULL && IsA(tle->expr, Const) &&
+			!((Const *) tle->expr)->constisnull &&
+			DatumGetFloat8(((Const *) tle->expr)->constvalue) >= 0.0)
+		{
+			topology = root->parse->dijkstraTopology;
+			topology_weight = DatumGetFloat8(((Const *) tle->expr)->constvalue);
+		}
+	}
 
 	plan = make_dijkstra(root, build_path_tlist(root, &best_path->path),
 						 subplan, best_path->weight, best_path->weight_out,
 						 end_id, edge_id, best_path->source,
-						 best_path->target, best_path->limit);
+						 best_path->target, best_path->limit,
+						 best_path->loopless, heuristic, topology,
+						 root->parse->dijkstraReverse, topology_weight);
+
+	copy_generic_path_info(&plan->plan, &best_path->path);
+
+	return plan;
+}
+
+static Shortestpath *
+create_shortestpath_plan(PlannerInfo *root, ShortestpathPath *best_path)
+{
+	Shortestpath *plan;
+	Plan	   *subplan;
+	List	   *sub_tlist;
+	TargetEntry *tle;
+	AttrNumber	end_id;
+	AttrNumber	edge_id;
+
+	subplan = create_plan_recurse(root, best_path->subpath, CP_EXACT_TLIST);
+
+	sub_tlist = subplan->targetlist;
+	tle = tlist_member((Expr *) best_path->end_id, sub_tlist);
+	end_id = tle->resno;
+	tle = tlist_member((Expr *) best_path->edge_id, sub_tlist);
+	edge_id = tle->resno;
+
+	plan = make_shortestpath(root, build_path_tlist(root, &best_path->path),
+							 subplan, end_id, edge_id, best_path->source,
+							 best_path->target, best_path->min_hops,
+							 best_path->max_hops, best_path->all_paths);
 
 	copy_generic_path_info(&plan->plan, &best_path->path);
 
@@ -5457,7 +5603,10 @@ make_nestloop(List *tlist,
 			  JoinType jointype,
 			  bool inner_unique,
 			  int minhops,
-			  int maxhops)
+			  int maxhops,
+			  bool skipids,
+			  bool skipedges,
+			  Oid graphoid)
 {
 	NestLoop   *node;
 	Plan	   *plan;
@@ -5468,6 +5617,9 @@ make_nestloop(List *tlist,
 
 		vle->minHops = minhops;
 		vle->maxHops = maxhops;
+		vle->skipIds = skipids;
+		vle->skipEdges = skipedges;
+		vle->graphOid = graphoid;
 		node = &vle->nl;
 	}
 	else
@@ -6740,7 +6892,9 @@ make_modifygraph(PlannerInfo *root, GraphWriteOp operation, bool canSetTag,
 Dijkstra *
 make_dijkstra(PlannerInfo *root, List *tlist, Plan *lefttree,
 			  AttrNumber weight, bool weight_out, AttrNumber end_id,
-			  AttrNumber edge_id, Node *source, Node *target, Node *limit)
+			  AttrNumber edge_id, Node *source, Node *target, Node *limit,
+			  bool loopless, AttrNumber heuristic, Oid topology,
+			  bool topology_reverse, double topology_weight)
 {
 	Dijkstra *node = makeNode(Dijkstra);
 	Plan	   *plan = &node->plan;
@@ -6752,6 +6906,35 @@ make_dijkstra(PlannerInfo *root, List *tlist, Plan *lefttree,
 	node->source = source;
 	node->target = target;
 	node->limit = limit;
+	node->loopless = loopless;
+	node->heuristic = heuristic;
+	node->topology = topology;
+	node->topology_reverse = topology_reverse;
+	node->topology_weight = topology_weight;
+
+	plan->qual = NIL;
+	plan->targetlist = tlist;
+	plan->lefttree = lefttree;
+	plan->righttree = NULL;
+
+	return node;
+}
+
+Shortestpath *
+make_shortestpath(PlannerInfo *root, List *tlist, Plan *lefttree,
+				  AttrNumber end_id, AttrNumber edge_id, Node *source,
+				  Node *target, int min_hops, int max_hops, bool all_paths)
+{
+	Shortestpath *node = makeNode(Shortestpath);
+	Plan	   *plan = &node->plan;
+
+	node->end_id = end_id;
+	node->edge_id = edge_id;
+	node->source = source;
+	node->target = target;
+	node->min_hops = min_hops;
+	node->max_hops = max_hops;
+	node->all_paths = all_paths;
 
 	plan->qual = NIL;
 	plan->targetlist = tlist;
@@ -173,6 +173,15 @@ build_base_rel_tlists(PlannerInfo *root, List *final_tlist)
 
 	if (root->parse->dijkstraEdgeId)
 		add_extra_vars_to_targetlist(root, root->parse->dijkstraEdgeId);
+
+	if (root->parse->dijkstraHeuristic)
+		add_extra_vars_to_targetlist(root, root->parse->dijkstraHeuristic);
+
+	if (root->parse->shortestpathEndId)
+		add_extra_vars_to_targetlist(root, root->parse->shortestpathEndId);
+
+	if (root->parse->shortestpathEdgeId)
+		add_extra_vars_to_targetlist(root, root->parse->shortestpathEdgeId);
 }
 
 static void
@@ -1018,6 +1027,9 @@ deconstruct_recurse(PlannerInfo *root, Node *jtnode, bool below_outer_join,
 				ojscope = NULL;
 				sjinfo->min_hops = j->minHops;
 				sjinfo->max_hops = j->maxHops;
+				sjinfo->skip_ids = j->skipIds;
+				sjinfo->skip_edges = j->skipEdges;
+				sjinfo->graph_oid = j->graphOid;
 			}
 			else
 			{
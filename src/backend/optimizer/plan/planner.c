@@ -18,6 +18,7 @@
 #include <limits.h>
 #include <math.h>
 
+#include "ag_const.h"
 #include "access/htup_details.h"
 #include "access/parallel.h"
 #include "access/sysattr.h"
@@ -53,6 +54,7 @@
 #include "parser/parse_agg.h"
 #include "rewrite/rewriteManip.h"
 #include "storage/dsm_impl.h"
+#include "utils/builtins.h"
 #include "utils/rel.h"
 #include "utils/selfuncs.h"
 #include "utils/lsyscache.h"
@@ -114,6 +116,9 @@ static Node *preprocess_expression(PlannerInfo *root, Node *expr, int kind);
 static void preprocess_qual_conditions(PlannerInfo *root, Node *jtnode);
 static void preprocess_graph_pattern(PlannerInfo *root, List *pattern);
 static void preprocess_graph_sets(PlannerInfo *root, List *sets);
+static bool contain_cypher_access_walker(Node *node, void *context);
+static Node *replace_prop_column_mutator(Node *node, PlannerInfo *root);
+static Var *find_prop_column(PlannerInfo *root, CypherAccessExpr *a);
 static void inheritance_planner(PlannerInfo *root);
 static void grouping_planner(PlannerInfo *root, bool inheritance_update,
 				 double tuple_fraction);
@@ -177,11 +182,16 @@ static RelOptInfo *create_dijkstra_paths(PlannerInfo *root,
 										 int weight, bool weight_out,
 										 Node *end_id, Node *egde_id,
 										 Node *source, Node *target,
-										 Node *limit);
+										 Node *limit, bool loopless,
+										 Node *heuristic);
+static RelOptInfo *create_shortestpath_paths(PlannerInfo *root,
+											 RelOptInfo *input_rel,
+											 PathTarget *path_target);
 static PathTarget *make_group_input_target(PlannerInfo *root,
 						PathTarget *final_target);
 static PathTarget *make_dijkstra_input_target(PlannerInfo *root,
 											  PathTarget *final_target);
+static PathTarget *make_shortestpath_input_target(PlannerInfo *root);
 static PathTarget *make_partial_grouping_target(PlannerInfo *root,
 							 PathTarget *grouping_target);
 static List *postprocess_setop_tlist(List *new_tlist, List *orig_tlist);
@@ -541,6 +551,8 @@ subquery_planner(PlannerGlobal *glob, Query *parse,
 	root->non_recursive_path = NULL;
 	root->max_hoop = DEFAULT_RECURSIVEUNION_RTERM_ITER_CNT;
 	root->hasVLEJoinRTE = (parent_root ? parent_root->hasVLEJoinRTE : false);
+	root->hasGraphTraversal = (parent_root ?
+							   parent_root->hasGraphTraversal : false);
 
 	/*
 	 * If there is a WITH list, process each WITH query and build an initplan
@@ -605,6 +617,9 @@ subquery_planner(PlannerGlobal *glob, Query *parse,
 		if (rte->lateral)
 			root->hasLateralRTEs = true;
 	}
+	if (root->hasVLEJoinRTE || parse->dijkstraSource ||
+		parse->shortestpathSource)
+		root->hasGraphTraversal = true;
 
 	/*
 	 * Preprocess RowMark information.  We need to do this after subquery
@@ -884,6 +899,25 @@ subquery_planner(PlannerGlobal *glob, Query *parse,
 		parse->dijkstraLimit = preprocess_expression(root,
 													 parse->dijkstraLimit,
 													 EXPRKIND_TARGET);
+		parse->dijkstraHeuristic =
+			preprocess_expression(root, parse->dijkstraHeuristic,
+								  EXPRKIND_TARGET);
+	}
+
+	if (parse->shortestpathSource)
+	{
+		parse->shortestpathEndId = preprocess_expression(root,
+												parse->shortestpathEndId,
+												EXPRKIND_TARGET);
+		parse->shortestpathEdgeId = preprocess_expression(root,
+												parse->shortestpathEdgeId,
+												EXPRKIND_TARGET);
+		parse->shortestpathSource = preprocess_expression(root,
+												parse->shortestpathSource,
+												EXPRKIND_TARGET);
+		parse->shortestpathTarget = preprocess_expression(root,
+												parse->shortestpathTarget,
+												EXPRKIND_TARGET);
 	}
 
 	/*
@@ -979,6 +1013,15 @@ preprocess_expression(PlannerInfo *root, Node *expr, int kind)
 	 */
 	expr = eval_const_expressions(root, expr);
 
+	/*
+	 * Read property keys that have their own property columns from the
+	 * columns instead of the property maps.  This must be done after
+	 * eval_const_expressions() which reduces accesses to vertices/edges to
+	 * accesses to their property map columns.
+	 */
+	if (contain_cypher_access_walker(expr, NULL))
+		expr = replace_prop_column_mutator(expr, root);
+
 	/*
 	 * If it's a qual or havingQual, canonicalize it.
 	 */
@@ -1102,6 +1145,91 @@ preprocess_graph_sets(PlannerInfo *root, List *sets)
 	}
 }
 
+static bool
+contain_cypher_access_walker(Node *node, void *context)
+{
+	if (node == NULL)
+		return false;
+	if (IsA(node, CypherAccessExpr))
+		return true;
+	return expression_tree_walker(node, contain_cypher_access_walker,
+								  context);
+}
+
+static Node *
+replace_prop_column_mutator(Node *node, PlannerInfo *root)
+{
+	if (node == NULL)
+		return NULL;
+
+	if (IsA(node, CypherAccessExpr))
+	{
+		CypherAccessExpr *a = (CypherAccessExpr *) node;
+		Var		   *col;
+
+		col = find_prop_column(root, a);
+		if (col != NULL)
+		{
+			CypherAccessExpr *newa;
+
+			if (list_length(a->path) == 1)
+				return (Node *) col;
+
+			/* access the rest of the path on the column */
+			newa = makeNode(CypherAccessExpr);
+			newa->arg = (Expr *) col;
+			newa->path = (List *) replace_prop_column_mutator(
+										(Node *) list_copy_tail(a->path, 1),
+										root);
+			return (Node *) newa;
+		}
+	}
+
+	return expression_tree_mutator(node, replace_prop_column_mutator,
+								   (void *) root);
+}
+
+/*
+ * Return a Var for the property column of the first key in the path of `a`
+ * if `a` accesses the property map of a graph label having the column.
+ * See makePropColumnElements().
+ */
+static Var *
+find_prop_column(PlannerInfo *root, CypherAccessExpr *a)
+{
+	Var		   *var;
+	Const	   *key;
+	RangeTblEntry *rte;
+	AttrNumber	attnum;
+
+	if (!IsA(a->arg, Var))
+		return NULL;
+	var = (Var *) a->arg;
+	if (var->varlevelsup != 0 || var->vartype != JSONBOID)
+		return NULL;
+
+	key = linitial(a->path);
+	if (!IsA(key, Const) || key->consttype != TEXTOID || key->constisnull)
+		return NULL;
+
+	rte = rt_fetch(var->varno, root->parse->rtable);
+	if (rte->rtekind != RTE_RELATION || get_relid_labid(rte->relid) < 0)
+		return NULL;
+
+	if (var->varattno != get_attnum(rte->relid, AG_ELEM_PROP_MAP))
+		return NULL;
+
+	/* property columns follow the property map column */
+	attnum = get_attnum(rte->relid, TextDatumGetCString(key->constvalue));
+	if (attnum <= var->varattno || get_atttype(rte->relid, attnum) != JSONBOID)
+		return NULL;
+
+	var = makeVar(var->varno, attnum, JSONBOID, -1, InvalidOid, 0);
+	var->location = exprLocation((Node *) a);
+
+	return var;
+}
+
 /*
  * preprocess_phv_expression
  *	  Do preprocessing on a PlaceHolderVar expression that's been pulled up.
@@ -1849,6 +1977,12 @@ grouping_planner(PlannerInfo *root, bool inheritance_update,
 				   parse->sortClause == NIL && parse->distinctClause == NIL);
 			scanjoin_target = make_dijkstra_input_target(root, final_target);
 		}
+		else if (parse->shortestpathSource)
+		{
+			Assert(!have_grouping && activeWindows == NIL &&
+				   parse->sortClause == NIL && parse->distinctClause == NIL);
+			scanjoin_target = make_shortestpath_input_target(root);
+		}
 
 		/*
 		 * If there are any SRFs in the targetlist, we must separate each of
@@ -2064,7 +2198,14 @@ grouping_planner(PlannerInfo *root, bool inheritance_update,
 											parse->dijkstraEdgeId,
 											parse->dijkstraSource,
 											parse->dijkstraTarget,
-											parse->dijkstraLimit);
+											parse->dijkstraLimit,
+											parse->dijkstraLoopless,
+											parse->dijkstraHeuristic);
+	}
+	else if (parse->shortestpathSource)
+	{
+		current_rel = create_shortestpath_paths(root, current_rel,
+												final_target);
 	}
 
 	/*
@@ -5159,14 +5300,29 @@ static RelOptInfo *
 create_dijkstra_paths(PlannerInfo *root, RelOptInfo *input_rel,
 					  PathTarget *path_target, int weight, bool weight_out,
 					  Node *end_id, Node *edge_id, Node *source,
-					  Node *target, Node *limit)
+					  Node *target, Node *limit, bool loopless,
+					  Node *heuristic)
 {
 	RelOptInfo *dijkstra_rel;
 	ListCell   *lc;
 
 	dijkstra_rel = fetch_upper_rel(root, UPPERREL_DIJKSTRA, NULL);
 
-	dijkstra_rel->consider_parallel = false;
+	/*
+	 * Dijkstra keeps its whole state in the backend that runs it, so it can
+	 * run inside a worker as long as its input and expressions can.  Many
+	 * sources are then searched in parallel by the workers that scan the
+	 * sources in the outer query.
+	 */
+	if (input_rel->consider_parallel &&
+		is_parallel_safe(root, (Node *) path_target->exprs) &&
+		is_parallel_safe(root, end_id) &&
+		is_parallel_safe(root, edge_id) &&
+		is_parallel_safe(root, source) &&
+		is_parallel_safe(root, target) &&
+		is_parallel_safe(root, limit) &&
+		is_parallel_safe(root, heuristic))
+		dijkstra_rel->consider_parallel = true;
 
 	/*
 	 * If the input rel belongs to a single FDW, so does the ordered_rel.
@@ -5183,7 +5339,7 @@ create_dijkstra_paths(PlannerInfo *root, RelOptInfo *input_rel,
 		path = (Path *) create_dijkstra_path(root, dijkstra_rel, path,
 											 path_target, weight, weight_out,
 											 end_id, edge_id, source, target,
-											 limit);
+											 limit, loopless, heuristic);
 		add_path(dijkstra_rel, path);
 	}
 
@@ -5210,6 +5366,71 @@ create_dijkstra_paths(PlannerInfo *root, RelOptInfo *input_rel,
 	return dijkstra_rel;
 }
 
+static RelOptInfo *
+create_shortestpath_paths(PlannerInfo *root, RelOptInfo *input_rel,
+						  PathTarget *path_target)
+{
+	Query	   *parse = root->parse;
+	RelOptInfo *sp_rel;
+	ListCell   *lc;
+
+	sp_rel = fetch_upper_rel(root, UPPERREL_SHORTESTPATH, NULL);
+
+	/* See create_dijkstra_paths() */
+	if (input_rel->consider_parallel &&
+		is_parallel_safe(root, (Node *) path_target->exprs) &&
+		is_parallel_safe(root, parse->shortestpathEndId) &&
+		is_parallel_safe(root, parse->shortestpathEdgeId) &&
+		is_parallel_safe(root, parse->shortestpathSource) &&
+		is_parallel_safe(root, parse->shortestpathTarget))
+		sp_rel->consider_parallel = true;
+
+	/*
+	 * If the input rel belongs to a single FDW, so does the sp_rel.
+	 */
+	sp_rel->serverid = input_rel->serverid;
+	sp_rel->userid = input_rel->userid;
+	sp_rel->useridiscurrent = input_rel->useridiscurrent;
+	sp_rel->fdwroutine = input_rel->fdwroutine;
+
+	foreach(lc, input_rel->pathlist)
+	{
+		Path	   *path = (Path *) lfirst(lc);
+
+		path = (Path *) create_shortestpath_path(root, sp_rel, path,
+												 path_target,
+												 parse->shortestpathEndId,
+												 parse->shortestpathEdgeId,
+												 parse->shortestpathSource,
+												 parse->shortestpathTarget,
+												 parse->shortestpathMinHops,
+												 parse->shortestpathMaxHops,
+												 parse->shortestpathAll);
+		add_path(sp_rel, path);
+	}
+
+	/*
+	 * If there is an FDW that's responsible for all baserels of the query,
+	 * let it consider adding ForeignPaths.
+	 */
+	if (sp_rel->fdwroutine && sp_rel->fdwroutine->GetForeignUpperPaths)
+		sp_rel->fdwroutine->GetForeignUpperPaths(root, UPPERREL_SHORTESTPATH,
+												 input_rel, sp_rel);
+
+	/* Let extensions possibly add some more paths */
+	if (create_upper_paths_hook)
+		(*create_upper_paths_hook) (root, UPPERREL_SHORTESTPATH,
+									input_rel, sp_rel);
+
+	/*
+	 * No need to bother with set_cheapest here; grouping_planner does not
+	 * need us to do it.
+	 */
+	Assert(sp_rel->pathlist != NIL);
+
+	return sp_rel;
+}
+
 /*
  * make_group_input_target
  *	  Generate appropriate PathTarget for initial input to grouping nodes.
@@ -5326,6 +5547,31 @@ make_dijkstra_input_target(PlannerInfo *root, PathTarget *final_target)
 								 (Expr *) llast(final_target->exprs));
 	add_new_column_to_pathtarget(input_target, (Expr *) parse->dijkstraEndId);
 	add_new_column_to_pathtarget(input_target, (Expr *) parse->dijkstraEdgeId);
+	if (parse->dijkstraHeuristic)
+		add_new_column_to_pathtarget(input_target,
+									 (Expr *) parse->dijkstraHeuristic);
+
+	/* XXX this causes some redundant cost calculation ... */
+	return set_pathtarget_cost_width(root, input_target);
+}
+
+/*
+ * make_shortestpath_input_target
+ *	  Generate appropriate PathTarget for the edges to expand the searches of
+ *	  Shortestpath node. The output of the node is built by the node itself.
+ */
+static PathTarget *
+make_shortestpath_input_target(PlannerInfo *root)
+{
+	Query	   *parse = root->parse;
+	PathTarget *input_target;
+
+	input_target = create_empty_pathtarget();
+
+	add_new_column_to_pathtarget(input_target,
+								 (Expr *) parse->shortestpathEndId);
+	add_new_column_to_pathtarget(input_target,
+								 (Expr *) parse->shortestpathEdgeId);
 
 	/* XXX this causes some redundant cost calculation ... */
 	return set_pathtarget_cost_width(root, input_target);
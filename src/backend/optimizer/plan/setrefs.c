@@ -99,6 +99,8 @@ static void set_foreignscan_references(PlannerInfo *root,
 static void set_customscan_references(PlannerInfo *root,
 						  CustomScan *cscan,
 						  int rtoffset);
+static void set_shortestpath_references(PlannerInfo *root, Plan *plan,
+							int rtoffset);
 static void set_dijkstra_references(PlannerInfo *root,
 							Plan *plan,
 							int rtoffset);
@@ -915,6 +917,8 @@ set_plan_refs(PlannerInfo *root, Plan *plan, int rtoffset)
 				 */
 				set_dummy_tlist_references(plan, rtoffset);
 				Assert(splan->plan.qual == NIL);
+				splan->labid_expr = (Expr *)
+					fix_scan_expr(root, (Node *) splan->labid_expr, rtoffset);
 				foreach(l, splan->partitioned_rels)
 				{
 					lfirst_int(l) += rtoffset;
@@ -994,6 +998,9 @@ set_plan_refs(PlannerInfo *root, Plan *plan, int rtoffset)
 		case T_Dijkstra:
 			set_dijkstra_references(root, plan, rtoffset);
 			break;
+		case T_Shortestpath:
+			set_shortestpath_references(root, plan, rtoffset);
+			break;
 		default:
 			elog(ERROR, "unrecognized node type: %d",
 				 (int) nodeTag(plan));
@@ -1355,6 +1362,22 @@ set_dijkstra_references(PlannerInfo *root, Plan *plan, int rtoffset)
 									 OUTER_VAR, rtoffset);
 }
 
+static void
+set_shortestpath_references(PlannerInfo *root, Plan *plan, int rtoffset)
+{
+	Plan	   *subplan = plan->lefttree;
+	Shortestpath *sp = (Shortestpath *) plan;
+	indexed_tlist *subplan_itlist;
+
+	set_upper_references(root, plan, rtoffset);
+
+	subplan_itlist = build_tlist_index(subplan->targetlist);
+	sp->source = fix_upper_expr(root, sp->source, subplan_itlist,
+								OUTER_VAR, rtoffset);
+	sp->target = fix_upper_expr(root, sp->target, subplan_itlist,
+								OUTER_VAR, rtoffset);
+}
+
 /*
  * copyVar
  *		Copy a Var node.
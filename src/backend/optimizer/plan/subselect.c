@@ -2573,6 +2573,8 @@ finalize_plan(PlannerInfo *root, Plan *plan,
 			{
 				ListCell   *l;
 
+				finalize_primnode((Node *) ((Append *) plan)->labid_expr,
+								  &context);
 				foreach(l, ((Append *) plan)->appendplans)
 				{
 					context.paramids =
@@ -2828,6 +2830,11 @@ finalize_plan(PlannerInfo *root, Plan *plan,
 			finalize_primnode(((Dijkstra *) plan)->limit, &context);
 			break;
 
+		case T_Shortestpath:
+			finalize_primnode(((Shortestpath *) plan)->source, &context);
+			finalize_primnode(((Shortestpath *) plan)->target, &context);
+			break;
+
 		default:
 			elog(ERROR, "unrecognized node type: %d",
 				 (int) nodeTag(plan));
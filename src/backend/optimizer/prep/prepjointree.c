@@ -1112,6 +1112,20 @@ pull_up_simple_subquery(PlannerInfo *root, Node *jtnode, RangeTblEntry *rte,
 													&rvcontext);
 		parse->dijkstraLimit = pullup_replace_vars(parse->dijkstraLimit,
 												   &rvcontext);
+		parse->dijkstraHeuristic =
+			pullup_replace_vars(parse->dijkstraHeuristic, &rvcontext);
+	}
+
+	if (parse->shortestpathSource)
+	{
+		parse->shortestpathEndId =
+			pullup_replace_vars(parse->shortestpathEndId, &rvcontext);
+		parse->shortestpathEdgeId =
+			pullup_replace_vars(parse->shortestpathEdgeId, &rvcontext);
+		parse->shortestpathSource =
+			pullup_replace_vars(parse->shortestpathSource, &rvcontext);
+		parse->shortestpathTarget =
+			pullup_replace_vars(parse->shortestpathTarget, &rvcontext);
 	}
 
 	/*
@@ -1505,7 +1519,8 @@ is_simple_subquery(Query *subquery, RangeTblEntry *rte,
 		subquery->limitCount ||
 		subquery->hasForUpdate ||
 		subquery->cteList ||
-		subquery->dijkstraSource)
+		subquery->dijkstraSource ||
+		subquery->shortestpathSource)
 		return false;
 
 	/*
@@ -1087,6 +1087,8 @@ bool
 is_parallel_safe(PlannerInfo *root, Node *node)
 {
 	max_parallel_hazard_context context;
+	PlannerInfo *proot;
+	ListCell   *l;
 
 	/*
 	 * Even if the original querytree contained nothing unsafe, we need to
@@ -1101,6 +1103,28 @@ is_parallel_safe(PlannerInfo *root, Node *node)
 	context.max_hazard = PROPARALLEL_SAFE;
 	context.max_interesting = PROPARALLEL_RESTRICTED;
 	context.safe_param_ids = NIL;
+
+	/*
+	 * The Params that a graph traversal gets from the query levels above it
+	 * are set by the nestloop or the traversal node that rescans it.  We never
+	 * scan its relations in parallel (see set_rel_consider_parallel()), so
+	 * such Params are always set in the process that evaluates them.  Params
+	 * of the levels above the query that contains the traversal might be set
+	 * outside of a worker, so they are not considered here.
+	 */
+	for (proot = root;
+		 proot->hasGraphTraversal && proot->parent_root != NULL;
+		 proot = proot->parent_root)
+	{
+		foreach(l, proot->parent_root->plan_params)
+		{
+			PlannerParamItem *pitem = (PlannerParamItem *) lfirst(l);
+
+			context.safe_param_ids = lappend_int(context.safe_param_ids,
+												 pitem->paramId);
+		}
+	}
+
 	return !max_parallel_hazard_walker(node, &context);
 }
 
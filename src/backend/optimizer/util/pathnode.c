@@ -2124,6 +2124,9 @@ create_nestloop_path(PlannerInfo *root,
 	pathnode->joinrestrictinfo = restrict_clauses;
 	pathnode->minhops = extra->sjinfo->min_hops;
 	pathnode->maxhops = extra->sjinfo->max_hops;
+	pathnode->skipids = extra->sjinfo->skip_ids;
+	pathnode->skipedges = extra->sjinfo->skip_edges;
+	pathnode->graphoid = extra->sjinfo->graph_oid;
 
 	final_cost_nestloop(root, pathnode, workspace, extra);
 
@@ -3502,7 +3505,8 @@ create_dijkstra_path(PlannerInfo *root,
 					 PathTarget *path_target,
 					 int weight, bool weight_out,
 					 Node *end_id, Node *edge_id,
-					 Node *source, Node *target, Node *limit)
+					 Node *source, Node *target, Node *limit,
+					 bool loopless, Node *heuristic)
 {
 	DijkstraPath *pathnode = makeNode(DijkstraPath);
 
@@ -3525,8 +3529,10 @@ create_dijkstra_path(PlannerInfo *root,
 	pathnode->source = source;
 	pathnode->target = target;
 	pathnode->limit = limit;
+	pathnode->loopless = loopless;
+	pathnode->heuristic = heuristic;
 
-	cost_dijkstra(&pathnode->path, subpath->startup_cost,
+	cost_dijkstra(&pathnode->path, root, subpath->startup_cost,
 				  subpath->total_cost, subpath->rows,
 				  subpath->pathtarget->width);
 
@@ -3537,3 +3543,46 @@ create_dijkstra_path(PlannerInfo *root,
 
 	return pathnode;
 }
+
+ShortestpathPath *
+create_shortestpath_path(PlannerInfo *root,
+						 RelOptInfo *rel,
+						 Path *subpath,
+						 PathTarget *path_target,
+						 Node *end_id, Node *edge_id,
+						 Node *source, Node *target,
+						 int min_hops, int max_hops, bool all_paths)
+{
+	ShortestpathPath *pathnode = makeNode(ShortestpathPath);
+
+	pathnode->path.pathtype = T_Shortestpath;
+	pathnode->path.parent = rel;
+	pathnode->path.pathtarget = path_target;
+	/* For now, assume we are above any joins, so no parameterization */
+	pathnode->path.param_info = NULL;
+	pathnode->path.parallel_aware = false;
+	pathnode->path.parallel_safe = rel->consider_parallel &&
+		subpath->parallel_safe;
+	pathnode->path.parallel_workers = subpath->parallel_workers;
+	/* paths are returned in no particular order */
+	pathnode->path.pathkeys = NIL;
+
+	pathnode->subpath = subpath;
+	pathnode->end_id = end_id;
+	pathnode->edge_id = edge_id;
+	pathnode->source = source;
+	pathnode->target = target;
+	pathnode->min_hops = min_hops;
+	pathnode->max_hops = max_hops;
+	pathnode->all_paths = all_paths;
+
+	cost_shortestpath(&pathnode->path, root, subpath->startup_cost,
+					  subpath->total_cost, subpath->rows, all_paths);
+
+	/* add tlist eval cost for each output row */
+	pathnode->path.startup_cost += path_target->cost.startup;
+	pathnode->path.total_cost += path_target->cost.startup +
+		path_target->cost.per_tuple * pathnode->path.rows;
+
+	return pathnode;
+}
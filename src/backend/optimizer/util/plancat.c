@@ -17,6 +17,7 @@
 
 #include <math.h>
 
+#include "ag_const.h"
 #include "access/genam.h"
 #include "access/heapam.h"
 #include "access/htup_details.h"
@@ -29,6 +30,7 @@
 #include "catalog/heap.h"
 #include "catalog/partition.h"
 #include "catalog/pg_am.h"
+#include "catalog/pg_operator.h"
 #include "catalog/pg_statistic_ext.h"
 #include "foreign/fdwapi.h"
 #include "miscadmin.h"
@@ -38,12 +40,14 @@
 #include "optimizer/plancat.h"
 #include "optimizer/predtest.h"
 #include "optimizer/prep.h"
+#include "optimizer/var.h"
 #include "parser/parse_relation.h"
 #include "parser/parsetree.h"
 #include "rewrite/rewriteManip.h"
 #include "statistics/statistics.h"
 #include "storage/bufmgr.h"
 #include "utils/builtins.h"
+#include "utils/graph.h"
 #include "utils/lsyscache.h"
 #include "utils/syscache.h"
 #include "utils/rel.h"
@@ -1444,6 +1448,104 @@ relation_excluded_by_constraints(PlannerInfo *root,
 	return false;
 }
 
+/*
+ * relation_excluded_by_labid
+ *
+ * Detect whether the label need not be scanned because its id column is
+ * restricted to a constant graphid of another label.  Graphid has the label
+ * ID in it, so no row of the label can match.
+ *
+ * Nothing keeps a graphid of another label from being stored in the id
+ * column, so this is trusted as much as CHECK constraints are, and is
+ * controlled by constraint_exclusion in the same way.
+ */
+bool
+relation_excluded_by_labid(PlannerInfo *root, RelOptInfo *rel,
+						   RangeTblEntry *rte)
+{
+	int32		labid;
+	AttrNumber	id_attno;
+	ListCell   *lc;
+
+	/* an inheritance parent stands for the labels under it too */
+	if (rte->rtekind != RTE_RELATION || rte->inh ||
+		rel->baserestrictinfo == NIL)
+		return false;
+
+	/* see relation_excluded_by_constraints() */
+	if (constraint_exclusion == CONSTRAINT_EXCLUSION_OFF ||
+		(constraint_exclusion == CONSTRAINT_EXCLUSION_PARTITION &&
+		 !(rel->reloptkind == RELOPT_OTHER_MEMBER_REL ||
+		   (root->hasInheritedTarget &&
+			rel->reloptkind == RELOPT_BASEREL &&
+			rel->relid == root->parse->resultRelation))))
+		return false;
+
+	labid = get_relid_labid(rte->relid);
+	if (labid < 0)
+		return false;
+
+	id_attno = get_attnum(rte->relid, AG_ELEM_ID);
+	if (id_attno == InvalidAttrNumber)
+		return false;
+
+	foreach(lc, rel->baserestrictinfo)
+	{
+		RestrictInfo *rinfo = (RestrictInfo *) lfirst(lc);
+		Expr	   *probe;
+
+		probe = label_id_probe(rinfo->clause, rel->relid, id_attno);
+		if (probe == NULL || !IsA(probe, Const) || ((Const *) probe)->constisnull)
+			continue;
+
+		if (GraphidGetLabid(DatumGetGraphid(((Const *) probe)->constvalue)) !=
+			labid)
+			return true;
+	}
+
+	return false;
+}
+
+/*
+ * label_id_probe
+ *
+ * If the clause is "id = expr" on the id column of the label at varno, return
+ * the expression compared with the id.  Otherwise, return NULL.
+ */
+Expr *
+label_id_probe(Expr *clause, Index varno, AttrNumber id_attno)
+{
+	OpExpr	   *opexpr;
+	Node	   *leftop;
+	Node	   *rightop;
+
+	if (!is_opclause(clause))
+		return NULL;
+
+	opexpr = (OpExpr *) clause;
+	if (opexpr->opno != OID_GRAPHID_EQ_OP || list_length(opexpr->args) != 2)
+		return NULL;
+
+	leftop = get_leftop(clause);
+	rightop = get_rightop(clause);
+
+	if (IsA(leftop, Var) &&
+		((Var *) leftop)->varno == varno &&
+		((Var *) leftop)->varattno == id_attno &&
+		((Var *) leftop)->varlevelsup == 0 &&
+		!bms_is_member(varno, pull_varnos(rightop)))
+		return (Expr *) rightop;
+
+	if (IsA(rightop, Var) &&
+		((Var *) rightop)->varno == varno &&
+		((Var *) rightop)->varattno == id_attno &&
+		((Var *) rightop)->varlevelsup == 0 &&
+		!bms_is_member(varno, pull_varnos(leftop)))
+		return (Expr *) leftop;
+
+	return NULL;
+}
+
 
 /*
  * build_physical_tlist
@@ -636,7 +636,7 @@ static List *preserve_downcasing_type_func_namelist(List *namelist);
 %type <list>	cypher_expr_indir_opt
 
 %type <list>	cypher_pattern cypher_anon_pattern
-				cypher_path cypher_path_chain
+				cypher_path cypher_path_chain cypher_dijkstra_heuristic_opt
 				cypher_types cypher_types_opt
 %type <node>	cypher_pattern_part cypher_pattern_var cypher_anon_pattern_part
 				cypher_shortestpath cypher_dijkstra
@@ -645,7 +645,7 @@ static List *preserve_downcasing_type_func_namelist(List *namelist);
 				cypher_varlen_opt cypher_range_opt cypher_range_idx
 				cypher_range_idx_opt cypher_prop_map_opt
 %type <str>		cypher_pattern_varname cypher_labelname
-%type <boolean>	cypher_rel_left cypher_rel_right
+%type <boolean>	cypher_rel_left cypher_rel_right cypher_dijkstra_loopless_opt
 
 %type <node>	cypher_return cypher_with
 				cypher_skip_opt cypher_limit_opt cypher_where cypher_where_opt
@@ -727,7 +727,7 @@ static List *preserve_downcasing_type_func_namelist(List *namelist);
 
 	GENERATED GLOBAL GRANT GRANTED GRAPH GREATEST GROUP_P GROUPING
 
-	HANDLER HAVING HEADER_P HOLD HOUR_P
+	HANDLER HAVING HEADER_P HEURISTIC HOLD HOUR_P
 
 	IDENTITY_P IF_P ILIKE IMMEDIATE IMMUTABLE IMPLICIT_P IMPORT_P IN_P
 	INCLUDING INCREMENT INDEX INDEXES INHERIT INHERITS INITIALLY INLINE_P
@@ -740,7 +740,7 @@ static List *preserve_downcasing_type_func_namelist(List *namelist);
 
 	LABEL LANGUAGE LARGE_P LAST_P LATERAL_P
 	LEADING LEAKPROOF LEAST LEFT LEVEL LIKE LIMIT LISTEN LOAD LOCAL
-	LOCALTIME LOCALTIMESTAMP LOCATION LOCK_P LOCKED LOGGED
+	LOCALTIME LOCALTIMESTAMP LOCATION LOCK_P LOCKED LOGGED LOOPLESS
 
 	MAPPING MATCH MATERIALIZED MAXVALUE MERGE METHOD
 	MINUTE_P MINVALUE MODE MONTH_P MOVE
@@ -840,13 +840,14 @@ static List *preserve_downcasing_type_func_namelist(List *namelist);
  * blame any funny behavior of UNBOUNDED on the SQL standard, though.
  *
  * To support Cypher, the precedence of unreserved keywords,
- * ALLSHORTESTPATHS, DELETE_P, DETACH, DIJKSTRA, LOAD, OPTIONAL_P, REMOVE,
- * SHORTESTPATH, SIZE_P and SKIP must be the same as that of IDENT.
+ * ALLSHORTESTPATHS, DELETE_P, DETACH, DIJKSTRA, HEURISTIC, LOAD, LOOPLESS,
+ * OPTIONAL_P, REMOVE, SHORTESTPATH, SIZE_P and SKIP must be the same as that
+ * of IDENT.
  */
 %nonassoc	UNBOUNDED		/* ideally should have same precedence as IDENT */
 %nonassoc	IDENT GENERATED NULL_P PARTITION RANGE ROWS PRECEDING FOLLOWING CUBE ROLLUP
-			ALLSHORTESTPATHS DELETE_P DETACH DIJKSTRA LOAD OPTIONAL_P REMOVE
-			SHORTESTPATH SINGLE SIZE_P SKIP
+			ALLSHORTESTPATHS DELETE_P DETACH DIJKSTRA HEURISTIC LOAD LOOPLESS
+			OPTIONAL_P REMOVE SHORTESTPATH SINGLE SIZE_P SKIP
 %left		Op OPERATOR		/* multi-character ops and user-defined operators */
 %left		'+' '-'
 %left		'*' '/' '%'
@@ -14946,6 +14947,7 @@ unreserved_keyword:
 			| GRAPH
 			| HANDLER
 			| HEADER_P
+			| HEURISTIC
 			| HOLD
 			| HOUR_P
 			| IDENTITY_P
@@ -14981,6 +14983,7 @@ unreserved_keyword:
 			| LOCK_P
 			| LOCKED
 			| LOGGED
+			| LOOPLESS
 			| MAPPING
 			| MATERIALIZED
 			| MAXVALUE
@@ -16860,7 +16863,8 @@ cypher_shortestpath:
 		;
 
 cypher_dijkstra:
-			DIJKSTRA '(' cypher_path_chain ',' cypher_expr ')'
+			DIJKSTRA '(' cypher_path_chain ',' cypher_expr
+			cypher_dijkstra_heuristic_opt ')'
 				{
 					CypherPath *n;
 
@@ -16875,10 +16879,15 @@ cypher_dijkstra:
 					n->chain = $3;
 					n->weight = $5;
 					n->limit = makeIntConst(1, -1);
+					if ($6 != NIL)
+					{
+						n->heuristic_var = linitial($6);
+						n->heuristic = lsecond($6);
+					}
 					$$ = (Node *) n;
 				}
 			| DIJKSTRA '(' cypher_path_chain ','
-			cypher_expr ',' cypher_expr ')'
+			cypher_expr ',' cypher_expr cypher_dijkstra_heuristic_opt ')'
 				{
 					CypherPath *n;
 
@@ -16894,10 +16903,16 @@ cypher_dijkstra:
 					n->weight = $5;
 					n->qual = $7;
 					n->limit = makeIntConst(1, -1);
+					if ($8 != NIL)
+					{
+						n->heuristic_var = linitial($8);
+						n->heuristic = lsecond($8);
+					}
 					$$ = (Node *) n;
 				}
 			| DIJKSTRA '(' cypher_path_chain ','
-			cypher_expr ',' LIMIT cypher_expr ')'
+			cypher_expr ',' LIMIT cypher_expr cypher_dijkstra_loopless_opt
+			cypher_dijkstra_heuristic_opt ')'
 				{
 					CypherPath *n;
 
@@ -16912,10 +16927,17 @@ cypher_dijkstra:
 					n->chain = $3;
 					n->weight = $5;
 					n->limit = $8;
+					n->loopless = $9;
+					if ($10 != NIL)
+					{
+						n->heuristic_var = linitial($10);
+						n->heuristic = lsecond($10);
+					}
 					$$ = (Node *) n;
 				}
 			| DIJKSTRA '(' cypher_path_chain ','
-			cypher_expr ',' cypher_expr ',' LIMIT cypher_expr ')'
+			cypher_expr ',' cypher_expr ',' LIMIT cypher_expr
+			cypher_dijkstra_loopless_opt cypher_dijkstra_heuristic_opt ')'
 				{
 					CypherPath *n;
 
@@ -16931,10 +16953,36 @@ cypher_dijkstra:
 					n->weight = $5;
 					n->qual = $7;
 					n->limit = $10;
+					n->loopless = $11;
+					if ($12 != NIL)
+					{
+						n->heuristic_var = linitial($12);
+						n->heuristic = lsecond($12);
+					}
 					$$ = (Node *) n;
 				}
 		;
 
+cypher_dijkstra_loopless_opt:
+			LOOPLESS			{ $$ = true; }
+			| /* EMPTY */		{ $$ = false; }
+		;
+
+cypher_dijkstra_heuristic_opt:
+			',' HEURISTIC cypher_var Op cypher_expr
+					{
+						/* `|` is not a self token; the scanner returns Op */
+						if (strcmp($4, "|") != 0)
+							ereport(ERROR,
+									(errcode(ERRCODE_SYNTAX_ERROR),
+									 errmsg("syntax error at or near \"%s\"", $4),
+									 parser_errposition(@4)));
+						$$ = list_make2($3, $5);
+					}
+			| /* EMPTY */
+					{ $$ = NIL; }
+		;
+
 cypher_path_chain:
 			cypher_node
 					{ $$ = list_make1($1); }
@@ -15,7 +15,6 @@
 #include "access/sysattr.h"
 #include "catalog/ag_graph_fn.h"
 #include "catalog/ag_label.h"
-#include "catalog/pg_am.h"
 #include "catalog/pg_class.h"
 #include "catalog/pg_collation.h"
 #include "catalog/pg_inherits_fn.h"
@@ -48,7 +47,6 @@
 #include "utils/graph.h"
 #include "utils/lsyscache.h"
 #include "utils/rel.h"
-#include "utils/snapmgr.h"
 #include "utils/syscache.h"
 #include "utils/typcache.h"
 
@@ -62,8 +60,6 @@
 
 #define VLE_LEFT_ALIAS			"l"
 #define VLE_RIGHT_ALIAS			"r"
-#define VLE_COLNAME_IDS			"ids"
-#define VLE_COLNAME_EDGES		"edges"
 #define VLE_COLNAME_NEXT		"next"
 #define VLE_COLNAME_EDGE		"edge"
 
@@ -199,9 +195,6 @@ static Node *transformElemQuals(ParseState *pstate, Node *qual);
 static Node *transform_prop_constr(ParseState *pstate, Node *qual,
 								   Node *prop_map, Node *prop_constr);
 static void transform_prop_constr_worker(Node *node, prop_constr_context *ctx);
-static bool ginAvail(ParseState *pstate, Index varno, AttrNumber varattno);
-static Oid getSourceRelid(ParseState *pstate, Index varno, AttrNumber varattno);
-static bool hasGinOnProp(Oid relid);
 /* MATCH - future vertex */
 static void addFutureVertex(ParseState *pstate, AttrNumber varattno,
 							char *labname);
@@ -260,10 +253,7 @@ static RangeTblEntry *transformDeleteJoinRTE(ParseState *pstate,
 											 CypherClause *clause);
 static A_ArrayExpr *verticesAppend(A_ArrayExpr *vertices, Node *expr);
 static Node *verticesConcat(Node *vertices, Node *expr);
-static Node *makeSelectEdgesVertices(Node *vertices,
-									 CypherDeleteClause *delete,
-									 char **edges_resname);
-static Node *makeEdgesForDetach(void);
+static Node *makeSelectEdgesVertices(Node *vertices);
 static RangeFunction *makeUnnestVertices(Node *vertices);
 static BoolExpr *makeEdgesVertexQual(void);
 
@@ -733,24 +723,6 @@ transformCypherDeleteClause(ParseState *pstate, CypherClause *clause)
 											   EXPR_KIND_OTHER);
 	qry->graph.nr_modify = pstate->p_nr_modify_clause++;
 
-	/*
-	 * The edges of the vertices to remove are used only for removal,
-	 * not for the next clause.
-	 */
-	if (detail->detach)
-	{
-		TargetEntry *te;
-
-		/* This assumes the edge array always comes last. */
-		te = llast(qry->targetList);
-
-		Assert(pstate->p_delete_edges_resname != NULL);
-
-		if (strcmp(te->resname, pstate->p_delete_edges_resname) == 0)
-			te->resjunk = true;
-
-		pstate->p_delete_edges_resname = NULL;
-	}
 	qry->rtable = pstate->p_rtable;
 	qry->jointree = makeFromExpr(pstate->p_joinlist, NULL);
 
@@ -2083,21 +2055,21 @@ genVLESubselect(ParseState *pstate, CypherRel *crel, bool out)
  * CYPHER_REL_DIR_NONE
  *
  *     SELECT _start, _end, ARRAY[id] AS ids,
- *            ARRAY[(id, start, "end", properties, ctid)::edge] AS edges
+ *            ARRAY[(id, start, "end", NULL, ctid)::edge] AS edges
  *     FROM <edge label with additional _start and _end columns> AS l
  *     WHERE <outer vid> = _start AND l.properties @> ...)
  *
  * CYPHER_REL_DIR_LEFT
  *
  *     SELECT "end", start, ARRAY[id] AS ids,
- *            ARRAY[(id, start, "end", properties, ctid)::edge] AS edges
+ *            ARRAY[(id, start, "end", NULL, ctid)::edge] AS edges
  *     FROM <edge label (and its children)> AS l
  *     WHERE <outer vid> = "end" AND l.properties @> ...)
  *
  * CYPHER_REL_DIR_RIGHT
  *
  *     SELECT start, "end", ARRAY[id] AS ids,
- *            ARRAY[(id, start, "end", properties, ctid)::edge] AS edges
+ *            ARRAY[(id, start, "end", NULL, ctid)::edge] AS edges
  *     FROM <edge label (and its children)> AS l
  *     WHERE <outer vid> = start AND l.properties @> ...)
  *
@@ -2251,21 +2223,21 @@ genVLELeftChild(ParseState *pstate, CypherRel *crel, bool out)
  * CYPHER_REL_DIR_NONE
  *
  *     SELECT _end AS next, id,
- *            (id, start, "end", properties, ctid)::edge AS edge
+ *            (id, start, "end", NULL, ctid)::edge AS edge
  *     FROM <edge label with additional _start and _end columns> AS r
  *     WHERE l._end = r._start AND r.properties @> ...)
  *
  * CYPHER_REL_DIR_LEFT
  *
  *     SELECT start AS next, id,
- *            (id, start, "end", properties, ctid)::edge AS edge
+ *            (id, start, "end", NULL, ctid)::edge AS edge
  *     FROM <edge label (and its children)> AS r
  *     WHERE l.start = r.end AND r.properties @> ...)
  *
  * CYPHER_REL_DIR_RIGHT
  *
  *     SELECT "end" AS next, id,
- *            (id, start, "end", properties, ctid)::edge AS edge
+ *            (id, start, "end", NULL, ctid)::edge AS edge
  *     FROM <edge label (and its children)> AS r
  *     WHERE l.end = r.start AND r.properties @> ...)
  */
@@ -2324,13 +2296,18 @@ genVLERightChild(ParseState *pstate, CypherRel *crel, bool out)
 	return (Node *) sub;
 }
 
+/*
+ * Edges that VLE subqueries scan are compact; their property maps are left
+ * NULL so that they are not copied at each hop.  NestLoopVLE fills them in
+ * when it builds the edges column (see fillEdges()).
+ */
 static Node *
 genEdgeSimple(void)
 {
 	Node	   *id;
 	Node	   *start;
 	Node	   *end;
-	Node	   *prop_map;
+	TypeCast   *prop_map;
 	Node	   *tid;
 	RowExpr	   *row;
 	TypeCast   *edge;
@@ -2338,7 +2315,10 @@ genEdgeSimple(void)
 	id = makeColumnRef(genQualifiedName(NULL, AG_ELEM_LOCAL_ID));
 	start = makeColumnRef(genQualifiedName(NULL, AG_START_ID));
 	end = makeColumnRef(genQualifiedName(NULL, AG_END_ID));
-	prop_map = makeColumnRef(genQualifiedName(NULL, AG_ELEM_PROP_MAP));
+	prop_map = makeNode(TypeCast);
+	prop_map->arg = (Node *) makeNullAConst();
+	prop_map->typeName = makeTypeName("jsonb");
+	prop_map->location = -1;
 	tid = makeColumnRef(genQualifiedName(NULL, "ctid"));
 
 	row = makeNode(RowExpr);
@@ -2446,6 +2426,7 @@ genVLEJoinExpr(CypherRel *crel, Node *larg, Node *rarg)
 	n->quals = (Node *) truecond;
 	n->minHops = minHops;
 	n->maxHops = maxHops;
+	n->graphOid = get_graph_path_oid();
 
 	return (Node *) n;
 }
@@ -2876,7 +2857,6 @@ transformElemQuals(ParseState *pstate, Node *qual)
 		Oid			collid;
 		Var		   *var;
 		Node	   *prop_map;
-		bool		is_cyphermap;
 
 		rte = GetRTEByRangeTablePosn(pstate, eq->varno, 0);
 		/* don't use make_var() because `te` can be resjunk */
@@ -2890,14 +2870,19 @@ transformElemQuals(ParseState *pstate, Node *qual)
 
 		prop_map = getExprField((Expr *) var, AG_ELEM_PROP_MAP);
 
-		is_cyphermap = IsA(eq->prop_constr, CypherMapExpr);
-
-		if (is_cyphermap)
+		/*
+		 * A literal property map is turned into one equality qual per key.
+		 * Those can use property indexes directly, and the planner derives
+		 * containment quals from them for GIN indexes on the property map
+		 * (see match_prop_eq_to_indexcol()), so whichever index is cheaper
+		 * wins at plan time.
+		 */
+		if (IsA(eq->prop_constr, CypherMapExpr))
+		{
 			qual = transform_prop_constr(pstate, qual, prop_map,
 										 eq->prop_constr);
-
-		if ((is_cyphermap && ginAvail(pstate, eq->varno, eq->varattno)) ||
-			!is_cyphermap)
+		}
+		else
 		{
 			Node	   *prop_constr;
 			Expr	   *expr;
@@ -3000,186 +2985,6 @@ transform_prop_constr_worker(Node *node, prop_constr_context *ctx)
 	}
 }
 
-static bool
-ginAvail(ParseState *pstate, Index varno, AttrNumber varattno)
-{
-	Oid			relid;
-	List	   *inhoids;
-	ListCell   *li;
-
-	relid = getSourceRelid(pstate, varno, varattno);
-	if (!OidIsValid(relid))
-		return false;
-
-	if (!has_subclass(relid))
-		return hasGinOnProp(relid);
-
-	inhoids = find_all_inheritors(relid, AccessShareLock, NULL);
-	foreach(li, inhoids)
-	{
-		Oid inhoid = lfirst_oid(li);
-
-		if (hasGinOnProp(inhoid))
-			return true;
-	}
-
-	return false;
-}
-
-static Oid
-getSourceRelid(ParseState *pstate, Index varno, AttrNumber varattno)
-{
-	FutureVertex *fv;
-	List *rtable;
-
-	/*
-	 * If the given Var refers to a future vertex, there is no actual RTE for
-	 * it. So, find the Var from the list of future vertices first.
-	 */
-	fv = findFutureVertex(pstate, varno, varattno, 0);
-	if (fv != NULL)
-	{
-		RangeVar *rv = makeRangeVar(get_graph_path(true), fv->labname, -1);
-
-		return RangeVarGetRelid(rv, AccessShareLock, false);
-	}
-
-	rtable = pstate->p_rtable;
-	for (;;)
-	{
-		RangeTblEntry *rte;
-		Var *var;
-
-		rte = rt_fetch(varno, rtable);
-		switch (rte->rtekind)
-		{
-			case RTE_RELATION:
-				/* already locked */
-				return rte->relid;
-			case RTE_SUBQUERY:
-				{
-					TargetEntry *te;
-					Oid type;
-
-					te = get_tle_by_resno(rte->subquery->targetList, varattno);
-
-					type = exprType((Node *) te->expr);
-					if (type != VERTEXOID && type != EDGEOID)
-						return InvalidOid;
-
-					/* In RowExpr case, `(id, ...)` is assumed */
-					if (IsA(te->expr, Var))
-						var = (Var *) te->expr;
-					else if (IsA(te->expr, RowExpr))
-						var = linitial(((RowExpr *) te->expr)->args);
-					else
-						return InvalidOid;
-
-					rtable = rte->subquery->rtable;
-					varno = var->varno;
-					varattno = var->varattno;
-				}
-				break;
-			case RTE_JOIN:
-				{
-					Expr *expr;
-
-					expr = list_nth(rte->joinaliasvars, varattno - 1);
-					if (!IsA(expr, Var))
-						return InvalidOid;
-
-					var = (Var *) expr;
-					// XXX: Do we need type check?
-
-					varno = var->varno;
-					varattno = var->varattno;
-				}
-				break;
-			case RTE_FUNCTION:
-			case RTE_VALUES:
-			case RTE_CTE:
-				return InvalidOid;
-			default:
-				elog(ERROR, "invalid RTEKind %d", rte->rtekind);
-		}
-	}
-}
-
-/* See get_relation_info() */
-static bool
-hasGinOnProp(Oid relid)
-{
-	Relation	rel;
-	List	   *indexoidlist;
-	ListCell   *li;
-	bool		ret = false;
-
-	rel = heap_open(relid, NoLock);
-
-	if (!rel->rd_rel->relhasindex)
-	{
-		heap_close(rel, NoLock);
-
-		return false;
-	}
-
-	indexoidlist = RelationGetIndexList(rel);
-
-	foreach(li, indexoidlist)
-	{
-		Oid			indexoid = lfirst_oid(li);
-		Relation	indexRel;
-		Form_pg_index index;
-		int			attnum;
-
-		indexRel = index_open(indexoid, NoLock);
-		index = indexRel->rd_index;
-
-		if (!IndexIsValid(index))
-		{
-			index_close(indexRel, NoLock);
-			continue;
-		}
-
-		if (index->indcheckxmin &&
-			!TransactionIdPrecedes(
-					HeapTupleHeaderGetXmin(indexRel->rd_indextuple->t_data),
-					TransactionXmin))
-		{
-			index_close(indexRel, NoLock);
-			continue;
-		}
-
-		if (indexRel->rd_rel->relam != GIN_AM_OID)
-		{
-			index_close(indexRel, NoLock);
-			continue;
-		}
-
-		attnum = attnameAttNum(rel, AG_ELEM_PROP_MAP, false);
-		if (attnum == InvalidAttrNumber)
-		{
-			index_close(indexRel, NoLock);
-			continue;
-		}
-
-		if (index->indkey.values[0] == attnum)
-		{
-			index_close(indexRel, NoLock);
-			ret = true;
-			break;
-		}
-
-		index_close(indexRel, NoLock);
-	}
-
-	list_free(indexoidlist);
-
-	heap_close(rel, NoLock);
-
-	return ret;
-}
-
 static void
 addFutureVertex(ParseState *pstate, AttrNumber varattno, char *labname)
 {
@@ -4515,7 +4320,6 @@ transformDeleteJoinRTE(ParseState *pstate, CypherClause *clause)
 	List	   *exprs;
 	ListCell   *le;
 	ListCell   *lp;
-	char	   *edges_resname = NULL;
 	Node	   *sel_ag_edge;
 	Alias	   *r_alias;
 	Query	   *r_qry;
@@ -4575,11 +4379,18 @@ transformDeleteJoinRTE(ParseState *pstate, CypherClause *clause)
 		 */
 	}
 
+	/*
+	 * DETACH DELETE doesn't need the join. ModifyGraph removes all the edges
+	 * of the target vertices at once after it collects the vertices.
+	 */
+	if (detail->detach)
+		return l_rte;
+
 	vertices = verticesConcat((Node *) vertices_var, vertices_nodes);
 	if (vertices == NULL)
 		return l_rte;
 
-	sel_ag_edge = makeSelectEdgesVertices(vertices, detail, &edges_resname);
+	sel_ag_edge = makeSelectEdgesVertices(vertices);
 	r_alias = makeAliasNoDup(CYPHER_DELETEJOIN_ALIAS, NIL);
 
 	pstate->p_lateral_active = true;
@@ -4601,7 +4412,6 @@ transformDeleteJoinRTE(ParseState *pstate, CypherClause *clause)
 	jrte = incrementalJoinRTEs(pstate, JOIN_CYPHER_DELETE, l_rte, r_rte, qual,
 							   makeAliasNoDup(CYPHER_SUBQUERY_ALIAS, NIL));
 
-	pstate->p_delete_edges_resname = edges_resname;
 	return jrte;
 }
 
@@ -4639,56 +4449,24 @@ verticesConcat(Node *vertices, Node *expr)
 }
 
 /*
- * if DETACH
- *
- *     SELECT array_agg((id, NULL, NULL, NULL, ctid)::edge) AS <unique-name>
- *     FROM ag_edge AS e, unnest(vertices) AS v
- *     WHERE e.start = v.id OR e.end = v.id
- *
- * else
- *
- *     SELECT NULL::edge
- *     FROM ag_edge AS e, unnest(vertices) AS v
- *     WHERE e.start = v.id OR e.end = v.id
+ * SELECT NULL::edge
+ * FROM ag_edge AS e, unnest(vertices) AS v
+ * WHERE e.start = v.id OR e.end = v.id
  */
 static Node *
-makeSelectEdgesVertices(Node *vertices, CypherDeleteClause *delete,
-						char **edges_resname)
+makeSelectEdgesVertices(Node *vertices)
 {
-	List	   *targetlist = NIL;
+	TypeCast   *nulledge;
 	RangeVar   *ag_edge;
 	RangeFunction *unnest;
 	SelectStmt *sel;
 
 	AssertArg(vertices != NULL);
 
-	if (delete->detach)
-	{
-		Node	   *edges;
-		char	   *edges_name;
-		Node	   *edges_col;
-
-		edges = makeEdgesForDetach();
-		edges_name = genUniqueName();
-		targetlist = list_make1(makeResTarget(edges, edges_name));
-
-		/* add delete target */
-		edges_col = makeColumnRef(genQualifiedName(NULL, edges_name));
-		delete->exprs = lappend(delete->exprs, edges_col);
-
-		*edges_resname = edges_name;
-	}
-	else
-	{
-		TypeCast   *nulledge;
-
-		nulledge = makeNode(TypeCast);
-		nulledge->arg = (Node *) makeNullAConst();
-		nulledge->typeName = makeTypeName("edge");
-		nulledge->location = -1;
-
-		targetlist = list_make1(makeResTarget((Node *) nulledge, NULL));
-	}
+	nulledge = makeNode(TypeCast);
+	nulledge->arg = (Node *) makeNullAConst();
+	nulledge->typeName = makeTypeName("edge");
+	nulledge->location = -1;
 
 	ag_edge = makeRangeVar(get_graph_path(true), AG_EDGE, -1);
 	ag_edge->inh = true;
@@ -4697,50 +4475,13 @@ makeSelectEdgesVertices(Node *vertices, CypherDeleteClause *delete,
 	unnest = makeUnnestVertices(vertices);
 
 	sel = makeNode(SelectStmt);
-	sel->targetList = targetlist;
+	sel->targetList = list_make1(makeResTarget((Node *) nulledge, NULL));
 	sel->fromClause = list_make2(ag_edge, unnest);
 	sel->whereClause = (Node *) makeEdgesVertexQual();
 
 	return (Node *) sel;
 }
 
-/* array_agg((id, NULL, NULL, NULL, ctid)::edge) */
-static Node *
-makeEdgesForDetach(void)
-{
-	Node	   *id;
-	A_Const	   *start;
-	A_Const	   *end;
-	A_Const	   *prop_map;
-	Node	   *tid;
-	RowExpr	   *edgerow;
-	TypeCast   *edge;
-	FuncCall   *edges;
-
-	id = makeColumnRef(genQualifiedName(DELETE_EDGE_ALIAS, AG_ELEM_ID));
-	start = makeNullAConst();
-	end = makeNullAConst();
-	prop_map = makeNullAConst();
-	tid = makeColumnRef(genQualifiedName(DELETE_EDGE_ALIAS, "ctid"));
-
-	edgerow = makeNode(RowExpr);
-	edgerow->args = list_make5(id, start, end, prop_map, tid);
-	edgerow->row_typeid = InvalidOid;
-	edgerow->colnames = NIL;
-	edgerow->row_format = COERCE_IMPLICIT_CAST;
-	edgerow->location = -1;
-
-	edge = makeNode(TypeCast);
-	edge->arg = (Node *) edgerow;
-	edge->typeName = makeTypeName("edge");
-	edge->location = -1;
-
-	edges = makeFuncCall(list_make1(makeString("array_agg")), list_make1(edge),
-						 -1);
-
-	return (Node *) edges;
-}
-
 static RangeFunction *
 makeUnnestVertices(Node *vertices)
 {
@@ -4803,6 +4544,15 @@ findAllModifiedLabels(Query *qry)
 			label_oids = lappend_oid(label_oids,
 									 find_target_label(del_target, qry));
 		}
+
+		/* DETACH DELETE may remove edges in any edge label */
+		if (qry->graph.detach)
+		{
+			Oid			laboid;
+
+			laboid = get_labname_laboid(AG_EDGE, get_graph_path_oid());
+			label_oids = lappend_oid(label_oids, get_laboid_relid(laboid));
+		}
 	}
 
 	/* SET and MERGE ON SET */
@@ -5213,7 +4963,6 @@ transformClauseImpl(ParseState *pstate, Node *clause,
 	future_vertices = childParseState->p_future_vertices;
 	if (childParseState->p_nr_modify_clause > 0)
 		pstate->p_nr_modify_clause = childParseState->p_nr_modify_clause;
-	pstate->p_delete_edges_resname = childParseState->p_delete_edges_resname;
 
 	free_parsestate(childParseState);
 
@@ -37,6 +37,14 @@
 #define SP_COLNAME_HOPS		"hops"
 #define SP_COLNAME_VID		"vid"
 
+#define SP_ALIAS_BFS		"_s"
+#define SP_COLNAME_NEXT		"_next"
+
+/* column of the candidate vertex for the heuristic of Dijkstra */
+#define DIJKSTRA_COLNAME_HID	"_hid"
+
+bool		enable_shortestpath = true;
+
 /* semantic checks */
 static void checkNodeForRef(ParseState *pstate, CypherNode *cnode);
 static void checkNodeReferable(ParseState *pstate, CypherNode *cnode);
@@ -56,6 +64,13 @@ static Node *makeVerticesSubLink(void);
 static Node *makeEdgesSubLink(CypherPath *cpath, bool is_dijkstra);
 static void getCypherRelType(CypherRel *crel, char **typname, int *typloc);
 static Node *makeVertexIdExpr(Node *vertex);
+/* bidirectional search */
+static Query *makeBFSQuery(ParseState *pstate, CypherPath *cpath, bool isexpr);
+static RangeTblEntry *makeBFSFrom(ParseState *parentParseState,
+								  CypherPath *cpath);
+static RangeTblEntry *makeBFSEdgeQuery(ParseState *pstate, CypherPath *cpath);
+static SelectStmt *makeBFSEdge(char *typname, char *from, char *to,
+							   Node *vertex_id);
 
 /* dijkstra */
 static Query *makeDijkstraQuery(ParseState *pstate, CypherPath *cpath,
@@ -67,6 +82,9 @@ static RangeTblEntry *makeDijkstraEdgeQuery(ParseState *pstate,
 static Node *makeDijkstraEdgeUnion(char *elabel_name, char *row_name);
 static Node *makeDijkstraEdge(char *elabel_name, char *row_name,
 							  CypherRel *crel);
+static RangeTblEntry *makeDijkstraVertexQuery(ParseState *pstate,
+											  CypherPath *cpath);
+static Node *transformDijkstraHeuristic(ParseState *pstate, Node *expr);
 
 /* parse node */
 static Alias *makeAliasNoDup(char *aliasname, List *colnames);
@@ -95,6 +113,9 @@ transformShortestPath(ParseState *pstate, CypherPath *cpath)
 	checkRelFormat(pstate, lsecond(cpath->chain));
 	checkNodeForRef(pstate, llast(cpath->chain));
 
+	if (enable_shortestpath)
+		return makeBFSQuery(pstate, cpath, true);
+
 	return makeShortestPathQuery(pstate, cpath, true);
 }
 
@@ -110,7 +131,10 @@ transformShortestPathInMatch(ParseState *parentParseState, CypherPath *cpath)
 	checkRelFormat(pstate, lsecond(cpath->chain));
 	checkNodeReferable(pstate, llast(cpath->chain));
 
-	qry = makeShortestPathQuery(pstate, cpath, false);
+	if (enable_shortestpath)
+		qry = makeBFSQuery(pstate, cpath, false);
+	else
+		qry = makeShortestPathQuery(pstate, cpath, false);
 
 	free_parsestate(pstate);
 
@@ -842,6 +866,328 @@ makeVertexIdExpr(Node *vertex)
 								 -1);
 }
 
+/*
+ * SELECT (
+ *     (
+ *       SELECT array_agg(...)
+ *       FROM unnest(vids) AS vid
+ *     ),
+ *     (
+ *       SELECT array_agg(...)
+ *       FROM unnest(eids) AS eid
+ *     )
+ *   )::graphpath AS `pathname`
+ * FROM
+ * (
+ *   SELECT shortestpath_vids() AS vids,
+ *          shortestpath_eids() AS eids
+ *   FROM (
+ *     SELECT "end" AS _next, id
+ *     FROM `get_graph_path()`.`typname`
+ *     WHERE start = id(`initialVertex`)
+ *     UNION ALL
+ *     SELECT start AS _next, id
+ *     FROM `get_graph_path()`.`typname`
+ *     WHERE "end" = id(`lastVertex`)
+ *   )
+ *
+ *   SHORTESTPATH (id(`initialVertex`), id(`lastVertex`), `lidx`, `uidx`,
+ *                 _next, id)
+ * ) AS _s
+ */
+static Query *
+makeBFSQuery(ParseState *pstate, CypherPath *cpath, bool isexpr)
+{
+	Query	   *qry;
+	RangeTblEntry *rte;
+	Node	   *vertices;
+	Node	   *edges;
+	Node	   *empty_edges;
+	CoalesceExpr *coalesced;
+	Node	   *path;
+	Node	   *expr;
+	char	   *pathname;
+	TargetEntry *te;
+
+	qry = makeNode(Query);
+	qry->commandType = CMD_SELECT;
+
+	rte = makeBFSFrom(pstate, cpath);
+	addRTEtoJoinlist(pstate, rte, true);
+
+	vertices = makeVerticesSubLink();
+	edges = makeEdgesSubLink(cpath, true);
+	empty_edges = makeAArrayExpr(NIL, "_edge");
+	coalesced = makeNode(CoalesceExpr);
+	coalesced->args = list_make2(edges, empty_edges);
+	coalesced->location = -1;
+	path = makeRowExpr(list_make2(vertices, coalesced), "graphpath");
+	if (cpath->kind == CPATH_SHORTEST_ALL && isexpr)
+	{
+		FuncCall *arragg;
+
+		arragg = makeFuncCall(list_make1(makeString("array_agg")),
+							  list_make1(path), -1);
+		path = (Node *) arragg;
+	}
+	expr = transformExpr(pstate, path, EXPR_KIND_SELECT_TARGET);
+	pathname = getCypherName(cpath->variable);
+	te = makeTargetEntry((Expr *) expr,
+						 (AttrNumber) pstate->p_next_resno++,
+						 pathname, false);
+	qry->targetList = list_make1(te);
+
+	markTargetListOrigins(pstate, qry->targetList);
+
+	qry->rtable = pstate->p_rtable;
+	qry->jointree = makeFromExpr(pstate->p_joinlist, NULL);
+
+	qry->hasSubLinks = pstate->p_hasSubLinks;
+	qry->hasAggs = pstate->p_hasAggs;
+	if (qry->hasAggs)
+		parseCheckAggregates(pstate, qry);
+
+	assign_query_collations(pstate, qry);
+
+	return qry;
+}
+
+/*
+ * SELECT shortestpath_vids() AS vids,
+ *        shortestpath_eids() AS eids
+ * FROM (`makeBFSEdgeQuery()`)
+ *
+ * SHORTESTPATH (id(`initialVertex`), id(`lastVertex`), `lidx`, `uidx`,
+ *               _next, id)
+ */
+static RangeTblEntry *
+makeBFSFrom(ParseState *parentParseState, CypherPath *cpath)
+{
+	Alias	   *alias;
+	ParseState *pstate;
+	Query	   *qry;
+	RangeTblEntry *rte;
+	Node	   *target;
+	TargetEntry *te;
+	FuncCall   *fc;
+	CypherNode *vertex;
+	CypherRel  *crel;
+	A_Indices  *indices;
+
+	Assert(parentParseState->p_expr_kind == EXPR_KIND_NONE);
+	parentParseState->p_expr_kind = EXPR_KIND_FROM_SUBSELECT;
+
+	alias = makeAlias(SP_ALIAS_BFS, NIL);
+
+	pstate = make_parsestate(parentParseState);
+	pstate->p_locked_from_parent = isLockedRefname(pstate, alias->aliasname);
+
+	qry = makeNode(Query);
+	qry->commandType = CMD_SELECT;
+
+	rte = makeBFSEdgeQuery(pstate, cpath);
+	addRTEtoJoinlist(pstate, rte, true);
+
+	/* vids */
+	fc = makeFuncCall(list_make1(makeString("shortestpath_vids")), NIL, -1);
+	target = ParseFuncOrColumn(pstate, fc->funcname, NIL, pstate->p_last_srf,
+							   fc, -1);
+	te = makeTargetEntry((Expr *) target,
+						 (AttrNumber) pstate->p_next_resno++,
+						 SP_COLNAME_VIDS, false);
+	qry->targetList = list_make1(te);
+
+	/* eids */
+	fc = makeFuncCall(list_make1(makeString("shortestpath_eids")), NIL, -1);
+	target = ParseFuncOrColumn(pstate, fc->funcname, NIL, pstate->p_last_srf,
+							   fc, -1);
+	te = makeTargetEntry((Expr *) target,
+						 (AttrNumber) pstate->p_next_resno++,
+						 SP_COLNAME_EIDS, false);
+	qry->targetList = lappend(qry->targetList, te);
+
+	/* next vertex ID */
+	qry->shortestpathEndId = transformExpr(pstate,
+										   makeColumnRef1(SP_COLNAME_NEXT),
+										   EXPR_KIND_SELECT_TARGET);
+
+	/* edge ID */
+	qry->shortestpathEdgeId = transformExpr(pstate,
+											makeColumnRef1(AG_ELEM_LOCAL_ID),
+											EXPR_KIND_SELECT_TARGET);
+
+	markTargetListOrigins(pstate, qry->targetList);
+
+	/* source and target */
+	vertex = linitial(cpath->chain);
+	target = makeVertexIdExpr(makeColumnRef1(getCypherName(vertex->variable)));
+	qry->shortestpathSource = transformExpr(pstate, target,
+											EXPR_KIND_SELECT_TARGET);
+
+	vertex = llast(cpath->chain);
+	target = makeVertexIdExpr(makeColumnRef1(getCypherName(vertex->variable)));
+	qry->shortestpathTarget = transformExpr(pstate, target,
+											EXPR_KIND_SELECT_TARGET);
+
+	/* length of paths */
+	crel = lsecond(cpath->chain);
+	indices = (A_Indices *) crel->varlen;
+	if (indices == NULL)
+	{
+		qry->shortestpathMinHops = 1;
+		qry->shortestpathMaxHops = 1;
+	}
+	else
+	{
+		A_Const	   *lidx = (A_Const *) indices->lidx;
+
+		qry->shortestpathMinHops = lidx->val.val.ival;
+		if (indices->uidx != NULL)
+		{
+			A_Const	   *uidx = (A_Const *) indices->uidx;
+
+			qry->shortestpathMaxHops = uidx->val.val.ival;
+		}
+		else
+		{
+			qry->shortestpathMaxHops = -1;
+		}
+	}
+
+	qry->shortestpathAll = (cpath->kind == CPATH_SHORTEST_ALL);
+
+	qry->rtable = pstate->p_rtable;
+	qry->jointree = makeFromExpr(pstate->p_joinlist, NULL);
+
+	qry->hasSubLinks = pstate->p_hasSubLinks;
+
+	assign_query_collations(pstate, qry);
+
+	parentParseState->p_expr_kind = EXPR_KIND_NONE;
+
+	return addRangeTableEntryForSubquery(parentParseState, qry, alias, false,
+										 true);
+}
+
+/*
+ * Edges to expand the forward search from `initialVertex` and the backward
+ * search from `lastVertex`. Only the one of the two searches that is being
+ * expanded gets rows because the other vertex ID is set to NULL.
+ *
+ * SELECT "end" AS _next, id
+ * FROM `get_graph_path()`.`typname`
+ * WHERE start = id(`initialVertex`)
+ * UNION ALL
+ * SELECT start AS _next, id
+ * FROM `get_graph_path()`.`typname`
+ * WHERE "end" = id(`lastVertex`)
+ *
+ * # if the relationship is undirected
+ * UNION ALL
+ * SELECT start AS _next, id
+ * FROM `get_graph_path()`.`typname`
+ * WHERE "end" = id(`initialVertex`)
+ * UNION ALL
+ * SELECT "end" AS _next, id
+ * FROM `get_graph_path()`.`typname`
+ * WHERE start = id(`lastVertex`)
+ */
+static RangeTblEntry *
+makeBFSEdgeQuery(ParseState *pstate, CypherPath *cpath)
+{
+	CypherNode *vertex;
+	Node	   *source;
+	Node	   *target;
+	CypherRel  *crel;
+	char	   *typname;
+	List	   *arms = NIL;
+	ListCell   *la;
+	SelectStmt *sel = NULL;
+	Alias	   *alias;
+	Query	   *qry;
+
+	Assert(pstate->p_expr_kind == EXPR_KIND_NONE);
+	pstate->p_expr_kind = EXPR_KIND_FROM_SUBSELECT;
+
+	vertex = linitial(cpath->chain);
+	source = makeVertexIdExpr(makeColumnRef1(getCypherName(vertex->variable)));
+	vertex = llast(cpath->chain);
+	target = makeVertexIdExpr(makeColumnRef1(getCypherName(vertex->variable)));
+
+	crel = lsecond(cpath->chain);
+	getCypherRelType(crel, &typname, NULL);
+
+	if (crel->direction != CYPHER_REL_DIR_LEFT)
+	{
+		arms = lappend(arms, makeBFSEdge(typname, AG_START_ID, AG_END_ID,
+										 copyObject(source)));
+		arms = lappend(arms, makeBFSEdge(typname, AG_END_ID, AG_START_ID,
+										 copyObject(target)));
+	}
+	if (crel->direction != CYPHER_REL_DIR_RIGHT)
+	{
+		arms = lappend(arms, makeBFSEdge(typname, AG_END_ID, AG_START_ID,
+										 copyObject(source)));
+		arms = lappend(arms, makeBFSEdge(typname, AG_START_ID, AG_END_ID,
+										 copyObject(target)));
+	}
+
+	foreach(la, arms)
+	{
+		SelectStmt *arm = lfirst(la);
+		SelectStmt *u;
+
+		if (sel == NULL)
+		{
+			sel = arm;
+			continue;
+		}
+
+		u = makeNode(SelectStmt);
+		u->op = SETOP_UNION;
+		u->all = true;
+		u->larg = sel;
+		u->rarg = arm;
+
+		sel = u;
+	}
+
+	alias = makeAliasOptUnique(NULL);
+	qry = parse_sub_analyze((Node *) sel, pstate, NULL,
+							isLockedRefname(pstate, alias->aliasname), true);
+	pstate->p_expr_kind = EXPR_KIND_NONE;
+
+	return addRangeTableEntryForSubquery(pstate, qry, alias, false, true);
+}
+
+/*
+ * SELECT `to` AS _next, id
+ * FROM `get_graph_path()`.`typname`
+ * WHERE `from` = `vertex_id`
+ */
+static SelectStmt *
+makeBFSEdge(char *typname, char *from, char *to, Node *vertex_id)
+{
+	SelectStmt *sel;
+	RangeVar   *r;
+	A_Expr	   *qual;
+
+	sel = makeNode(SelectStmt);
+
+	sel->targetList = list_make2(makeSimpleResTarget(to, SP_COLNAME_NEXT),
+								 makeSimpleResTarget(AG_ELEM_LOCAL_ID, NULL));
+
+	r = makeRangeVar(get_graph_path(true), typname, -1);
+	r->inh = true;
+	sel->fromClause = list_make1(r);
+
+	qual = makeSimpleA_Expr(AEXPR_OP, "=", makeColumnRef1(from), vertex_id,
+							-1);
+	sel->whereClause = (Node *) qual;
+
+	return sel;
+}
+
 static Alias *
 makeAliasNoDup(char *aliasname, List *colnames)
 {
@@ -1031,7 +1377,8 @@ checkRelFormatForDijkstra(ParseState *pstate, CypherRel *crel)
 }
 
 /*
- * path = DIJKSTRA((source)-[:edge_label]->(target), weight, qual, LIMIT n)
+ * path = DIJKSTRA((source)-[:edge_label]->(target), weight, qual, LIMIT n,
+ *                 HEURISTIC v | heuristic)
  *
  * |
  * v
@@ -1067,7 +1414,7 @@ checkRelFormatForDijkstra(ParseState *pstate, CypherRel *crel)
  *   FROM `graph_path`.edge_label
  *   WHERE start = id(source) AND `qual`
  *
- *   DIJKSTRA (id(source), id(target), LIMIT n, "end", id)
+ *   DIJKSTRA (id(source), id(target), LIMIT n, "end", id, heuristic)
  * )
  */
 static Query *
@@ -1143,10 +1490,16 @@ makeDijkstraQuery(ParseState *pstate, CypherPath *cpath, bool is_expr)
  * SELECT dijkstra_vids() as vids,
  *        dijkstra_eids() as eids,
  *        weight
- * FROM `graph_path`.edge_label
- * WHERE start = id(source) AND `qual`
+ * FROM `graph_path`.edge_label,
+ *      (SELECT id AS _hid, (id, properties, ctid)::vertex AS v
+ *       FROM `graph_path`.ag_vertex)
+ * WHERE start = id(source) AND "end" = _hid AND `qual`
+ *
+ * DIJKSTRA (id(source), id(target), LIMIT n, "end", id, heuristic)
  *
- * DIJKSTRA (id(source), id(target), LIMIT n, "end", id)
+ * The vertex subquery is added only if there is a heuristic. It makes the
+ * candidate vertex, which is at the other side of each edge, visible to the
+ * heuristic as `v`.
  */
 static RangeTblEntry *
 makeDijkstraFrom(ParseState *parentParseState, CypherPath *cpath)
@@ -1154,6 +1507,7 @@ makeDijkstraFrom(ParseState *parentParseState, CypherPath *cpath)
 	Alias	   *alias;
 	ParseState *pstate;
 	Query	   *qry;
+	RangeTblEntry *edge_rte;
 	RangeTblEntry *rte;
 	Node	   *target;
 	TargetEntry *te;
@@ -1178,8 +1532,8 @@ makeDijkstraFrom(ParseState *parentParseState, CypherPath *cpath)
 	qry = makeNode(Query);
 	qry->commandType = CMD_SELECT;
 
-	rte = makeDijkstraEdgeQuery(pstate, cpath);
-	addRTEtoJoinlist(pstate, rte, true);
+	edge_rte = makeDijkstraEdgeQuery(pstate, cpath);
+	addRTEtoJoinlist(pstate, edge_rte, true);
 
 	/* vids */
 	fc = makeFuncCall(list_make1(makeString("dijkstra_vids")), NIL, -1);
@@ -1263,10 +1617,46 @@ makeDijkstraFrom(ParseState *parentParseState, CypherPath *cpath)
 
 	where = list_make1(makeSimpleA_Expr(AEXPR_OP, "=", start, vertex_id, -1));
 
+	/* heuristic */
+	if (cpath->heuristic != NULL)
+	{
+		Node	   *end;
+
+		rte = makeDijkstraVertexQuery(pstate, cpath);
+		addRTEtoJoinlist(pstate, rte, true);
+
+		if (crel->direction == CYPHER_REL_DIR_LEFT)
+			end = makeColumnRef1("start");
+		else
+			end = makeColumnRef1("end");
+		where = lappend(where,
+						makeSimpleA_Expr(AEXPR_OP, "=", end,
+										 makeColumnRef1(DIJKSTRA_COLNAME_HID),
+										 -1));
+
+		qry->dijkstraHeuristic = transformDijkstraHeuristic(pstate,
+															cpath->heuristic);
+	}
+
 	/* qual */
 	if (cpath->qual != NULL)
 		where = lappend(where, cpath->qual);
 
+	/*
+	 * Without a qual and a heuristic, the edges to expand a vertex are given
+	 * by the topology of the edge label alone.  The executor can then take
+	 * them from the topology cache.
+	 */
+	if (crel->direction != CYPHER_REL_DIR_NONE &&
+		cpath->qual == NULL && cpath->heuristic == NULL)
+	{
+		RangeTblEntry *label_rte = linitial(edge_rte->subquery->rtable);
+
+		Assert(label_rte->rtekind == RTE_RELATION);
+		qry->dijkstraTopology = label_rte->relid;
+		qry->dijkstraReverse = (crel->direction == CYPHER_REL_DIR_LEFT);
+	}
+
 	qual = transformCypherExpr(pstate,
 							   (Node *) makeBoolExpr(AND_EXPR, where, -1),
 							   EXPR_KIND_WHERE);
@@ -1285,6 +1675,7 @@ makeDijkstraFrom(ParseState *parentParseState, CypherPath *cpath)
 										EXPR_KIND_SELECT_TARGET);
 
 	/* Dijkstra LIMIT */
+	qry->dijkstraLoopless = cpath->loopless;
 	qry->dijkstraLimit = transformCypherLimit(pstate, cpath->limit,
 											  EXPR_KIND_LIMIT, "LIMIT");
 
@@ -1337,6 +1728,87 @@ makeDijkstraEdgeQuery(ParseState *pstate, CypherPath *cpath)
 	return rte;
 }
 
+/*
+ * SELECT id AS _hid, (id, properties, ctid)::vertex AS `heuristic_var`
+ * FROM `get_graph_path()`.ag_vertex
+ */
+static RangeTblEntry *
+makeDijkstraVertexQuery(ParseState *pstate, CypherPath *cpath)
+{
+	SelectStmt *sel;
+	RangeVar   *ag_vertex;
+	Node	   *vertex;
+	Alias	   *alias;
+	Query	   *qry;
+	RangeTblEntry *rte;
+
+	Assert(pstate->p_expr_kind == EXPR_KIND_NONE);
+	pstate->p_expr_kind = EXPR_KIND_FROM_SUBSELECT;
+
+	sel = makeNode(SelectStmt);
+
+	ag_vertex = makeRangeVar(get_graph_path(true), AG_VERTEX, -1);
+	ag_vertex->inh = true;
+	sel->fromClause = list_make1(ag_vertex);
+
+	vertex = makeRowExpr(list_make3(makeColumnRef1(AG_ELEM_LOCAL_ID),
+									makeColumnRef1(AG_ELEM_PROP_MAP),
+									makeColumnRef1("ctid")),
+						 "vertex");
+	sel->targetList = list_make2(makeSimpleResTarget(AG_ELEM_LOCAL_ID,
+													 DIJKSTRA_COLNAME_HID),
+								 makeResTarget(vertex,
+											   getCypherName(cpath->heuristic_var)));
+
+	alias = makeAliasOptUnique(NULL);
+	qry = parse_sub_analyze((Node *) sel, pstate, NULL,
+							isLockedRefname(pstate, alias->aliasname), true);
+	pstate->p_expr_kind = EXPR_KIND_NONE;
+
+	rte = addRangeTableEntryForSubquery(pstate, qry, alias, false, true);
+
+	return rte;
+}
+
+/*
+ * The heuristic is an estimate of the weight of the path from the candidate
+ * vertex to the target.  It must never overestimate the weight for the paths
+ * to be the shortest ones.
+ */
+static Node *
+transformDijkstraHeuristic(ParseState *pstate, Node *expr)
+{
+	Node	   *heuristic;
+	Oid			htype;
+
+	heuristic = transformCypherExpr(pstate, expr, EXPR_KIND_SELECT_TARGET);
+	htype = exprType(heuristic);
+	if (htype != FLOAT8OID)
+	{
+		Node	   *coerced;
+
+		coerced = coerce_to_target_type(pstate, heuristic, htype, FLOAT8OID,
+										-1, COERCION_EXPLICIT,
+										COERCE_EXPLICIT_CAST, -1);
+		if (coerced == NULL)
+			ereport(ERROR,
+					(errcode(ERRCODE_DATATYPE_MISMATCH),
+					 errmsg("heuristic must be type %s, not type %s",
+							format_type_be(FLOAT8OID),
+							format_type_be(htype)),
+					 parser_errposition(pstate, exprLocation(heuristic))));
+
+		heuristic = coerced;
+	}
+	if (expression_returns_set(heuristic))
+		ereport(ERROR,
+				(errcode(ERRCODE_DATATYPE_MISMATCH),
+				 errmsg("heuristic must not return a set"),
+				 parser_errposition(pstate, exprLocation(heuristic))));
+
+	return heuristic;
+}
+
 /*
  * SELECT start, "end", id, (id, _start, _end, properties)::edge AS row_name
  * FROM (
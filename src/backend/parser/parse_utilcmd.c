@@ -65,6 +65,7 @@
 #include "parser/parse_type.h"
 #include "parser/parse_utilcmd.h"
 #include "parser/parser.h"
+#include "parser/scansup.h"
 #include "rewrite/rewriteManip.h"
 #include "utils/acl.h"
 #include "utils/builtins.h"
@@ -76,6 +77,9 @@
 #include "utils/typcache.h"
 
 
+/* GUC parameter */
+int			label_id_cache = 1;
+
 /* State shared by transformCreateStmt and its subroutines */
 typedef struct
 {
@@ -149,6 +153,8 @@ static Const *transformPartitionBoundValue(ParseState *pstate, A_Const *con,
 static List *makeVertexElements(void);
 static List *makeEdgeElements(void);
 static List *makeEdgeIndex(RangeVar *label);
+static List *makePropColumnElements(List **options, List *tableElts);
+static List *splitPropColumnKeys(char *rawkeys);
 static bool isLabelKind(RangeVar *label, char labkind);
 static void transformLabelIdDefinition(CreateStmtContext *cxt, ColumnDef *col);
 static CommentStmt *makeComment(ObjectType type, RangeVar *name, char *desc);
@@ -3723,6 +3729,10 @@ transformCreateLabelStmt(CreateLabelStmt *labelStmt, const char *queryString)
 		elog(ERROR, "unknown label type: %d", labelStmt->labelKind);
 	}
 
+	stmt->tableElts = list_concat(stmt->tableElts,
+								  makePropColumnElements(&stmt->options,
+														 stmt->tableElts));
+
 	if (strcmp(labelStmt->relation->relname, AG_VERTEX) != 0 &&
 		strcmp(labelStmt->relation->relname, AG_EDGE) != 0)
 	{
@@ -3978,6 +3988,149 @@ makeEdgeElements(void)
 	return list_make4(id, start, end, prop_map);
 }
 
+/*
+ * Make table elements for the property columns given by `property_columns`
+ * option and remove the option from `options` because it is not a storage
+ * parameter.
+ *
+ * A property column has the same name as its property key and holds the
+ * value of the key in the property map (NULL if the key is absent). The
+ * executor keeps it in sync with the property map and the planner replaces
+ * accesses to the key with reads of the column. The values are jsonb to
+ * keep the semantics of Cypher expressions. A CHECK constraint guards the
+ * invariant against direct modifications of the table.
+ */
+static List *
+makePropColumnElements(List **options, List *tableElts)
+{
+	List	   *elements = NIL;
+	ListCell   *prev = NULL;
+	ListCell   *lc;
+
+	foreach(lc, *options)
+	{
+		DefElem    *def = lfirst(lc);
+		char	   *rawkeys;
+		List	   *keys;
+		ListCell   *lk;
+
+		if (def->defnamespace != NULL ||
+			strcmp(def->defname, AG_PROP_COLUMNS) != 0)
+		{
+			prev = lc;
+			continue;
+		}
+
+		rawkeys = pstrdup(defGetString(def));
+		keys = splitPropColumnKeys(rawkeys);
+
+		foreach(lk, keys)
+		{
+			char	   *key = lfirst(lk);
+			ListCell   *le;
+			ColumnDef  *col;
+			ColumnRef  *colref;
+			ColumnRef  *propref;
+			A_Const    *keyconst;
+			Constraint *check;
+
+			foreach(le, list_concat(list_copy(tableElts), list_copy(elements)))
+			{
+				if (strcmp(((ColumnDef *) lfirst(le))->colname, key) == 0)
+					ereport(ERROR,
+							(errcode(ERRCODE_DUPLICATE_COLUMN),
+							 errmsg("property column \"%s\" specified more than once or conflicts with a label column",
+									key)));
+			}
+
+			colref = makeNode(ColumnRef);
+			colref->fields = list_make1(makeString(key));
+			colref->location = -1;
+
+			propref = makeNode(ColumnRef);
+			propref->fields = list_make1(makeString(AG_ELEM_PROP_MAP));
+			propref->location = -1;
+
+			keyconst = makeNode(A_Const);
+			keyconst->val.type = T_String;
+			keyconst->val.val.str = key;
+			keyconst->location = -1;
+
+			/* key IS NOT DISTINCT FROM properties -> 'key' */
+			check = makeNode(Constraint);
+			check->contype = CONSTR_CHECK;
+			check->raw_expr = (Node *)
+				makeSimpleA_Expr(AEXPR_NOT_DISTINCT, "=", (Node *) colref,
+								 (Node *) makeSimpleA_Expr(AEXPR_OP, "->",
+														   (Node *) propref,
+														   (Node *) keyconst,
+														   -1),
+								 -1);
+			check->initially_valid = true;
+			check->location = -1;
+
+			col = makeNode(ColumnDef);
+			col->colname = key;
+			col->typeName = makeTypeName("jsonb");
+			col->is_local = true;
+			col->constraints = list_make1(check);
+			col->location = -1;
+
+			elements = lappend(elements, col);
+		}
+
+		*options = list_delete_cell(*options, lc, prev);
+		break;
+	}
+
+	return elements;
+}
+
+/*
+ * Split the comma-separated list of property keys in `rawkeys`, which is
+ * modified in place.  Whitespace around each key is ignored.  Unlike
+ * SplitIdentifierString(), the keys are kept as written since property keys
+ * are case sensitive.
+ */
+static List *
+splitPropColumnKeys(char *rawkeys)
+{
+	List	   *keys = NIL;
+	char	   *next = rawkeys;
+
+	while (next != NULL)
+	{
+		char	   *key = next;
+		char	   *end;
+
+		next = strchr(key, ',');
+		if (next != NULL)
+			*next++ = '\0';
+
+		while (scanner_isspace(*key))
+			key++;
+		end = key + strlen(key);
+		while (end > key && scanner_isspace(end[-1]))
+			end--;
+		*end = '\0';
+
+		if (*key == '\0')
+			ereport(ERROR,
+					(errcode(ERRCODE_INVALID_PARAMETER_VALUE),
+					 errmsg("invalid list syntax for \"%s\" option",
+							AG_PROP_COLUMNS)));
+		if (end - key >= NAMEDATALEN)
+			ereport(ERROR,
+					(errcode(ERRCODE_NAME_TOO_LONG),
+					 errmsg("property key \"%s\" is too long for a property column",
+							key)));
+
+		keys = lappend(keys, key);
+	}
+
+	return keys;
+}
+
 static List *
 makeEdgeIndex(RangeVar *label)
 {
@@ -4004,7 +4157,13 @@ makeEdgeIndex(RangeVar *label)
 	end_col = makeNode(IndexElem);
 	end_col->name = AG_END_ID;
 
-	/* make indexes */
+	/*
+	 * make indexes
+	 *
+	 * The indexes on start and end keep the edges of each vertex together
+	 * with their neighbor and edge id.  Traversals that need only those can
+	 * expand a vertex with an index-only scan on a few leaf pages.
+	 */
 
 	edge_id_idx = makeNode(IndexStmt);
 	edge_id_idx->idxname = ChooseRelationName(labname, AG_ELEM_LOCAL_ID,
@@ -4018,14 +4177,14 @@ makeEdgeIndex(RangeVar *label)
 											"idx", graphid);
 	start_idx->relation = copyObject(label);
 	start_idx->accessMethod = "btree";
-	start_idx->indexParams = list_make2(start_col, end_col);
+	start_idx->indexParams = list_make3(start_col, end_col, id_col);
 
 	end_idx = makeNode(IndexStmt);
 	end_idx->idxname = ChooseRelationName(labname, AG_END_ID,
 										  "idx", graphid);
 	end_idx->relation = copyObject(label);
 	end_idx->accessMethod = "btree";
-	end_idx->indexParams = list_make2(end_col, start_col);
+	end_idx->indexParams = list_make3(end_col, start_col, id_col);
 
 	return list_make3(edge_id_idx, start_idx, end_idx);
 }
@@ -4097,6 +4256,18 @@ transformLabelIdDefinition(CreateStmtContext *cxt, ColumnDef *col)
 	seqstmt->options = NIL;
 	seqstmt->ownerId = InvalidOid;
 
+	/*
+	 * Each session takes label_id_cache IDs at a time, so that creating
+	 * elements doesn't lock and modify the sequence for every element.
+	 */
+	if (label_id_cache > 1)
+	{
+		DefElem    *cache;
+
+		cache = makeDefElem("cache", (Node *) makeInteger(label_id_cache), -1);
+		seqstmt->options = list_make1(cache);
+	}
+
 	cxt->blist = lappend(cxt->blist, seqstmt);
 
 	/* ALTER SEQUENCE OWNED BY after CREATE TABLE */
@@ -3079,6 +3079,26 @@ pgstat_progress_start_command(ProgressCommandType cmdtype, Oid relid)
 	pgstat_increment_changecount_after(beentry);
 }
 
+/*-----------
+ * pgstat_progress_update_target() -
+ *
+ * Update st_progress_command_target of own backend entry, for commands that
+ * work on several relations one after another.
+ *-----------
+ */
+void
+pgstat_progress_update_target(Oid relid)
+{
+	volatile PgBackendStatus *beentry = MyBEEntry;
+
+	if (!beentry || !pgstat_track_activities)
+		return;
+
+	pgstat_increment_changecount_before(beentry);
+	beentry->st_progress_command_target = relid;
+	pgstat_increment_changecount_after(beentry);
+}
+
 /*-----------
  * pgstat_progress_update_param() -
  *
@@ -1,6 +1,6 @@
 /*
  * dijkstrafuncs.c
- *	  Dummy functions for dijkstra
+ *	  Dummy functions for dijkstra and shortestpath
  *
  * Copyright (c) 2017 by Bitnine Global, Inc.
  *
@@ -24,3 +24,15 @@ dijkstra_eids(PG_FUNCTION_ARGS)
 {
 	PG_RETURN_NULL();
 }
+
+Datum
+shortestpath_vids(PG_FUNCTION_ARGS)
+{
+	PG_RETURN_NULL();
+}
+
+Datum
+shortestpath_eids(PG_FUNCTION_ARGS)
+{
+	PG_RETURN_NULL();
+}
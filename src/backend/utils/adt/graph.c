@@ -67,6 +67,14 @@ static void elems_out_si(StringInfo si, AnyArrayType *elems, FmgrInfo *flinfo);
 static void get_elem_type_output(ArrayMetaState *state, Oid elem_type,
 								 MemoryContext mctx);
 static Datum array_iter_next_(array_iter *it, int idx, ArrayMetaState *state);
+static void vertex_send_si(StringInfo si, Datum vertex);
+static Datum vertex_recv_si(StringInfo si);
+static void edge_send_si(StringInfo si, Datum edge);
+static Datum edge_recv_si(StringInfo si);
+static void prop_map_send_si(StringInfo si, Datum prop_map);
+static Datum prop_map_recv_si(StringInfo si);
+static void tid_send_si(StringInfo si, Datum tid, bool isnull);
+static Datum tid_recv_si(StringInfo si, bool *isnull);
 static void deform_tuple(HeapTupleHeader tuphdr, Datum *values, bool *isnull);
 static Datum tuple_getattr(HeapTupleHeader tuphdr, int attnum);
 static Datum getEdgeVertex(HeapTupleHeader edge, EdgeVertexKind evk);
@@ -451,6 +459,40 @@ _vertex_out(PG_FUNCTION_ARGS)
 	PG_RETURN_CSTRING(si.data);
 }
 
+/*
+ * Binary I/O of vertex, edge and graphpath
+ *
+ * Unlike record_send(), the columns are sent without their type OIDs and
+ * lengths, and the label name is not sent at all.  The label ID is in each
+ * graphid, so a client can look up the names in ag_label once per result
+ * set instead of having the server format the label of every element.
+ *
+ * vertex:    int64 id, properties, tid
+ * edge:      int64 id, int64 start, int64 end, properties, tid
+ * graphpath: int32 number of edges, vertex, (edge, vertex) * number of edges
+ *
+ * properties is an int32 length followed by the jsonb in its binary format,
+ * and tid is an int8 flag (0 for NULL) followed by the int32 block number
+ * and the int16 offset number if the flag is not 0.
+ */
+Datum
+vertex_recv(PG_FUNCTION_ARGS)
+{
+	StringInfo	buf = (StringInfo) PG_GETARG_POINTER(0);
+
+	PG_RETURN_DATUM(vertex_recv_si(buf));
+}
+
+Datum
+vertex_send(PG_FUNCTION_ARGS)
+{
+	StringInfoData buf;
+
+	pq_begintypsend(&buf);
+	vertex_send_si(&buf, PG_GETARG_DATUM(0));
+	PG_RETURN_BYTEA_P(pq_endtypsend(&buf));
+}
+
 Datum
 vertex_label(PG_FUNCTION_ARGS)
 {
@@ -619,6 +661,24 @@ _edge_out(PG_FUNCTION_ARGS)
 	PG_RETURN_CSTRING(si.data);
 }
 
+Datum
+edge_recv(PG_FUNCTION_ARGS)
+{
+	StringInfo	buf = (StringInfo) PG_GETARG_POINTER(0);
+
+	PG_RETURN_DATUM(edge_recv_si(buf));
+}
+
+Datum
+edge_send(PG_FUNCTION_ARGS)
+{
+	StringInfoData buf;
+
+	pq_begintypsend(&buf);
+	edge_send_si(&buf, PG_GETARG_DATUM(0));
+	PG_RETURN_BYTEA_P(pq_endtypsend(&buf));
+}
+
 Datum
 edge_label(PG_FUNCTION_ARGS)
 {
@@ -860,6 +920,93 @@ graphpath_out(PG_FUNCTION_ARGS)
 	PG_RETURN_CSTRING(si.data);
 }
 
+Datum
+graphpath_recv(PG_FUNCTION_ARGS)
+{
+	StringInfo	buf = (StringInfo) PG_GETARG_POINTER(0);
+	int			nedges;
+	Datum	   *vertices;
+	Datum	   *edges;
+	int			i;
+
+	nedges = pq_getmsgint(buf, 4);
+	/* each edge takes more than a byte, so this also limits the allocation */
+	if (nedges < 0 || nedges > buf->len - buf->cursor)
+		ereport(ERROR,
+				(errcode(ERRCODE_INVALID_BINARY_REPRESENTATION),
+				 errmsg("invalid number of edges in graphpath: %d", nedges)));
+
+	vertices = palloc((nedges + 1) * sizeof(Datum));
+	edges = palloc(nedges * sizeof(Datum));
+
+	vertices[0] = vertex_recv_si(buf);
+	for (i = 0; i < nedges; i++)
+	{
+		edges[i] = edge_recv_si(buf);
+		vertices[i + 1] = vertex_recv_si(buf);
+	}
+
+	PG_RETURN_DATUM(makeGraphpathDatum(vertices, nedges + 1, edges, nedges));
+}
+
+Datum
+graphpath_send(PG_FUNCTION_ARGS)
+{
+	Datum		vertices_datum;
+	Datum		edges_datum;
+	AnyArrayType *vertices;
+	AnyArrayType *edges;
+	GraphpathOutData *my_extra;
+	int			nvertices;
+	int			nedges;
+	StringInfoData buf;
+	array_iter	it_v;
+	array_iter	it_e;
+	int			i;
+
+	getGraphpathArrays(PG_GETARG_DATUM(0), &vertices_datum, &edges_datum);
+
+	vertices = DatumGetAnyArray(vertices_datum);
+	edges = DatumGetAnyArray(edges_datum);
+
+	/* cache vertex/edge storage information, output functions are not used */
+	my_extra = (GraphpathOutData *) fcinfo->flinfo->fn_extra;
+	if (my_extra == NULL)
+	{
+		fcinfo->flinfo->fn_extra = MemoryContextAlloc(fcinfo->flinfo->fn_mcxt,
+													  sizeof(*my_extra));
+		my_extra = (GraphpathOutData *) fcinfo->flinfo->fn_extra;
+		get_typlenbyvalalign(AARR_ELEMTYPE(vertices), &my_extra->vertex.typlen,
+							 &my_extra->vertex.typbyval,
+							 &my_extra->vertex.typalign);
+		get_typlenbyvalalign(AARR_ELEMTYPE(edges), &my_extra->edge.typlen,
+							 &my_extra->edge.typbyval,
+							 &my_extra->edge.typalign);
+	}
+
+	nvertices = ArrayGetNItems(AARR_NDIM(vertices), AARR_DIMS(vertices));
+	nedges = ArrayGetNItems(AARR_NDIM(edges), AARR_DIMS(edges));
+	if (nvertices != nedges + 1)
+		ereport(ERROR,
+				(errcode(ERRCODE_INTERNAL_ERROR),
+				 errmsg("the numbers of vertices and edges are mismatched")));
+
+	pq_begintypsend(&buf);
+	pq_sendint(&buf, nedges, 4);
+
+	array_iter_setup(&it_v, vertices);
+	array_iter_setup(&it_e, edges);
+
+	vertex_send_si(&buf, array_iter_next_(&it_v, 0, &my_extra->vertex));
+	for (i = 0; i < nedges; i++)
+	{
+		edge_send_si(&buf, array_iter_next_(&it_e, i, &my_extra->edge));
+		vertex_send_si(&buf, array_iter_next_(&it_v, i + 1, &my_extra->vertex));
+	}
+
+	PG_RETURN_BYTEA_P(pq_endtypsend(&buf));
+}
+
 static void
 get_elem_type_output(ArrayMetaState *state, Oid elem_type, MemoryContext mctx)
 {
@@ -927,6 +1074,191 @@ graphpath_edges(PG_FUNCTION_ARGS)
 	PG_RETURN_DATUM(edges_datum);
 }
 
+static void
+vertex_send_si(StringInfo si, Datum vertex)
+{
+	Datum		values[Natts_vertex];
+	bool		isnull[Natts_vertex];
+
+	deform_tuple(DatumGetHeapTupleHeader(vertex), values, isnull);
+
+	if (isnull[Anum_vertex_id - 1])
+		ereport(ERROR,
+				(errcode(ERRCODE_NULL_VALUE_NOT_ALLOWED),
+				 errmsg("id in vertex cannot be NULL")));
+	if (isnull[Anum_vertex_properties - 1])
+		ereport(ERROR,
+				(errcode(ERRCODE_NULL_VALUE_NOT_ALLOWED),
+				 errmsg("properties in vertex cannot be NULL")));
+
+	pq_sendint64(si, DatumGetGraphid(values[Anum_vertex_id - 1]));
+	prop_map_send_si(si, values[Anum_vertex_properties - 1]);
+	tid_send_si(si, values[Anum_vertex_tid - 1], isnull[Anum_vertex_tid - 1]);
+}
+
+static Datum
+vertex_recv_si(StringInfo si)
+{
+	Datum		values[Natts_vertex];
+	bool		isnull[Natts_vertex] = {false, false, false};
+	TupleDesc	tupDesc;
+	HeapTuple	vertex;
+
+	values[Anum_vertex_id - 1] = GraphidGetDatum(pq_getmsgint64(si));
+	values[Anum_vertex_properties - 1] = prop_map_recv_si(si);
+	values[Anum_vertex_tid - 1] = tid_recv_si(si, &isnull[Anum_vertex_tid - 1]);
+
+	tupDesc = lookup_rowtype_tupdesc(VERTEXOID, -1);
+	Assert(tupDesc->natts == Natts_vertex);
+
+	vertex = heap_form_tuple(tupDesc, values, isnull);
+
+	ReleaseTupleDesc(tupDesc);
+
+	return HeapTupleGetDatum(vertex);
+}
+
+static void
+edge_send_si(StringInfo si, Datum edge)
+{
+	Datum		values[Natts_edge];
+	bool		isnull[Natts_edge];
+
+	deform_tuple(DatumGetHeapTupleHeader(edge), values, isnull);
+
+	if (isnull[Anum_edge_id - 1])
+		ereport(ERROR,
+				(errcode(ERRCODE_NULL_VALUE_NOT_ALLOWED),
+				 errmsg("id in edge cannot be NULL")));
+	if (isnull[Anum_edge_start - 1])
+		ereport(ERROR,
+				(errcode(ERRCODE_NULL_VALUE_NOT_ALLOWED),
+				 errmsg("start in edge cannot be NULL")));
+	if (isnull[Anum_edge_end - 1])
+		ereport(ERROR,
+				(errcode(ERRCODE_NULL_VALUE_NOT_ALLOWED),
+				 errmsg("end in edge cannot be NULL")));
+	if (isnull[Anum_edge_properties - 1])
+		ereport(ERROR,
+				(errcode(ERRCODE_NULL_VALUE_NOT_ALLOWED),
+				 errmsg("properties in edge cannot be NULL")));
+
+	pq_sendint64(si, DatumGetGraphid(values[Anum_edge_id - 1]));
+	pq_sendint64(si, DatumGetGraphid(values[Anum_edge_start - 1]));
+	pq_sendint64(si, DatumGetGraphid(values[Anum_edge_end - 1]));
+	prop_map_send_si(si, values[Anum_edge_properties - 1]);
+	tid_send_si(si, values[Anum_edge_tid - 1], isnull[Anum_edge_tid - 1]);
+}
+
+static Datum
+edge_recv_si(StringInfo si)
+{
+	Datum		values[Natts_edge];
+	bool		isnull[Natts_edge] = {false, false, false, false, false};
+	TupleDesc	tupDesc;
+	HeapTuple	edge;
+
+	values[Anum_edge_id - 1] = GraphidGetDatum(pq_getmsgint64(si));
+	values[Anum_edge_start - 1] = GraphidGetDatum(pq_getmsgint64(si));
+	values[Anum_edge_end - 1] = GraphidGetDatum(pq_getmsgint64(si));
+	values[Anum_edge_properties - 1] = prop_map_recv_si(si);
+	values[Anum_edge_tid - 1] = tid_recv_si(si, &isnull[Anum_edge_tid - 1]);
+
+	tupDesc = lookup_rowtype_tupdesc(EDGEOID, -1);
+	Assert(tupDesc->natts == Natts_edge);
+
+	edge = heap_form_tuple(tupDesc, values, isnull);
+
+	ReleaseTupleDesc(tupDesc);
+
+	return HeapTupleGetDatum(edge);
+}
+
+static void
+prop_map_send_si(StringInfo si, Datum prop_map)
+{
+	bytea	   *outputbytes;
+
+	outputbytes = DatumGetByteaPP(DirectFunctionCall1(jsonb_send, prop_map));
+	pq_sendint(si, VARSIZE_ANY_EXHDR(outputbytes), 4);
+	pq_sendbytes(si, VARDATA_ANY(outputbytes), VARSIZE_ANY_EXHDR(outputbytes));
+	pfree(outputbytes);
+}
+
+/* See record_recv() */
+static Datum
+prop_map_recv_si(StringInfo si)
+{
+	int			itemlen;
+	StringInfoData item_buf;
+	char		csave;
+	Datum		prop_map;
+
+	itemlen = pq_getmsgint(si, 4);
+	if (itemlen < 0 || itemlen > (si->len - si->cursor))
+		ereport(ERROR,
+				(errcode(ERRCODE_INVALID_BINARY_REPRESENTATION),
+				 errmsg("insufficient data left in message")));
+
+	item_buf.data = &si->data[si->cursor];
+	item_buf.maxlen = itemlen + 1;
+	item_buf.len = itemlen;
+	item_buf.cursor = 0;
+
+	si->cursor += itemlen;
+
+	csave = si->data[si->cursor];
+	si->data[si->cursor] = '\0';
+
+	prop_map = DirectFunctionCall1(jsonb_recv, PointerGetDatum(&item_buf));
+
+	if (item_buf.cursor != itemlen)
+		ereport(ERROR,
+				(errcode(ERRCODE_INVALID_BINARY_REPRESENTATION),
+				 errmsg("improper binary format in properties")));
+
+	si->data[si->cursor] = csave;
+
+	return prop_map;
+}
+
+static void
+tid_send_si(StringInfo si, Datum tid, bool isnull)
+{
+	ItemPointer itemPtr;
+
+	pq_sendbyte(si, isnull ? 0 : 1);
+	if (isnull)
+		return;
+
+	itemPtr = DatumGetItemPointer(tid);
+	pq_sendint(si, ItemPointerGetBlockNumberNoCheck(itemPtr),
+			   sizeof(BlockNumber));
+	pq_sendint(si, ItemPointerGetOffsetNumberNoCheck(itemPtr),
+			   sizeof(OffsetNumber));
+}
+
+static Datum
+tid_recv_si(StringInfo si, bool *isnull)
+{
+	BlockNumber blockNumber;
+	OffsetNumber offsetNumber;
+	ItemPointer itemPtr;
+
+	*isnull = (pq_getmsgbyte(si) == 0);
+	if (*isnull)
+		return (Datum) 0;
+
+	blockNumber = pq_getmsgint(si, sizeof(blockNumber));
+	offsetNumber = pq_getmsgint(si, sizeof(offsetNumber));
+
+	itemPtr = (ItemPointer) palloc(sizeof(ItemPointerData));
+	ItemPointerSetBlockNumber(itemPtr, blockNumber);
+	ItemPointerSetOffsetNumber(itemPtr, offsetNumber);
+
+	return ItemPointerGetDatum(itemPtr);
+}
+
 static void
 deform_tuple(HeapTupleHeader tuphdr, Datum *values, bool *isnull)
 {
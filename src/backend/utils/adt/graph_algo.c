@@ -0,0 +1,865 @@
+/*
+ * graph_algo.c
+ *	  Graph algorithms over an in-memory snapshot of graph labels
+ *
+ * The functions in this file read the vertices of a vertex label and the
+ * edges of an edge label (including their child labels) into a compressed
+ * sparse row (CSR) snapshot and run a whole-graph algorithm on it.  The
+ * memory used by the snapshot and the algorithm is bounded by
+ * graph_algorithm_work_mem.
+ *
+ * The edges are read from the graph topology cache instead of the tables if
+ * the edge label has been loaded into the cache by topology_cache_load() and
+ * the cached topology is usable with the active snapshot.
+ *
+ * Copyright (c) 2017 by Bitnine Global, Inc.
+ *
+ * IDENTIFICATION
+ *	  src/backend/utils/adt/graph_algo.c
+ */
+
+#include "postgres.h"
+
+#include "ag_const.h"
+#include "access/heapam.h"
+#include "access/htup_details.h"
+#include "catalog/ag_graph_fn.h"
+#include "catalog/ag_label.h"
+#include "catalog/pg_inherits_fn.h"
+#include "funcapi.h"
+#include "miscadmin.h"
+#include "utils/acl.h"
+#include "utils/builtins.h"
+#include "utils/graph.h"
+#include "utils/lsyscache.h"
+#include "utils/memutils.h"
+#include "utils/rel.h"
+#include "utils/rls.h"
+#include "utils/snapmgr.h"
+#include "utils/syscache.h"
+#include "utils/topocache.h"
+#include "utils/tuplestore.h"
+
+/*
+ * Snapshot of a graph
+ *
+ * Vertices have dense indices from 0 to nvertices - 1.  vids is sorted once
+ * all the vertices are read, so the index of a vertex is found by a binary
+ * search of its graphid.  This takes the same memory however sparse the
+ * local IDs of a label are.  Edges are kept as pairs of vertex indices until
+ * an algorithm builds the adjacency lists it needs.
+ */
+typedef struct GraphSnapshot
+{
+	MemoryContext mcxt;
+	Size		mem_limit;
+	Size		mem_used;
+
+	int32		nvertices;
+	int32		maxvertices;
+	Graphid    *vids;			/* sorted by sort_vertices() */
+
+	int64		nedges;
+	int64		maxedges;
+	int32	   *srcs;
+	int32	   *dsts;
+} GraphSnapshot;
+
+/* adjacency lists in CSR form */
+typedef struct CSRAdjacency
+{
+	int64	   *offsets;		/* nvertices + 1 entries */
+	int32	   *targets;
+} CSRAdjacency;
+
+static Tuplestorestate *init_materialize_srf(FunctionCallInfo fcinfo,
+					 TupleDesc *tupdesc);
+static GraphSnapshot *build_snapshot(text *vlabel, text *elabel);
+static void free_snapshot(GraphSnapshot *snap);
+static void *snapshot_alloc(GraphSnapshot *snap, Size size);
+static void *snapshot_realloc(GraphSnapshot *snap, void *pointer,
+				 Size oldsize, Size newsize);
+static Oid	get_label_relid(text *labname, char labkind);
+static void scan_vertices(GraphSnapshot *snap, Oid relid);
+static void scan_edges(GraphSnapshot *snap, Oid relid);
+static void add_cached_edge(Graphid id, Graphid start, Graphid end,
+				void *arg);
+static void add_vertex(GraphSnapshot *snap, Graphid id);
+static void sort_vertices(GraphSnapshot *snap);
+static int32 find_vertex(GraphSnapshot *snap, Graphid id);
+static void add_edge(GraphSnapshot *snap, int32 src, int32 dst);
+static void build_adjacency(GraphSnapshot *snap, CSRAdjacency *adj,
+				bool outgoing, bool incoming);
+static int32 find_root(int32 *parent, int32 v);
+static int	int32_cmp(const void *a, const void *b);
+static int	graphid_cmp(const void *a, const void *b);
+
+/*
+ * pagerank(vlabel, elabel, damping, iterations) - PageRank of vertices
+ *
+ * The rank of dangling vertices (vertices having no outgoing edges) is
+ * distributed to all vertices evenly.
+ */
+Datum
+graph_pagerank(PG_FUNCTION_ARGS)
+{
+	float8		damping = PG_GETARG_FLOAT8(2);
+	int32		iterations = PG_GETARG_INT32(3);
+	Tuplestorestate *tupstore;
+	TupleDesc	tupdesc;
+	GraphSnapshot *snap;
+	CSRAdjacency in;
+	int32	   *outdeg;
+	float8	   *rank;
+	float8	   *contrib;
+	int32		n;
+	int32		i;
+	int32		v;
+	int64		e;
+
+	if (damping < 0.0 || damping > 1.0)
+		ereport(ERROR,
+				(errcode(ERRCODE_INVALID_PARAMETER_VALUE),
+				 errmsg("damping factor must be between 0 and 1")));
+	if (iterations < 0)
+		ereport(ERROR,
+				(errcode(ERRCODE_INVALID_PARAMETER_VALUE),
+				 errmsg("number of iterations must not be negative")));
+
+	tupstore = init_materialize_srf(fcinfo, &tupdesc);
+
+	snap = build_snapshot(PG_GETARG_TEXT_PP(0), PG_GETARG_TEXT_PP(1));
+	n = snap->nvertices;
+	if (n == 0)
+	{
+		free_snapshot(snap);
+		return (Datum) 0;
+	}
+
+	outdeg = snapshot_alloc(snap, sizeof(int32) * n);
+	rank = snapshot_alloc(snap, sizeof(float8) * n);
+	contrib = snapshot_alloc(snap, sizeof(float8) * n);
+
+	build_adjacency(snap, &in, false, true);
+
+	memset(outdeg, 0, sizeof(int32) * n);
+	for (e = 0; e < snap->nedges; e++)
+		outdeg[snap->srcs[e]]++;
+
+	for (v = 0; v < n; v++)
+		rank[v] = 1.0 / n;
+
+	for (i = 0; i < iterations; i++)
+	{
+		float8		dangling = 0.0;
+		float8		base;
+
+		CHECK_FOR_INTERRUPTS();
+
+		for (v = 0; v < n; v++)
+		{
+			if (outdeg[v] > 0)
+				contrib[v] = rank[v] / outdeg[v];
+			else
+			{
+				contrib[v] = 0.0;
+				dangling += rank[v];
+			}
+		}
+
+		base = (1.0 - damping) / n + damping * dangling / n;
+		for (v = 0; v < n; v++)
+		{
+			float8		sum = 0.0;
+
+			for (e = in.offsets[v]; e < in.offsets[v + 1]; e++)
+				sum += contrib[in.targets[e]];
+
+			rank[v] = base + damping * sum;
+		}
+	}
+
+	for (v = 0; v < n; v++)
+	{
+		Datum		values[2];
+		bool		isnull[2] = {false, false};
+
+		values[0] = GraphidGetDatum(snap->vids[v]);
+		values[1] = Float8GetDatum(rank[v]);
+		tuplestore_putvalues(tupstore, tupdesc, values, isnull);
+	}
+
+	free_snapshot(snap);
+
+	return (Datum) 0;
+}
+
+/*
+ * weakly_connected_components(vlabel, elabel) - component of each vertex
+ *
+ * A component is identified by the smallest graphid of its vertices.
+ */
+Datum
+graph_wcc(PG_FUNCTION_ARGS)
+{
+	Tuplestorestate *tupstore;
+	TupleDesc	tupdesc;
+	GraphSnapshot *snap;
+	int32	   *parent;
+	Graphid    *minid;
+	int32		n;
+	int32		v;
+	int64		e;
+
+	tupstore = init_materialize_srf(fcinfo, &tupdesc);
+
+	snap = build_snapshot(PG_GETARG_TEXT_PP(0), PG_GETARG_TEXT_PP(1));
+	n = snap->nvertices;
+
+	parent = snapshot_alloc(snap, sizeof(int32) * Max(n, 1));
+	minid = snapshot_alloc(snap, sizeof(Graphid) * Max(n, 1));
+
+	for (v = 0; v < n; v++)
+		parent[v] = v;
+
+	for (e = 0; e < snap->nedges; e++)
+	{
+		int32		a = find_root(parent, snap->srcs[e]);
+		int32		b = find_root(parent, snap->dsts[e]);
+
+		if ((e & 0xffff) == 0)
+			CHECK_FOR_INTERRUPTS();
+
+		if (a < b)
+			parent[b] = a;
+		else if (b < a)
+			parent[a] = b;
+	}
+
+	for (v = 0; v < n; v++)
+		minid[v] = PG_UINT64_MAX;
+	for (v = 0; v < n; v++)
+	{
+		int32		r = find_root(parent, v);
+
+		if (snap->vids[v] < minid[r])
+			minid[r] = snap->vids[v];
+	}
+
+	for (v = 0; v < n; v++)
+	{
+		Datum		values[2];
+		bool		isnull[2] = {false, false};
+
+		values[0] = GraphidGetDatum(snap->vids[v]);
+		values[1] = GraphidGetDatum(minid[find_root(parent, v)]);
+		tuplestore_putvalues(tupstore, tupdesc, values, isnull);
+	}
+
+	free_snapshot(snap);
+
+	return (Datum) 0;
+}
+
+/*
+ * triangle_count(vlabel, elabel) - number of triangles of each vertex
+ *
+ * Edges are treated as undirected.  Self-loops and parallel edges are
+ * ignored.  Each triangle is found once from its vertex having the smallest
+ * index by intersecting the sorted lists of neighbors having larger indices.
+ */
+Datum
+graph_triangle_count(PG_FUNCTION_ARGS)
+{
+	Tuplestorestate *tupstore;
+	TupleDesc	tupdesc;
+	GraphSnapshot *snap;
+	CSRAdjacency adj;
+	int64	   *fwd;			/* start of the neighbors having larger index */
+	int64	   *fwdend;
+	int64	   *count;
+	int32		n;
+	int32		u;
+
+	tupstore = init_materialize_srf(fcinfo, &tupdesc);
+
+	snap = build_snapshot(PG_GETARG_TEXT_PP(0), PG_GETARG_TEXT_PP(1));
+	n = snap->nvertices;
+
+	build_adjacency(snap, &adj, true, true);
+
+	fwd = snapshot_alloc(snap, sizeof(int64) * Max(n, 1));
+	fwdend = snapshot_alloc(snap, sizeof(int64) * Max(n, 1));
+	count = snapshot_alloc(snap, sizeof(int64) * Max(n, 1));
+
+	/* sort and deduplicate the neighbors, keep the ones after the vertex */
+	for (u = 0; u < n; u++)
+	{
+		int64		start = adj.offsets[u];
+		int64		end = adj.offsets[u + 1];
+		int64		i;
+		int64		j;
+
+		qsort(adj.targets + start, end - start, sizeof(int32), int32_cmp);
+
+		j = start;
+		for (i = start; i < end; i++)
+		{
+			int32		w = adj.targets[i];
+
+			if (w <= u || (j > start && adj.targets[j - 1] == w))
+				continue;
+			adj.targets[j++] = w;
+		}
+		fwd[u] = start;
+		fwdend[u] = j;
+		count[u] = 0;
+	}
+
+	for (u = 0; u < n; u++)
+	{
+		int64		i;
+
+		CHECK_FOR_INTERRUPTS();
+
+		for (i = fwd[u]; i < fwdend[u]; i++)
+		{
+			int32		v = adj.targets[i];
+			int64		a = i + 1;
+			int64		b = fwd[v];
+
+			/* u < v < w for all w in both lists */
+			while (a < fwdend[u] && b < fwdend[v])
+			{
+				int32		wa = adj.targets[a];
+				int32		wb = adj.targets[b];
+
+				if (wa < wb)
+					a++;
+				else if (wa > wb)
+					b++;
+				else
+				{
+					count[u]++;
+					count[v]++;
+					count[wa]++;
+					a++;
+					b++;
+				}
+			}
+		}
+	}
+
+	for (u = 0; u < n; u++)
+	{
+		Datum		values[2];
+		bool		isnull[2] = {false, false};
+
+		values[0] = GraphidGetDatum(snap->vids[u]);
+		values[1] = Int64GetDatum(count[u]);
+		tuplestore_putvalues(tupstore, tupdesc, values, isnull);
+	}
+
+	free_snapshot(snap);
+
+	return (Datum) 0;
+}
+
+/*
+ * degree_centrality(vlabel, elabel) - degrees of each vertex
+ *
+ * The centrality is the degree divided by the maximum possible degree
+ * (the number of the other vertices).
+ */
+Datum
+graph_degree_centrality(PG_FUNCTION_ARGS)
+{
+	Tuplestorestate *tupstore;
+	TupleDesc	tupdesc;
+	GraphSnapshot *snap;
+	int64	   *indeg;
+	int64	   *outdeg;
+	int32		n;
+	int32		v;
+	int64		e;
+
+	tupstore = init_materialize_srf(fcinfo, &tupdesc);
+
+	snap = build_snapshot(PG_GETARG_TEXT_PP(0), PG_GETARG_TEXT_PP(1));
+	n = snap->nvertices;
+
+	indeg = snapshot_alloc(snap, sizeof(int64) * Max(n, 1));
+	outdeg = snapshot_alloc(snap, sizeof(int64) * Max(n, 1));
+	memset(indeg, 0, sizeof(int64) * n);
+	memset(outdeg, 0, sizeof(int64) * n);
+
+	for (e = 0; e < snap->nedges; e++)
+	{
+		outdeg[snap->srcs[e]]++;
+		indeg[snap->dsts[e]]++;
+	}
+
+	for (v = 0; v < n; v++)
+	{
+		Datum		values[4];
+		bool		isnull[4] = {false, false, false, false};
+
+		values[0] = GraphidGetDatum(snap->vids[v]);
+		values[1] = Int64GetDatum(indeg[v]);
+		values[2] = Int64GetDatum(outdeg[v]);
+		values[3] = Float8GetDatum(n > 1 ?
+								   (float8) (indeg[v] + outdeg[v]) / (n - 1) :
+								   0.0);
+		tuplestore_putvalues(tupstore, tupdesc, values, isnull);
+	}
+
+	free_snapshot(snap);
+
+	return (Datum) 0;
+}
+
+/*
+ * topology_cache_load(elabel) - load the edges of an edge label (including
+ * its child labels) into the graph topology cache
+ *
+ * Returns the number of edges loaded.  The writers of the label are blocked
+ * until the end of the current transaction.
+ */
+Datum
+graph_topology_cache_load(PG_FUNCTION_ARGS)
+{
+	Oid			erelid = get_label_relid(PG_GETARG_TEXT_PP(0), LABEL_KIND_EDGE);
+	List	   *erelids;
+	ListCell   *lc;
+	int64		nedges = 0;
+
+	erelids = find_all_inheritors(erelid, AccessShareLock, NULL);
+	foreach(lc, erelids)
+		nedges += TopologyCacheLoad(lfirst_oid(lc));
+
+	PG_RETURN_INT64(nedges);
+}
+
+static Tuplestorestate *
+init_materialize_srf(FunctionCallInfo fcinfo, TupleDesc *tupdesc)
+{
+	ReturnSetInfo *rsinfo = (ReturnSetInfo *) fcinfo->resultinfo;
+	Tuplestorestate *tupstore;
+	MemoryContext oldcontext;
+
+	/* check to see if caller supports us returning a tuplestore */
+	if (rsinfo == NULL || !IsA(rsinfo, ReturnSetInfo))
+		ereport(ERROR,
+				(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+				 errmsg("set-valued function called in context that cannot accept a set")));
+	if (!(rsinfo->allowedModes & SFRM_Materialize))
+		ereport(ERROR,
+				(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+				 errmsg("materialize mode required, but it is not " \
+						"allowed in this context")));
+
+	oldcontext = MemoryContextSwitchTo(rsinfo->econtext->ecxt_per_query_memory);
+
+	/* Build a tuple descriptor for our result type */
+	if (get_call_result_type(fcinfo, NULL, tupdesc) != TYPEFUNC_COMPOSITE)
+		elog(ERROR, "return type must be a row type");
+
+	tupstore = tuplestore_begin_heap(true, false, work_mem);
+	rsinfo->returnMode = SFRM_Materialize;
+	rsinfo->setResult = tupstore;
+	rsinfo->setDesc = *tupdesc;
+
+	MemoryContextSwitchTo(oldcontext);
+
+	return tupstore;
+}
+
+static GraphSnapshot *
+build_snapshot(text *vlabel, text *elabel)
+{
+	Oid			vrelid = get_label_relid(vlabel, LABEL_KIND_VERTEX);
+	Oid			erelid = get_label_relid(elabel, LABEL_KIND_EDGE);
+	GraphSnapshot *snap;
+	MemoryContext mcxt;
+	List	   *vrelids;
+	List	   *erelids;
+	ListCell   *lc;
+
+	vrelids = find_all_inheritors(vrelid, AccessShareLock, NULL);
+	erelids = find_all_inheritors(erelid, AccessShareLock, NULL);
+
+	mcxt = AllocSetContextCreate(CurrentMemoryContext,
+								 "graph algorithm snapshot",
+								 ALLOCSET_DEFAULT_SIZES);
+
+	snap = MemoryContextAllocZero(mcxt, sizeof(*snap));
+	snap->mcxt = mcxt;
+	snap->mem_limit = (Size) graph_algorithm_work_mem * 1024L;
+
+	foreach(lc, vrelids)
+		scan_vertices(snap, lfirst_oid(lc));
+	sort_vertices(snap);
+
+	foreach(lc, erelids)
+	{
+		Oid			relid = lfirst_oid(lc);
+
+		if (!TopologyCacheScanEdges(relid, GetActiveSnapshot(),
+									add_cached_edge, snap))
+			scan_edges(snap, relid);
+	}
+
+	return snap;
+}
+
+static void
+free_snapshot(GraphSnapshot *snap)
+{
+	MemoryContextDelete(snap->mcxt);
+}
+
+static void *
+snapshot_alloc(GraphSnapshot *snap, Size size)
+{
+	if (snap->mem_used + size > snap->mem_limit)
+		ereport(ERROR,
+				(errcode(ERRCODE_PROGRAM_LIMIT_EXCEEDED),
+				 errmsg("graph does not fit in graph_algorithm_work_mem"),
+				 errdetail("The snapshot of the graph needs more than %d kB.",
+						   graph_algorithm_work_mem),
+				 errhint("Increase graph_algorithm_work_mem or choose smaller labels.")));
+
+	snap->mem_used += size;
+
+	return MemoryContextAllocHuge(snap->mcxt, size);
+}
+
+static void *
+snapshot_realloc(GraphSnapshot *snap, void *pointer, Size oldsize,
+				 Size newsize)
+{
+	void	   *newpointer;
+
+	newpointer = snapshot_alloc(snap, newsize);
+	memcpy(newpointer, pointer, oldsize);
+	pfree(pointer);
+	snap->mem_used -= oldsize;
+
+	return newpointer;
+}
+
+/*
+ * Find the table of a label in the current graph and check that the current
+ * user can read it.  The table is read without row-level security policies,
+ * so a label whose rows would be filtered for the user is refused.
+ */
+static Oid
+get_label_relid(text *labname, char labkind)
+{
+	char	   *name = text_to_cstring(labname);
+	HeapTuple	tuple;
+	Form_ag_label labtup;
+	Oid			relid;
+	AclResult	aclresult;
+
+	tuple = SearchSysCache2(LABELNAMEGRAPH, CStringGetDatum(name),
+							ObjectIdGetDatum(get_graph_path_oid()));
+	if (!HeapTupleIsValid(tuple))
+		ereport(ERROR,
+				(errcode(ERRCODE_UNDEFINED_OBJECT),
+				 errmsg("label \"%s\" does not exist", name)));
+
+	labtup = (Form_ag_label) GETSTRUCT(tuple);
+	if (labtup->labkind != labkind)
+		ereport(ERROR,
+				(errcode(ERRCODE_WRONG_OBJECT_TYPE),
+				 errmsg("\"%s\" is not %s label", name,
+						(labkind == LABEL_KIND_VERTEX ? "a vertex" : "an edge"))));
+	relid = labtup->relid;
+	ReleaseSysCache(tuple);
+
+	aclresult = pg_class_aclcheck(relid, GetUserId(), ACL_SELECT);
+	if (aclresult != ACLCHECK_OK)
+		aclcheck_error(aclresult, ACL_KIND_CLASS, get_rel_name(relid));
+
+	if (check_enable_rls(relid, InvalidOid, true) == RLS_ENABLED)
+		ereport(ERROR,
+				(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+				 errmsg("graph algorithms are not supported on label \"%s\" with row-level security enabled",
+						name)));
+
+	return relid;
+}
+
+static void
+scan_vertices(GraphSnapshot *snap, Oid relid)
+{
+	Relation	rel;
+	AttrNumber	id_attno;
+	HeapScanDesc scan;
+	HeapTuple	tuple;
+
+	rel = heap_open(relid, NoLock);
+	id_attno = get_attnum(relid, AG_ELEM_LOCAL_ID);
+
+	scan = heap_beginscan(rel, GetActiveSnapshot(), 0, NULL);
+	while ((tuple = heap_getnext(scan, ForwardScanDirection)) != NULL)
+	{
+		Datum		id;
+		bool		isnull;
+
+		CHECK_FOR_INTERRUPTS();
+
+		id = heap_getattr(tuple, id_attno, RelationGetDescr(rel), &isnull);
+		if (!isnull)
+			add_vertex(snap, DatumGetGraphid(id));
+	}
+	heap_endscan(scan);
+
+	heap_close(rel, NoLock);
+}
+
+/* edges having an end vertex which is not in the snapshot are ignored */
+static void
+scan_edges(GraphSnapshot *snap, Oid relid)
+{
+	Relation	rel;
+	AttrNumber	start_attno;
+	AttrNumber	end_attno;
+	HeapScanDesc scan;
+	HeapTuple	tuple;
+
+	rel = heap_open(relid, NoLock);
+	start_attno = get_attnum(relid, AG_START_ID);
+	end_attno = get_attnum(relid, AG_END_ID);
+
+	scan = heap_beginscan(rel, GetActiveSnapshot(), 0, NULL);
+	while ((tuple = heap_getnext(scan, ForwardScanDirection)) != NULL)
+	{
+		Datum		start;
+		Datum		end;
+		bool		isnull;
+		int32		src;
+		int32		dst;
+
+		CHECK_FOR_INTERRUPTS();
+
+		start = heap_getattr(tuple, start_attno, RelationGetDescr(rel),
+							 &isnull);
+		if (isnull)
+			continue;
+		end = heap_getattr(tuple, end_attno, RelationGetDescr(rel), &isnull);
+		if (isnull)
+			continue;
+
+		src = find_vertex(snap, DatumGetGraphid(start));
+		dst = find_vertex(snap, DatumGetGraphid(end));
+		if (src < 0 || dst < 0)
+			continue;
+
+		add_edge(snap, src, dst);
+	}
+	heap_endscan(scan);
+
+	heap_close(rel, NoLock);
+}
+
+static void
+add_cached_edge(Graphid id, Graphid start, Graphid end, void *arg)
+{
+	GraphSnapshot *snap = (GraphSnapshot *) arg;
+	int32		src;
+	int32		dst;
+
+	src = find_vertex(snap, start);
+	dst = find_vertex(snap, end);
+	if (src < 0 || dst < 0)
+		return;
+
+	add_edge(snap, src, dst);
+}
+
+static void
+add_vertex(GraphSnapshot *snap, Graphid id)
+{
+	if (snap->nvertices >= snap->maxvertices)
+	{
+		int32		newmax;
+
+		if (snap->maxvertices >= PG_INT32_MAX / 2)
+			ereport(ERROR,
+					(errcode(ERRCODE_PROGRAM_LIMIT_EXCEEDED),
+					 errmsg("too many vertices in the graph")));
+
+		newmax = Max(snap->maxvertices * 2, 1024);
+		if (snap->vids == NULL)
+			snap->vids = snapshot_alloc(snap, sizeof(Graphid) * newmax);
+		else
+			snap->vids = snapshot_realloc(snap, snap->vids,
+										  sizeof(Graphid) * snap->maxvertices,
+										  sizeof(Graphid) * newmax);
+		snap->maxvertices = newmax;
+	}
+
+	snap->vids[snap->nvertices++] = id;
+}
+
+/*
+ * Sort the vertices by graphid so that find_vertex() can search them.  The
+ * same vertex may be read more than once if its ID has been given, and only
+ * one of them is kept.
+ */
+static void
+sort_vertices(GraphSnapshot *snap)
+{
+	int32		i;
+	int32		n;
+
+	if (snap->nvertices == 0)
+		return;
+
+	qsort(snap->vids, snap->nvertices, sizeof(Graphid), graphid_cmp);
+
+	n = 1;
+	for (i = 1; i < snap->nvertices; i++)
+	{
+		if (snap->vids[i] != snap->vids[n - 1])
+			snap->vids[n++] = snap->vids[i];
+	}
+	snap->nvertices = n;
+}
+
+/* returns the index of the vertex, or -1 if it is not in the snapshot */
+static int32
+find_vertex(GraphSnapshot *snap, Graphid id)
+{
+	int32		lo = 0;
+	int32		hi = snap->nvertices - 1;
+
+	while (lo <= hi)
+	{
+		int32		mid = lo + (hi - lo) / 2;
+		Graphid		vid = snap->vids[mid];
+
+		if (vid < id)
+			lo = mid + 1;
+		else if (vid > id)
+			hi = mid - 1;
+		else
+			return mid;
+	}
+
+	return -1;
+}
+
+static void
+add_edge(GraphSnapshot *snap, int32 src, int32 dst)
+{
+	if (snap->nedges >= snap->maxedges)
+	{
+		int64		newmax = Max(snap->maxedges * 2, 1024);
+
+		if (snap->srcs == NULL)
+		{
+			snap->srcs = snapshot_alloc(snap, sizeof(int32) * newmax);
+			snap->dsts = snapshot_alloc(snap, sizeof(int32) * newmax);
+		}
+		else
+		{
+			snap->srcs = snapshot_realloc(snap, snap->srcs,
+										  sizeof(int32) * snap->maxedges,
+										  sizeof(int32) * newmax);
+			snap->dsts = snapshot_realloc(snap, snap->dsts,
+										  sizeof(int32) * snap->maxedges,
+										  sizeof(int32) * newmax);
+		}
+		snap->maxedges = newmax;
+	}
+
+	snap->srcs[snap->nedges] = src;
+	snap->dsts[snap->nedges] = dst;
+	snap->nedges++;
+}
+
+/*
+ * Build adjacency lists from the edges.  The list of a vertex has the end
+ * vertices of its outgoing edges if `outgoing` and the start vertices of its
+ * incoming edges if `incoming`.
+ */
+static void
+build_adjacency(GraphSnapshot *snap, CSRAdjacency *adj, bool outgoing,
+				bool incoming)
+{
+	int32		n = snap->nvertices;
+	int64		nentries = 0;
+	int64	   *pos;
+	int32		v;
+	int64		e;
+
+	adj->offsets = snapshot_alloc(snap, sizeof(int64) * (n + 1));
+	if (outgoing)
+		nentries += snap->nedges;
+	if (incoming)
+		nentries += snap->nedges;
+	adj->targets = snapshot_alloc(snap, sizeof(int32) * Max(nentries, 1));
+	pos = snapshot_alloc(snap, sizeof(int64) * (n + 1));
+
+	memset(adj->offsets, 0, sizeof(int64) * (n + 1));
+	for (e = 0; e < snap->nedges; e++)
+	{
+		if (outgoing)
+			adj->offsets[snap->srcs[e] + 1]++;
+		if (incoming)
+			adj->offsets[snap->dsts[e] + 1]++;
+	}
+	for (v = 0; v < n; v++)
+		adj->offsets[v + 1] += adj->offsets[v];
+
+	memcpy(pos, adj->offsets, sizeof(int64) * (n + 1));
+	for (e = 0; e < snap->nedges; e++)
+	{
+		if (outgoing)
+			adj->targets[pos[snap->srcs[e]]++] = snap->dsts[e];
+		if (incoming)
+			adj->targets[pos[snap->dsts[e]]++] = snap->srcs[e];
+	}
+}
+
+/* find the root of `v` in the union-find forest with path halving */
+static int32
+find_root(int32 *parent, int32 v)
+{
+	while (parent[v] != v)
+	{
+		parent[v] = parent[parent[v]];
+		v = parent[v];
+	}
+
+	return v;
+}
+
+static int
+int32_cmp(const void *a, const void *b)
+{
+	int32		ia = *((const int32 *) a);
+	int32		ib = *((const int32 *) b);
+
+	if (ia < ib)
+		return -1;
+	if (ia > ib)
+		return 1;
+	return 0;
+}
+
+static int
+graphid_cmp(const void *a, const void *b)
+{
+	Graphid		ga = *((const Graphid *) a);
+	Graphid		gb = *((const Graphid *) b);
+
+	if (ga < gb)
+		return -1;
+	if (ga > gb)
+		return 1;
+	return 0;
+}
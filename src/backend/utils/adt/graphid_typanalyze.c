@@ -0,0 +1,185 @@
+/*
+ * graphid_typanalyze.c
+ *	  Functions for gathering statistics from graphid columns
+ *
+ * Copyright (c) 2017 by Bitnine Global, Inc.
+ *
+ * IDENTIFICATION
+ *	  src/backend/utils/adt/graphid_typanalyze.c
+ */
+
+#include "postgres.h"
+
+#include "catalog/pg_statistic.h"
+#include "commands/vacuum.h"
+#include "utils/graph.h"
+
+/* Extra data for compute_graphid_stats function */
+typedef struct
+{
+	/* Saved state from std_typanalyze() */
+	AnalyzeAttrComputeStatsFunc std_compute_stats;
+	void	   *std_extra_data;
+} GraphidAnalyzeExtraData;
+
+static void compute_graphid_stats(VacAttrStats *stats,
+					  AnalyzeAttrFetchFunc fetchfunc, int samplerows,
+					  double totalrows);
+static int	graphid_cmp(const void *a, const void *b);
+
+/*
+ * graphid_typanalyze -- typanalyze function for graphid columns
+ */
+Datum
+graphid_typanalyze(PG_FUNCTION_ARGS)
+{
+	VacAttrStats *stats = (VacAttrStats *) PG_GETARG_POINTER(0);
+	GraphidAnalyzeExtraData *extra_data;
+
+	if (!std_typanalyze(stats))
+		PG_RETURN_BOOL(false);
+
+	extra_data = palloc(sizeof(*extra_data));
+	extra_data->std_compute_stats = stats->compute_stats;
+	extra_data->std_extra_data = stats->extra_data;
+
+	stats->compute_stats = compute_graphid_stats;
+	stats->extra_data = extra_data;
+
+	PG_RETURN_BOOL(true);
+}
+
+/*
+ * compute_graphid_stats() -- compute statistics for a graphid column
+ *
+ * In addition to the standard scalar statistics, we compute the degree
+ * statistics (see STATISTIC_KIND_DEGREE) which the planner uses to estimate
+ * the fan-out of traversals over edges.
+ *
+ * The number of distinct values is the number of vertices and the number of
+ * rows is the number of edges, so the average degree follows from the
+ * standard statistics.  For the sum of squared degrees, we use the repeat
+ * rate of the sample: if c(v) is the number of sample rows having v, then
+ * sum(c(v) * (c(v) - 1)) / (n * (n - 1)) is an unbiased estimate of
+ * sum(d(v) * (d(v) - 1)) / (N * (N - 1)) where n and N are the number of
+ * sample rows and the total number of rows.
+ */
+static void
+compute_graphid_stats(VacAttrStats *stats, AnalyzeAttrFetchFunc fetchfunc,
+					  int samplerows, double totalrows)
+{
+	GraphidAnalyzeExtraData *extra_data;
+	Graphid    *values;
+	int			nvalues = 0;
+	double		ndistinct;
+	double		nrows;
+	double		pairs = 0.0;
+	int			maxcount = 0;
+	double		avg_degree;
+	double		sb_degree;
+	double		max_degree;
+	int			slot_idx;
+	int			i;
+	MemoryContext old_context;
+	float4	   *mynumbers;
+
+	extra_data = (GraphidAnalyzeExtraData *) stats->extra_data;
+
+	/* create the standard statistics first, we need stadistinct */
+	stats->extra_data = extra_data->std_extra_data;
+	(*extra_data->std_compute_stats) (stats, fetchfunc, samplerows, totalrows);
+	stats->extra_data = extra_data;
+
+	if (!stats->stats_valid || stats->stadistinct == 0.0)
+		return;
+
+	values = palloc(samplerows * sizeof(Graphid));
+	for (i = 0; i < samplerows; i++)
+	{
+		Datum		value;
+		bool		isnull;
+
+		vacuum_delay_point();
+
+		value = fetchfunc(stats, i, &isnull);
+		if (isnull)
+			continue;
+
+		values[nvalues++] = DatumGetGraphid(value);
+	}
+
+	if (nvalues < 2)
+	{
+		pfree(values);
+		return;
+	}
+
+	qsort(values, nvalues, sizeof(Graphid), graphid_cmp);
+
+	for (i = 0; i < nvalues;)
+	{
+		int			j = i + 1;
+		double		count;
+
+		while (j < nvalues && values[j] == values[i])
+			j++;
+
+		count = j - i;
+		pairs += count * (count - 1);
+		if (j - i > maxcount)
+			maxcount = j - i;
+
+		i = j;
+	}
+
+	pfree(values);
+
+	nrows = totalrows * (1.0 - stats->stanullfrac);
+	if (stats->stadistinct > 0)
+		ndistinct = stats->stadistinct;
+	else
+		ndistinct = -stats->stadistinct * totalrows;
+	if (nrows < 1.0 || ndistinct < 1.0)
+		return;
+
+	avg_degree = Max(nrows / ndistinct, 1.0);
+	sb_degree = (nrows - 1.0) * pairs / ((double) nvalues * (nvalues - 1)) + 1.0;
+	sb_degree = Max(sb_degree, avg_degree);
+	max_degree = Max(maxcount * nrows / nvalues, sb_degree);
+
+	/* find an empty slot, std_compute_stats() fills some of them */
+	for (slot_idx = 0; slot_idx < STATISTIC_NUM_SLOTS; slot_idx++)
+	{
+		if (stats->stakind[slot_idx] == 0)
+			break;
+	}
+	if (slot_idx >= STATISTIC_NUM_SLOTS)
+		return;
+
+	old_context = MemoryContextSwitchTo(stats->anl_context);
+
+	mynumbers = palloc(3 * sizeof(float4));
+	mynumbers[0] = avg_degree;
+	mynumbers[1] = sb_degree;
+	mynumbers[2] = max_degree;
+
+	MemoryContextSwitchTo(old_context);
+
+	stats->stakind[slot_idx] = STATISTIC_KIND_DEGREE;
+	stats->staop[slot_idx] = InvalidOid;
+	stats->stanumbers[slot_idx] = mynumbers;
+	stats->numnumbers[slot_idx] = 3;
+}
+
+static int
+graphid_cmp(const void *a, const void *b)
+{
+	Graphid		ga = *((const Graphid *) a);
+	Graphid		gb = *((const Graphid *) b);
+
+	if (ga < gb)
+		return -1;
+	if (ga > gb)
+		return 1;
+	return 0;
+}
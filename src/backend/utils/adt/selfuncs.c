@@ -172,6 +172,7 @@ static double eqjoinsel_semi(Oid operator,
 			   RelOptInfo *inner_rel);
 static bool estimate_multivariate_ndistinct(PlannerInfo *root,
 								RelOptInfo *rel, List **varinfos, double *ndistinct);
+static double graph_rel_tuples(PlannerInfo *root, RelOptInfo *rel);
 static bool convert_to_scalar(Datum value, Oid valuetypid, double *scaledvalue,
 				  Datum lobound, Datum hibound, Oid boundstypid,
 				  double *scaledlobound, double *scaledhibound);
@@ -3721,6 +3722,130 @@ estimate_hash_bucketsize(PlannerInfo *root, Node *hashkey, double nbuckets)
 	return (Selectivity) estfract;
 }
 
+/*
+ * The tuples of an appendrel are the rows of its children, count the tuples
+ * of the children instead.
+ */
+static double
+graph_rel_tuples(PlannerInfo *root, RelOptInfo *rel)
+{
+	double		tuples = 0.0;
+	ListCell   *lc;
+
+	if (!root->simple_rte_array[rel->relid]->inh)
+		return rel->tuples;
+
+	foreach(lc, root->append_rel_list)
+	{
+		AppendRelInfo *appinfo = lfirst(lc);
+		RelOptInfo *childrel;
+
+		if (appinfo->parent_relid != rel->relid)
+			continue;
+
+		childrel = root->simple_rel_array[appinfo->child_relid];
+		if (childrel != NULL)
+			tuples += childrel->tuples;
+	}
+
+	return tuples;
+}
+
+/*
+ * get_graph_degree_stats
+ *		Find the degree statistics of the edges that `root` scans for a
+ *		given vertex.
+ *
+ * The edges of a vertex are scanned by a clause like "start = <vertex ID>"
+ * (or "end" if the edges are followed backward) where the vertex ID comes
+ * from outside of the scan, e.g., a PARAM_EXEC.  We look for such a clause in
+ * the base relations of `root` and return the degree statistics of the
+ * column.  If the column has no degree statistics, the degrees are assumed
+ * to be uniform and degree->isdefault is set.  Returns false if there is no
+ * such clause.
+ */
+bool
+get_graph_degree_stats(PlannerInfo *root, GraphDegreeStats *degree)
+{
+	Index		rti;
+
+	for (rti = 1; rti < root->simple_rel_array_size; rti++)
+	{
+		RelOptInfo *rel = root->simple_rel_array[rti];
+		ListCell   *lc;
+
+		if (rel == NULL || rel->reloptkind != RELOPT_BASEREL ||
+			rel->rtekind != RTE_RELATION)
+			continue;
+
+		foreach(lc, rel->baserestrictinfo)
+		{
+			RestrictInfo *rinfo = lfirst(lc);
+			Node	   *var;
+			Node	   *other;
+			VariableStatData vardata;
+			AttStatsSlot sslot;
+			bool		isdefault;
+
+			if (!is_opclause(rinfo->clause) ||
+				list_length(((OpExpr *) rinfo->clause)->args) != 2)
+				continue;
+
+			var = get_leftop(rinfo->clause);
+			other = get_rightop(rinfo->clause);
+			if (!IsA(var, Var))
+			{
+				Node	   *tmp = var;
+
+				var = other;
+				other = tmp;
+			}
+
+			/* the vertex ID must be given from outside of the scan */
+			if (!IsA(var, Var) || ((Var *) var)->varno != rti ||
+				exprType(var) != GRAPHIDOID ||
+				IsA(other, Const) || contain_var_clause(other))
+				continue;
+
+			examine_variable(root, var, 0, &vardata);
+
+			degree->nedges = Max(graph_rel_tuples(root, rel), 1.0);
+			degree->nvertices = get_variable_numdistinct(&vardata, &isdefault);
+			degree->nvertices = Min(degree->nvertices, degree->nedges);
+			degree->isdefault = true;
+
+			if (HeapTupleIsValid(vardata.statsTuple) &&
+				get_attstatsslot(&sslot, vardata.statsTuple,
+								 STATISTIC_KIND_DEGREE, InvalidOid,
+								 ATTSTATSSLOT_NUMBERS))
+			{
+				if (sslot.nnumbers == 3)
+				{
+					degree->avg_degree = sslot.numbers[0];
+					degree->sb_degree = sslot.numbers[1];
+					degree->max_degree = sslot.numbers[2];
+					degree->isdefault = false;
+				}
+
+				free_attstatsslot(&sslot);
+			}
+
+			if (degree->isdefault)
+			{
+				degree->avg_degree = degree->nedges / degree->nvertices;
+				degree->sb_degree = degree->avg_degree;
+				degree->max_degree = degree->avg_degree;
+			}
+
+			ReleaseVariableStats(vardata);
+
+			return true;
+		}
+	}
+
+	return false;
+}
+
 
 /*-------------------------------------------------------------------------
  *
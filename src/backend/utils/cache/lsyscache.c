@@ -3256,3 +3256,31 @@ get_relid_laboid(Oid relid)
 {
 	return GetSysCacheOid1(LABELRELID, ObjectIdGetDatum(relid));
 }
+
+/*
+ * get_relid_labid
+ *		Returns the label ID for a given relation.
+ *
+ * Returns -1 if the relation is not a label.
+ */
+int32
+get_relid_labid(Oid relid)
+{
+	HeapTuple tp;
+
+	tp = SearchSysCache1(LABELRELID, ObjectIdGetDatum(relid));
+
+	if (HeapTupleIsValid(tp))
+	{
+		Form_ag_label labtup = (Form_ag_label) GETSTRUCT(tp);
+		int32 labid;
+
+		labid = labtup->labid;
+		ReleaseSysCache(tp);
+		return labid;
+	}
+	else
+	{
+		return -1;
+	}
+}
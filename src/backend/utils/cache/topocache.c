@@ -0,0 +1,509 @@
+/*
+ * topocache.c
+ *	  Shared-memory cache of the topology of edge labels
+ *
+ * The cache keeps the (start, end, id) triples of the edges of edge label
+ * tables in a DSA area created in the main shared memory segment, so that
+ * sessions can walk the topology of a label without scanning its table.  The
+ * triples of a table are sorted by start vertex, which gives the out-edges of
+ * each vertex as a contiguous run.  The size of the area is fixed by
+ * graph_topology_cache_size and the cache is disabled if it is zero.
+ *
+ * Consistency with MVCC is kept as follows.
+ *
+ * - A table is loaded while holding ShareLock on it, so there is no
+ *	 in-progress writer of the table and the snapshot taken after the lock is
+ *	 acquired sees all the edges that will ever be visible to later snapshots,
+ *	 until the table is written again.  A transaction that has written data
+ *	 cannot load a table because it could see its own uncommitted edges.
+ *
+ * - Every writer of a table discards the entry of the table right after it
+ *	 acquires its lock on the table and before it writes anything (see
+ *	 InitResultRelInfo()), so an entry which is still valid reflects the
+ *	 latest committed state of its table.
+ *
+ * - A snapshot can use an entry only if all the transactions visible to the
+ *	 snapshot the entry was built with are visible to it too, that is, if the
+ *	 xmax of the building snapshot precedes or equals the xmin of it.
+ *
+ * Readers pin the entry they read so that it can be discarded concurrently;
+ * the memory of a discarded entry is freed by the last reader.  During
+ * recovery, tables are written by WAL replay, so the cache is not used.
+ *
+ * Copyright (c) 2017 by Bitnine Global, Inc.
+ *
+ * IDENTIFICATION
+ *	  src/backend/utils/cache/topocache.c
+ */
+
+#include "postgres.h"
+
+#include "ag_const.h"
+#include "access/heapam.h"
+#include "access/htup_details.h"
+#include "access/transam.h"
+#include "access/xact.h"
+#include "access/xlog.h"
+#include "miscadmin.h"
+#include "storage/ipc.h"
+#include "storage/lmgr.h"
+#include "storage/lwlock.h"
+#include "storage/shmem.h"
+#include "utils/dsa.h"
+#include "utils/lsyscache.h"
+#include "utils/memutils.h"
+#include "utils/rel.h"
+#include "utils/snapmgr.h"
+#include "utils/topocache.h"
+#include "utils/tqual.h"
+
+#define TOPOCACHE_MAX_ENTRIES	256
+#define TOPOCACHE_INIT_EDGES	1024
+
+typedef struct TopologyCacheEdge
+{
+	Graphid		start;
+	Graphid		end;
+	Graphid		id;
+} TopologyCacheEdge;
+
+/*
+ * A slot of the cache
+ *
+ * A slot is free if relid is InvalidOid.  A slot which is not valid but is
+ * pinned (refcount > 0) keeps its edges until the last reader unpins it.
+ */
+typedef struct TopologyCacheEntry
+{
+	Oid			dbid;
+	Oid			relid;
+	bool		valid;
+	int			refcount;
+	TransactionId xmax;			/* xmax of the snapshot used to load */
+	uint64		lastused;		/* for LRU eviction */
+	int64		nedges;
+	dsa_pointer edges;			/* TopologyCacheEdge array sorted by start */
+} TopologyCacheEntry;
+
+/* protected by GraphTopologyCacheLock */
+typedef struct TopologyCacheShared
+{
+	uint64		clock;
+	TopologyCacheEntry entries[TOPOCACHE_MAX_ENTRIES];
+} TopologyCacheShared;
+
+static TopologyCacheShared *TopologyCache = NULL;
+static void *TopologyCachePlace = NULL;
+
+/* this backend's attachment to the DSA area */
+static dsa_area *topocache_area = NULL;
+
+static Size topocache_area_size(void);
+static dsa_area *get_topocache_area(void);
+static TopologyCacheEntry *find_entry(Oid relid);
+static void discard_entry(TopologyCacheEntry *entry);
+static bool evict_entry(void);
+static void unpin_entry(TopologyCacheEntry *entry);
+static void unpin_entry_callback(int code, Datum arg);
+static int	edge_cmp(const void *a, const void *b);
+
+static Size
+topocache_area_size(void)
+{
+	return Max((Size) graph_topology_cache_size * 1024, dsa_minimum_size());
+}
+
+Size
+TopologyCacheShmemSize(void)
+{
+	Size		size;
+
+	if (graph_topology_cache_size == 0)
+		return 0;
+
+	size = MAXALIGN(sizeof(TopologyCacheShared));
+	size = add_size(size, topocache_area_size());
+
+	return size;
+}
+
+void
+TopologyCacheShmemInit(void)
+{
+	bool		found;
+
+	if (graph_topology_cache_size == 0)
+		return;
+
+	TopologyCache = ShmemInitStruct("Graph Topology Cache",
+									TopologyCacheShmemSize(), &found);
+	TopologyCachePlace = (char *) TopologyCache +
+		MAXALIGN(sizeof(TopologyCacheShared));
+
+	if (!found)
+	{
+		dsa_area   *area;
+
+		MemSet(TopologyCache, 0, sizeof(TopologyCacheShared));
+
+		/*
+		 * The area is never released because the reference count it is
+		 * created with is never dropped.  Backends attach to it by
+		 * themselves.
+		 */
+		area = dsa_create_in_place(TopologyCachePlace, topocache_area_size(),
+								   LWTRANCHE_GRAPH_TOPOLOGY_CACHE, NULL);
+		dsa_detach(area);
+	}
+}
+
+static dsa_area *
+get_topocache_area(void)
+{
+	if (topocache_area == NULL)
+	{
+		MemoryContext oldcontext;
+
+		oldcontext = MemoryContextSwitchTo(TopMemoryContext);
+		topocache_area = dsa_attach_in_place(TopologyCachePlace, NULL);
+		MemoryContextSwitchTo(oldcontext);
+
+		/* never go beyond the space in the main shared memory segment */
+		dsa_set_size_limit(topocache_area, topocache_area_size());
+	}
+
+	return topocache_area;
+}
+
+/*
+ * TopologyCacheLoad - load the edges of an edge label table into the cache
+ *
+ * Any entry of the table is replaced and other entries are evicted in LRU
+ * order if there is not enough space.  Returns the number of edges loaded.
+ */
+int64
+TopologyCacheLoad(Oid relid)
+{
+	Relation	rel;
+	AttrNumber	id_attno;
+	AttrNumber	start_attno;
+	AttrNumber	end_attno;
+	Snapshot	snapshot;
+	HeapScanDesc scan;
+	HeapTuple	tuple;
+	TopologyCacheEdge *edges;
+	int64		nedges = 0;
+	int64		maxedges = TOPOCACHE_INIT_EDGES;
+	Size		size;
+	dsa_area   *area;
+	dsa_pointer dp = InvalidDsaPointer;
+	TopologyCacheEntry *entry;
+	int			i;
+
+	if (TopologyCache == NULL)
+		ereport(ERROR,
+				(errcode(ERRCODE_OBJECT_NOT_IN_PREREQUISITE_STATE),
+				 errmsg("graph topology cache is disabled"),
+				 errhint("Set graph_topology_cache_size to a positive value and restart the server.")));
+	if (RecoveryInProgress())
+		ereport(ERROR,
+				(errcode(ERRCODE_OBJECT_NOT_IN_PREREQUISITE_STATE),
+				 errmsg("graph topology cache cannot be loaded during recovery")));
+	if (TransactionIdIsValid(GetTopTransactionIdIfAny()))
+		ereport(ERROR,
+				(errcode(ERRCODE_ACTIVE_SQL_TRANSACTION),
+				 errmsg("graph topology cache cannot be loaded in a transaction that has modified data")));
+
+	/* wait for the writers of the table and block new ones */
+	rel = heap_open(relid, ShareLock);
+	id_attno = get_attnum(relid, AG_ELEM_LOCAL_ID);
+	start_attno = get_attnum(relid, AG_START_ID);
+	end_attno = get_attnum(relid, AG_END_ID);
+
+	snapshot = RegisterSnapshot(GetLatestSnapshot());
+
+	edges = palloc_extended(sizeof(*edges) * maxedges, MCXT_ALLOC_HUGE);
+	scan = heap_beginscan(rel, snapshot, 0, NULL);
+	while ((tuple = heap_getnext(scan, ForwardScanDirection)) != NULL)
+	{
+		Datum		id;
+		Datum		start;
+		Datum		end;
+		bool		isnull;
+
+		CHECK_FOR_INTERRUPTS();
+
+		id = heap_getattr(tuple, id_attno, RelationGetDescr(rel), &isnull);
+		if (isnull)
+			continue;
+		start = heap_getattr(tuple, start_attno, RelationGetDescr(rel),
+							 &isnull);
+		if (isnull)
+			continue;
+		end = heap_getattr(tuple, end_attno, RelationGetDescr(rel), &isnull);
+		if (isnull)
+			continue;
+
+		if (nedges >= maxedges)
+		{
+			maxedges *= 2;
+			edges = repalloc_huge(edges, sizeof(*edges) * maxedges);
+		}
+
+		edges[nedges].start = DatumGetGraphid(start);
+		edges[nedges].end = DatumGetGraphid(end);
+		edges[nedges].id = DatumGetGraphid(id);
+		nedges++;
+	}
+	heap_endscan(scan);
+
+	qsort(edges, nedges, sizeof(*edges), edge_cmp);
+
+	area = get_topocache_area();
+	size = sizeof(*edges) * nedges;
+	while (size > 0)
+	{
+		dp = dsa_allocate_extended(area, size,
+								   DSA_ALLOC_HUGE | DSA_ALLOC_NO_OOM);
+		if (DsaPointerIsValid(dp))
+		{
+			memcpy(dsa_get_address(area, dp), edges, size);
+			break;
+		}
+
+		LWLockAcquire(GraphTopologyCacheLock, LW_EXCLUSIVE);
+		if (!evict_entry())
+		{
+			LWLockRelease(GraphTopologyCacheLock);
+			ereport(ERROR,
+					(errcode(ERRCODE_OUT_OF_MEMORY),
+					 errmsg("edge label \"%s\" does not fit in graph_topology_cache_size",
+							RelationGetRelationName(rel))));
+		}
+		LWLockRelease(GraphTopologyCacheLock);
+	}
+
+	LWLockAcquire(GraphTopologyCacheLock, LW_EXCLUSIVE);
+
+	entry = find_entry(relid);
+	if (entry != NULL)
+		discard_entry(entry);
+
+	for (;;)
+	{
+		entry = NULL;
+		for (i = 0; i < TOPOCACHE_MAX_ENTRIES; i++)
+		{
+			if (!OidIsValid(TopologyCache->entries[i].relid))
+			{
+				entry = &TopologyCache->entries[i];
+				break;
+			}
+		}
+		if (entry != NULL)
+			break;
+
+		if (!evict_entry())
+		{
+			if (DsaPointerIsValid(dp))
+				dsa_free(area, dp);
+			LWLockRelease(GraphTopologyCacheLock);
+			ereport(ERROR,
+					(errcode(ERRCODE_PROGRAM_LIMIT_EXCEEDED),
+					 errmsg("too many edge labels are in use in graph topology cache")));
+		}
+	}
+
+	entry->dbid = MyDatabaseId;
+	entry->relid = relid;
+	entry->valid = true;
+	entry->refcount = 0;
+	entry->xmax = snapshot->xmax;
+	entry->lastused = ++TopologyCache->clock;
+	entry->nedges = nedges;
+	entry->edges = dp;
+
+	LWLockRelease(GraphTopologyCacheLock);
+
+	pfree(edges);
+	UnregisterSnapshot(snapshot);
+	heap_close(rel, NoLock);
+
+	return nedges;
+}
+
+/*
+ * TopologyCacheInvalidate - discard the entry of a table
+ *
+ * This must be called by the writers of a table after they acquire their
+ * lock on the table and before they write anything.
+ */
+void
+TopologyCacheInvalidate(Oid relid)
+{
+	TopologyCacheEntry *entry;
+
+	if (TopologyCache == NULL)
+		return;
+
+	LWLockAcquire(GraphTopologyCacheLock, LW_SHARED);
+	entry = find_entry(relid);
+	LWLockRelease(GraphTopologyCacheLock);
+
+	if (entry == NULL)
+		return;
+
+	LWLockAcquire(GraphTopologyCacheLock, LW_EXCLUSIVE);
+	entry = find_entry(relid);
+	if (entry != NULL)
+		discard_entry(entry);
+	LWLockRelease(GraphTopologyCacheLock);
+}
+
+/*
+ * TopologyCacheScanEdges - call the callback for each cached edge of a table
+ *
+ * Returns false without calling the callback if the table is not in the
+ * cache or its entry cannot be used with the given snapshot.
+ */
+bool
+TopologyCacheScanEdges(Oid relid, Snapshot snapshot,
+					   TopologyCacheEdgeCallback callback, void *arg)
+{
+	TopologyCacheEntry *entry;
+	TopologyCacheEdge *edges;
+	int64		nedges;
+	int64		i;
+
+	if (TopologyCache == NULL || !IsMVCCSnapshot(snapshot) ||
+		RecoveryInProgress())
+		return false;
+
+	LWLockAcquire(GraphTopologyCacheLock, LW_EXCLUSIVE);
+
+	entry = find_entry(relid);
+	if (entry == NULL ||
+		!TransactionIdPrecedesOrEquals(entry->xmax, snapshot->xmin))
+	{
+		LWLockRelease(GraphTopologyCacheLock);
+		return false;
+	}
+
+	entry->refcount++;
+	entry->lastused = ++TopologyCache->clock;
+	nedges = entry->nedges;
+	edges = (nedges > 0 ?
+			 dsa_get_address(get_topocache_area(), entry->edges) : NULL);
+
+	LWLockRelease(GraphTopologyCacheLock);
+
+	PG_ENSURE_ERROR_CLEANUP(unpin_entry_callback, PointerGetDatum(entry));
+	{
+		for (i = 0; i < nedges; i++)
+		{
+			CHECK_FOR_INTERRUPTS();
+
+			callback(edges[i].id, edges[i].start, edges[i].end, arg);
+		}
+	}
+	PG_END_ENSURE_ERROR_CLEANUP(unpin_entry_callback, PointerGetDatum(entry));
+
+	unpin_entry(entry);
+
+	return true;
+}
+
+/* find the valid entry of a table in the current database */
+static TopologyCacheEntry *
+find_entry(Oid relid)
+{
+	int			i;
+
+	for (i = 0; i < TOPOCACHE_MAX_ENTRIES; i++)
+	{
+		TopologyCacheEntry *entry = &TopologyCache->entries[i];
+
+		if (entry->valid && entry->relid == relid &&
+			entry->dbid == MyDatabaseId)
+			return entry;
+	}
+
+	return NULL;
+}
+
+/* the caller must hold GraphTopologyCacheLock exclusively */
+static void
+discard_entry(TopologyCacheEntry *entry)
+{
+	entry->valid = false;
+	if (entry->refcount > 0)
+		return;
+
+	if (DsaPointerIsValid(entry->edges))
+		dsa_free(get_topocache_area(), entry->edges);
+	MemSet(entry, 0, sizeof(*entry));
+}
+
+/*
+ * Discard the least recently used entry which is not pinned.  Returns false
+ * if there is no such entry.  The caller must hold GraphTopologyCacheLock
+ * exclusively.
+ */
+static bool
+evict_entry(void)
+{
+	TopologyCacheEntry *victim = NULL;
+	int			i;
+
+	for (i = 0; i < TOPOCACHE_MAX_ENTRIES; i++)
+	{
+		TopologyCacheEntry *entry = &TopologyCache->entries[i];
+
+		if (!entry->valid || entry->refcount > 0)
+			continue;
+
+		if (victim == NULL || entry->lastused < victim->lastused)
+			victim = entry;
+	}
+
+	if (victim == NULL)
+		return false;
+
+	discard_entry(victim);
+
+	return true;
+}
+
+static void
+unpin_entry(TopologyCacheEntry *entry)
+{
+	LWLockAcquire(GraphTopologyCacheLock, LW_EXCLUSIVE);
+
+	Assert(entry->refcount > 0);
+	entry->refcount--;
+	if (!entry->valid)
+		discard_entry(entry);
+
+	LWLockRelease(GraphTopologyCacheLock);
+}
+
+static void
+unpin_entry_callback(int code, Datum arg)
+{
+	unpin_entry((TopologyCacheEntry *) DatumGetPointer(arg));
+}
+
+static int
+edge_cmp(const void *a, const void *b)
+{
+	const TopologyCacheEdge *ea = (const TopologyCacheEdge *) a;
+	const TopologyCacheEdge *eb = (const TopologyCacheEdge *) b;
+
+	if (ea->start != eb->start)
+		return (ea->start < eb->start ? -1 : 1);
+	if (ea->end != eb->end)
+		return (ea->end < eb->end ? -1 : 1);
+	if (ea->id != eb->id)
+		return (ea->id < eb->id ? -1 : 1);
+	return 0;
+}
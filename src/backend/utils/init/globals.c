@@ -114,6 +114,7 @@ int			work_mem = 1024;
 int			maintenance_work_mem = 16384;
 int			replacement_sort_tuples = 150000;
 int			eager_mem = 4096;
+int			graph_algorithm_work_mem = 65536;
 /*
  * Primary determinants of sizes of shared-memory structures.
  *
@@ -125,6 +126,7 @@ int			MaxConnections = 90;
 int			max_worker_processes = 8;
 int			max_parallel_workers = 8;
 int			MaxBackends = 0;
+int			graph_topology_cache_size = 0;
 
 int			VacuumCostPageHit = 1;	/* GUC parameters for vacuum */
 int			VacuumCostPageMiss = 10;
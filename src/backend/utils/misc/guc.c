@@ -42,6 +42,7 @@
 #include "commands/vacuum.h"
 #include "commands/variable.h"
 #include "commands/trigger.h"
+#include "executor/nodeDijkstra.h"
 #include "executor/nodeModifyGraph.h"
 #include "funcapi.h"
 #include "libpq/auth.h"
@@ -56,7 +57,9 @@
 #include "parser/parse_cypher_expr.h"
 #include "parser/parse_expr.h"
 #include "parser/parse_graph.h"
+#include "parser/parse_shortestpath.h"
 #include "parser/parse_type.h"
+#include "parser/parse_utilcmd.h"
 #include "parser/parser.h"
 #include "parser/scansup.h"
 #include "pgstat.h"
@@ -923,6 +926,24 @@ static struct config_bool ConfigureNamesBool[] =
 		true,
 		NULL, NULL, NULL
 	},
+	{
+		{"enable_shortestpath", PGC_USERSET, QUERY_TUNING_METHOD,
+			gettext_noop("Enables bidirectional search plans for shortestpath()."),
+			NULL
+		},
+		&enable_shortestpath,
+		true,
+		NULL, NULL, NULL
+	},
+	{
+		{"enable_dijkstra_cache", PGC_USERSET, QUERY_TUNING_METHOD,
+			gettext_noop("Enables caching the edges of the vertices expanded by dijkstra()."),
+			NULL
+		},
+		&enable_dijkstra_cache,
+		true,
+		NULL, NULL, NULL
+	},
 	{
 		{"enable_multiple_update", PGC_USERSET, QUERY_TUNING_METHOD,
 			gettext_noop("Enables multiple update on the same graph element."),
@@ -2020,6 +2041,29 @@ static struct config_int ConfigureNamesInt[] =
 		NULL, NULL, NULL
 	},
 
+	{
+		{"graph_algorithm_work_mem", PGC_USERSET, RESOURCES_MEM,
+			gettext_noop("Sets the maximum memory to be used for graph algorithms."),
+			gettext_noop("This much memory can be used by the in-memory snapshot "
+						 "of a graph built by each graph algorithm function."),
+			GUC_UNIT_KB
+		},
+		&graph_algorithm_work_mem,
+		65536, 1024, MAX_KILOBYTES,
+		NULL, NULL, NULL
+	},
+
+	{
+		{"graph_topology_cache_size", PGC_POSTMASTER, RESOURCES_MEM,
+			gettext_noop("Sets the size of the shared memory cache of the topology of edge labels."),
+			gettext_noop("0 disables the cache."),
+			GUC_UNIT_KB
+		},
+		&graph_topology_cache_size,
+		0, 0, MAX_KILOBYTES,
+		NULL, NULL, NULL
+	},
+
 	{
 		{"temp_file_limit", PGC_SUSET, RESOURCES_DISK,
 			gettext_noop("Limits the total size of all temporary files used by each process."),
@@ -2182,6 +2226,16 @@ static struct config_int ConfigureNamesInt[] =
 		NULL, NULL, NULL
 	},
 
+	{
+		{"label_id_cache", PGC_USERSET, CLIENT_CONN_STATEMENT,
+			gettext_noop("Sets the number of IDs of a new label a session allocates at a time."),
+			gettext_noop("This is the CACHE of the ID sequence of labels created afterwards.")
+		},
+		&label_id_cache,
+		1, 1, INT_MAX,
+		NULL, NULL, NULL
+	},
+
 	{
 		{"vacuum_freeze_min_age", PGC_USERSET, CLIENT_CONN_STATEMENT,
 			gettext_noop("Minimum age at which VACUUM should freeze a table row."),
@@ -18,5 +18,6 @@
 #define AG_START_ID			"start"
 #define AG_END_ID			"end"
 #define AG_ELEM_PROP_MAP	"properties"
+#define AG_PROP_COLUMNS		"property_columns"
 
 #endif	/* AG_CONST_H */
@@ -5486,6 +5486,8 @@ DATA(insert OID = 7005 ( graphid_recv	PGNSP PGUID 12 1 0 0 0 f f f f t f i s 1 0
 DESCR("I/O");
 DATA(insert OID = 7006 ( graphid_send	PGNSP PGUID 12 1 0 0 0 f f f f t f i s 1 0 17 "7002" _null_ _null_ _null_ _null_ _null_ graphid_send _null_ _null_ _null_ ));
 DESCR("I/O");
+DATA(insert OID = 7169 ( graphid_typanalyze	PGNSP PGUID 12 1 0 0 0 f f f f t f s s 1 0 16 "2281" _null_ _null_ _null_ _null_ _null_ graphid_typanalyze _null_ _null_ _null_ ));
+DESCR("graphid typanalyze");
 DATA(insert OID = 7007 ( graphid_labid	PGNSP PGUID 12 1 0 0 0 f f f f t f i s 1 0 23 "7002" _null_ _null_ _null_ _null_ _null_ graphid_labid _null_ _null_ _null_ ));
 DESCR("get label ID of graphid");
 DATA(insert OID = 7008 ( graphid_locid	PGNSP PGUID 12 1 0 0 0 f f f f t f i s 1 0 20 "7002" _null_ _null_ _null_ _null_ _null_ graphid_locid _null_ _null_ _null_ ));
@@ -5496,6 +5498,10 @@ DATA(insert OID = 7014 ( vertex_out		PGNSP PGUID 12 1 0 0 0 f f f f t f i s 1 0
 DESCR("I/O");
 DATA(insert OID = 7016 ( _vertex_out	PGNSP PGUID 12 1 0 0 0 f f f f t f i s 1 0 2275 "7011" _null_ _null_ _null_ _null_ _null_ _vertex_out _null_ _null_ _null_ ));
 DESCR("I/O");
+DATA(insert OID = 7246 ( vertex_recv	PGNSP PGUID 12 1 0 0 0 f f f f t f i s 3 0 7012 "2281 26 23" _null_ _null_ _null_ _null_ _null_ vertex_recv _null_ _null_ _null_ ));
+DESCR("I/O");
+DATA(insert OID = 7247 ( vertex_send	PGNSP PGUID 12 1 0 0 0 f f f f t f i s 1 0 17 "7012" _null_ _null_ _null_ _null_ _null_ vertex_send _null_ _null_ _null_ ));
+DESCR("I/O");
 DATA(insert OID = 7017 ( label			PGNSP PGUID 12 1 0 0 0 f f f f t f i s 1 0 3802 "7012" _null_ _null_ _null_ _null_ _null_ vertex_label _null_ _null_ _null_ ));
 DESCR("get vertex's label");
 DATA(insert OID = 7018 ( length			PGNSP PGUID 12 1 0 0 0 f f f f t f i s 1 0 3802 "7011" _null_ _null_ _null_ _null_ _null_ _vertex_length _null_ _null_ _null_ ));
@@ -5506,6 +5512,10 @@ DATA(insert OID = 7024 ( edge_out		PGNSP PGUID 12 1 0 0 0 f f f f t f i s 1 0 22
 DESCR("I/O");
 DATA(insert OID = 7026 ( _edge_out		PGNSP PGUID 12 1 0 0 0 f f f f t f i s 1 0 2275 "7021" _null_ _null_ _null_ _null_ _null_ _edge_out _null_ _null_ _null_ ));
 DESCR("I/O");
+DATA(insert OID = 7248 ( edge_recv		PGNSP PGUID 12 1 0 0 0 f f f f t f i s 3 0 7022 "2281 26 23" _null_ _null_ _null_ _null_ _null_ edge_recv _null_ _null_ _null_ ));
+DESCR("I/O");
+DATA(insert OID = 7249 ( edge_send		PGNSP PGUID 12 1 0 0 0 f f f f t f i s 1 0 17 "7022" _null_ _null_ _null_ _null_ _null_ edge_send _null_ _null_ _null_ ));
+DESCR("I/O");
 DATA(insert OID = 7027 ( label			PGNSP PGUID 12 1 0 0 0 f f f f t f i s 1 0 3802 "7022" _null_ _null_ _null_ _null_ _null_ edge_label _null_ _null_ _null_ ));
 DESCR("get edge's label");
 DATA(insert OID = 7028 ( length			PGNSP PGUID 12 1 0 0 0 f f f f t f i s 1 0 3802 "7021" _null_ _null_ _null_ _null_ _null_ _edge_length _null_ _null_ _null_ ));
@@ -5514,6 +5524,10 @@ DATA(insert OID = 7029 ( to_jsonb		PGNSP PGUID 12 1 0 0 0 f f f f t f i s 1 0 38
 DESCR("convert edge to jsonb");
 DATA(insert OID = 7034 ( graphpath_out	PGNSP PGUID 12 1 0 0 0 f f f f t f i s 1 0 2275 "7032" _null_ _null_ _null_ _null_ _null_ graphpath_out _null_ _null_ _null_ ));
 DESCR("I/O");
+DATA(insert OID = 7250 ( graphpath_recv	PGNSP PGUID 12 1 0 0 0 f f f f t f i s 3 0 7032 "2281 26 23" _null_ _null_ _null_ _null_ _null_ graphpath_recv _null_ _null_ _null_ ));
+DESCR("I/O");
+DATA(insert OID = 7251 ( graphpath_send	PGNSP PGUID 12 1 0 0 0 f f f f t f i s 1 0 17 "7032" _null_ _null_ _null_ _null_ _null_ graphpath_send _null_ _null_ _null_ ));
+DESCR("I/O");
 DATA(insert OID = 7036 ( length			PGNSP PGUID 12 1 0 0 0 f f f f t f i s 1 0 3802 "7031" _null_ _null_ _null_ _null_ _null_ _graphpath_length _null_ _null_ _null_ ));
 DESCR("get the length of graphpath array");
 DATA(insert OID = 7037 ( length			PGNSP PGUID 12 1 0 0 0 f f f f t f i s 1 0 3802 "7032" _null_ _null_ _null_ _null_ _null_ graphpath_length _null_ _null_ _null_ ));
@@ -5603,6 +5617,26 @@ DATA(insert OID = 7170 ( dijkstra_vids	PGNSP PGUID 12 1 0 0 0 f f f f t f s s 0
 DESCR("placeholder");
 DATA(insert OID = 7171 ( dijkstra_eids	PGNSP PGUID 12 1 0 0 0 f f f f t f s s 0 0 7001 "" _null_ _null_ _null_ _null_ _null_ dijkstra_eids _null_ _null_ _null_ ));
 DESCR("placeholder");
+/* Shortestpath */
+DATA(insert OID = 7172 ( shortestpath_vids	PGNSP PGUID 12 1 0 0 0 f f f f t f s s 0 0 7001 "" _null_ _null_ _null_ _null_ _null_ shortestpath_vids _null_ _null_ _null_ ));
+DESCR("placeholder");
+DATA(insert OID = 7173 ( shortestpath_eids	PGNSP PGUID 12 1 0 0 0 f f f f t f s s 0 0 7001 "" _null_ _null_ _null_ _null_ _null_ shortestpath_eids _null_ _null_ _null_ ));
+DESCR("placeholder");
+/* graph algorithms */
+DATA(insert OID = 7252 ( pagerank		PGNSP PGUID 12 1 1000 0 0 f f f f t t s r 4 0 2249 "25 25 701 23" "{25,25,701,23,7002,701}" "{i,i,i,i,o,o}" "{vlabel,elabel,damping,iterations,id,rank}" _null_ _null_ graph_pagerank _null_ _null_ _null_ ));
+DESCR("PageRank of vertices");
+DATA(insert OID = 7253 ( weakly_connected_components	PGNSP PGUID 12 1 1000 0 0 f f f f t t s r 2 0 2249 "25 25" "{25,25,7002,7002}" "{i,i,o,o}" "{vlabel,elabel,id,component}" _null_ _null_ graph_wcc _null_ _null_ _null_ ));
+DESCR("weakly connected components of vertices");
+DATA(insert OID = 7254 ( triangle_count	PGNSP PGUID 12 1 1000 0 0 f f f f t t s r 2 0 2249 "25 25" "{25,25,7002,20}" "{i,i,o,o}" "{vlabel,elabel,id,triangles}" _null_ _null_ graph_triangle_count _null_ _null_ _null_ ));
+DESCR("number of triangles of vertices");
+DATA(insert OID = 7255 ( degree_centrality	PGNSP PGUID 12 1 1000 0 0 f f f f t t s r 2 0 2249 "25 25" "{25,25,7002,20,20,701}" "{i,i,o,o,o,o}" "{vlabel,elabel,id,indegree,outdegree,centrality}" _null_ _null_ graph_degree_centrality _null_ _null_ _null_ ));
+DESCR("degree centrality of vertices");
+DATA(insert OID = 7256 ( topology_cache_load	PGNSP PGUID 12 1 0 0 0 f f f f t f v u 1 0 20 "25" _null_ _null_ _null_ _null_ _null_ graph_topology_cache_load _null_ _null_ _null_ ));
+DESCR("load edges of an edge label into the graph topology cache");
+DATA(insert OID = 7257 ( load_vertices	PGNSP PGUID 12 1 0 0 0 f f f f t f v u 2 0 20 "25 2205" _null_ _null_ "{vlabel,source}" _null_ _null_ graph_load_vertices _null_ _null_ _null_ ));
+DESCR("bulk load vertices from a relation");
+DATA(insert OID = 7258 ( load_edges		PGNSP PGUID 12 1 0 0 0 f f f f t f v u 4 0 20 "25 2205 25 25" _null_ _null_ "{elabel,source,vlabel,key}" _null_ _null_ graph_load_edges _null_ _null_ _null_ ));
+DESCR("bulk load edges from a relation");
 /* Cypher expressions - operators for jsonb */
 DATA(insert OID = 7175 ( jsonb_add		PGNSP PGUID 12 1 0 0 0 f f f f t f i s 2 0 3802 "3802 3802" _null_ _null_ _null_ _null_ _null_ jsonb_add _null_ _null_ _null_ ));
 DATA(insert OID = 7177 ( jsonb_sub		PGNSP PGUID 12 1 0 0 0 f f f f t f i s 2 0 3802 "3802 3802" _null_ _null_ _null_ _null_ _null_ jsonb_sub _null_ _null_ _null_ ));
@@ -189,6 +189,11 @@ typedef FormData_pg_statistic *Form_pg_statistic;
  * 10000-30000.  However, for code that is to be widely disseminated it is
  * better to obtain a publicly defined "kind" code by request from the
  * PostgreSQL Global Development Group.
+ *
+ * AgensGraph takes the codes 10000-10099 of the private range for the
+ * statistics of graph data, so that they never collide with the codes
+ * upstream PostgreSQL assigns later.  They are documented at the end of this
+ * file.
  */
 
 /*
@@ -291,4 +296,22 @@ typedef FormData_pg_statistic *Form_pg_statistic;
  */
 #define STATISTIC_KIND_BOUNDS_HISTOGRAM  7
 
+/*
+ * The following kinds are specific to AgensGraph.
+ */
+
+/*
+ * A "degree" slot describes how many times each distinct value appears in a
+ * graphid column.  For the start or end column of an edge label, this is the
+ * out-degree or in-degree of the vertices that have at least one edge of the
+ * label.  staop is not used.  stavalues is not used and should be NULL.
+ * stanumbers contains three entries: the average degree, the average degree
+ * of the vertex at the end of a randomly chosen edge (sum of squared degrees
+ * divided by the number of edges), and the maximum degree.  The second one
+ * is never less than the first one; the larger the ratio between them, the
+ * more skewed the degrees are.  The high-degree vertices themselves are in
+ * the MCV slot of the column.
+ */
+#define STATISTIC_KIND_DEGREE  10000
+
 #endif							/* PG_STATISTIC_H */
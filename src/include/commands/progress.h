@@ -34,4 +34,10 @@
 #define PROGRESS_VACUUM_PHASE_TRUNCATE			5
 #define PROGRESS_VACUUM_PHASE_FINAL_CLEANUP		6
 
+/* Progress parameters for DETACH DELETE */
+#define PROGRESS_DETACH_DELETE_TOTAL_VERTICES	0
+#define PROGRESS_DETACH_DELETE_TOTAL_LABELS		1
+#define PROGRESS_DETACH_DELETE_LABELS_SCANNED	2
+#define PROGRESS_DETACH_DELETE_EDGES_DELETED	3
+
 #endif
@@ -19,6 +19,7 @@
 /* forward reference to avoid circularity */
 struct ArrayRefState;
 struct CypherAccessPathElem;
+struct CypherAccessCache;
 
 /* declarations to avoid including headers */
 typedef struct JsonbParseState JsonbParseState;
@@ -225,6 +226,7 @@ typedef enum ExprEvalOp
 	EEOP_CYPHERLISTCOMP_ITER_INIT,
 	EEOP_CYPHERLISTCOMP_ITER_NEXT,
 	EEOP_CYPHERLISTCOMP_VAR,
+	EEOP_CYPHERACCESS_RESET,
 	EEOP_CYPHERACCESSEXPR,
 
 	/* non-existent operation, used e.g. to check array lengths */
@@ -611,12 +613,19 @@ typedef struct ExprEvalStep
 			bool	   *elemnull;
 		}			cypherlistcomp_var;
 
+		struct
+		{
+			struct CypherAccessCache *caches;
+			int			ncaches;
+		}			cypheraccess_reset;
+
 		struct
 		{
 			Datum	   *argvalue;
 			bool	   *argnull;
 			struct CypherAccessPathElem *path;
 			int			pathlen;
+			struct CypherAccessCache *cache;
 		}			cypheraccessexpr;
 	}			d;
 } ExprEvalStep;
@@ -679,6 +688,20 @@ typedef struct CypherAccessPathElem
 	CypherIndexResult uidx;
 } CypherAccessPathElem;
 
+/*
+ * Property map shared by the CypherAccessExprs of an expression having the
+ * same argument, so that it is detoasted once per evaluation of the
+ * expression instead of once per access.
+ */
+typedef struct CypherAccessCache
+{
+	Expr	   *arg;			/* argument of the CypherAccessExprs */
+	int			nuses;			/* number of the CypherAccessExprs */
+	bool		valid;			/* is value set for the current evaluation? */
+	bool		extended;		/* was the original value toasted? */
+	Datum		value;			/* detoasted value */
+} CypherAccessCache;
+
 
 extern void ExecReadyInterpretedExpr(ExprState *state);
 
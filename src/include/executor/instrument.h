@@ -69,6 +69,15 @@ typedef struct WorkerInstrumentation
 	Instrumentation instrument[FLEXIBLE_ARRAY_MEMBER];
 } WorkerInstrumentation;
 
+/* per-depth statistics of a graph traversal (VLE, shortestpath) */
+typedef struct TraversalDepthStats
+{
+	long		frontier;		/* # of paths or vertices reached */
+	long		rescans;		/* # of rescans of the subplan */
+	long		edges;			/* # of edges examined */
+	long		rejected;		/* # of edges leading to visited elements */
+} TraversalDepthStats;
+
 extern PGDLLIMPORT BufferUsage pgBufferUsage;
 
 extern Instrumentation *InstrAlloc(int n, int instrument_options);
@@ -80,5 +89,7 @@ extern void InstrAggNode(Instrumentation *dst, Instrumentation *add);
 extern void InstrStartParallelQuery(void);
 extern void InstrEndParallelQuery(BufferUsage *result);
 extern void InstrAccumParallelQuery(BufferUsage *result);
+extern TraversalDepthStats *InstrDepthStats(TraversalDepthStats **stats,
+				int *nstats, int depth, MemoryContext mcxt);
 
 #endif							/* INSTRUMENT_H */
@@ -11,6 +11,8 @@
 
 #include "nodes/execnodes.h"
 
+extern bool enable_dijkstra_cache;
+
 extern DijkstraState *ExecInitDijkstra(Dijkstra *node, EState *estate,
 									   int eflags);
 extern void ExecEndDijkstra(DijkstraState *node);
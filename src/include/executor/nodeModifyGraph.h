@@ -26,5 +26,8 @@ extern bool enable_multiple_update;
 extern ModifyGraphState *ExecInitModifyGraph(ModifyGraph *mgplan,
 											 EState *estate, int eflags);
 extern void ExecEndModifyGraph(ModifyGraphState *mgstate);
+extern void setSlotPropColumns(TupleTableSlot *slot, int propattnum);
+extern CypherMapExpr *getMergeKeyMap(GraphWriteOp operation, bool last,
+									 bool eager, List *pattern, List *sets);
 
 #endif
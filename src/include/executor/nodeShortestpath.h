@@ -0,0 +1,19 @@
+/*
+ * nodeShortestpath.h
+ *
+ * Copyright (c) 2017 by Bitnine Global, Inc.
+ *
+ * src/include/executor/nodeShortestpath.h
+ */
+
+#ifndef NODESHORTESTPATH_H
+#define NODESHORTESTPATH_H
+
+#include "nodes/execnodes.h"
+
+extern ShortestpathState *ExecInitShortestpath(Shortestpath *node,
+											   EState *estate, int eflags);
+extern void ExecEndShortestpath(ShortestpathState *node);
+extern void ExecReScanShortestpath(ShortestpathState *node);
+
+#endif
@@ -159,6 +159,7 @@ extern PGDLLIMPORT int MaxBackends;
 extern PGDLLIMPORT int MaxConnections;
 extern PGDLLIMPORT int max_worker_processes;
 extern PGDLLIMPORT int max_parallel_workers;
+extern PGDLLIMPORT int graph_topology_cache_size;
 
 extern PGDLLIMPORT int MyProcPid;
 extern PGDLLIMPORT pg_time_t MyStartTime;
@@ -243,6 +244,7 @@ extern PGDLLIMPORT int work_mem;
 extern PGDLLIMPORT int maintenance_work_mem;
 extern PGDLLIMPORT int replacement_sort_tuples;
 extern PGDLLIMPORT int eager_mem;
+extern PGDLLIMPORT int graph_algorithm_work_mem;
 
 extern int	VacuumCostPageHit;
 extern int	VacuumCostPageMiss;
@@ -85,6 +85,12 @@ typedef struct ExprState
 	/* original expression tree, for debugging only */
 	Expr	   *expr;
 
+	/*
+	 * Number of detoasts of property maps avoided by sharing them among
+	 * property accesses, for EXPLAIN ANALYZE.
+	 */
+	uint64		cypheraccess_nsaved;
+
 	/*
 	 * XXX: following only needed during "compilation", could be thrown away.
 	 */
@@ -100,6 +106,9 @@ typedef struct ExprState
 
 	Datum	   *innermost_cypherlistcomp_iterval;
 	bool	   *innermost_cypherlistcomp_iternull;
+
+	/* shared property maps of property accesses, see CypherAccessCache */
+	List	   *cypheraccess_caches;
 } ExprState;
 
 
@@ -1021,6 +1030,10 @@ typedef struct AppendState
 	PlanState **appendplans;	/* array of PlanStates for my inputs */
 	int			as_nplans;
 	int			as_whichplan;
+	ExprState  *as_labid_expr;	/* graphid probing the labels, or NULL */
+	int32	   *as_labids;		/* label ID of each subplan */
+	int32		as_labid;		/* label ID of the probing graphid */
+	bool		as_labid_ready;	/* as_labid is valid for the current scan */
 	dlist_head  vle_ctxs;		/* list of AppendVLECtx */
 	dlist_node *cur_ctx;
 } AppendState;
@@ -1029,6 +1042,8 @@ typedef struct AppendVLECtx
 {
 	dlist_node	list;
 	int			as_whichplan;
+	int32		as_labid;
+	bool		as_labid_ready;
 } AppendVLECtx;
 
 /* ----------------
@@ -1672,6 +1687,7 @@ typedef struct VLEArrayExpr
 	int			nelems;
 	int			telems;
 	Datum	   *elements;
+	struct vleids_hash *elemset;	/* graphid elements beyond the first few */
 	ExprContext *econtext;
 } VLEArrayExpr;
 
@@ -1686,6 +1702,11 @@ typedef struct NestLoopVLEState
 	VLEArrayExpr edges;
 	dlist_head	vleCtxs;		/* list of NestLoopVLECtx */
 	dlist_node *curCtx;
+	List	   *edgeRels;		/* labels that property maps are fetched from */
+	/* for EXPLAIN ANALYZE */
+	TraversalDepthStats *depthStats;	/* indexed by the number of hops */
+	int			ndepthStats;
+	int			maxPathLen;		/* peak number of elements in `ids` */
 } NestLoopVLEState;
 
 typedef struct NestLoopVLECtx
@@ -2182,14 +2203,37 @@ typedef struct ModifyGraphState
 	List	   *exprs;			/* expression state list for DELETE */
 	List	   *sets;			/* list of GraphSetProp's for SET/REMOVE */
 	HTAB	   *elemTable;
+	Size		elemTableSpace;	/* memory used by the entries of elemTable */
+	int			nElemBatches;	/* elemTable is batch 0 of these batches */
+	struct BufFile **elemBatchFiles;	/* spilled batches of elemTable */
+	uint64		elemBatchSeqno;	/* next seqno of spilled elements */
+	HTAB	   *elemSpillIndex;	/* positions of the newest spilled records */
+	HTAB	   *elemFinalIndex;	/* positions of elements in elemFinalFile */
+	struct BufFile *elemFinalFile;	/* final elements of spilled batches */
 	Tuplestorestate *tuplestorestate;
+	/* multi-insert buffers of CREATE, used only if nothing is returned */
+	MemoryContext bufferedCxt;
+	HeapTuple **bufferedTuples;	/* per result relation */
+	int		   *nBufferedTuples;	/* per result relation */
+	int			nTotalBufferedTuples;
+	Size		bufferedTuplesSize;
+	struct BulkInsertStateData **bistates;	/* per result relation */
+	/* MERGE of a single vertex whose creations are buffered */
+	ExprState  *mergeIdExpr;
+	ExprState  *mergeMapExpr;	/* property map before NULLs are stripped */
+	int			mergeNumKeys;	/* number of keys in the property map */
+	MemoryContext mergeKeyCxt;
+	HTAB	   *mergeKeyTable;	/* property maps of the created vertices */
 } ModifyGraphState;
 
 typedef struct DijkstraState
 {
 	PlanState 		ps;
+	MemoryContext	visited_mcxt;	/* visited nodes and incoming edges */
 	HTAB		   *visited_nodes;
 	pairingheap	   *pq;
+	bool			search_kept;	/* the search can be resumed */
+	Graphid			search_source;	/* source of the kept search */
 	MemoryContext 	pq_mcxt;
 	ExprState  	   *source;
 	ExprState  	   *target;
@@ -2199,6 +2243,64 @@ typedef struct DijkstraState
 	Graphid 		target_id;
 	bool			is_executed;
 	TupleTableSlot *selfTupleSlot;
+	/* adjacency cache, edges of a vertex are stored contiguously */
+	MemoryContext	adj_mcxt;
+	HTAB		   *adj_cache;		/* vertex ID -> range of the arrays */
+	Graphid		   *adj_to;
+	Graphid		   *adj_eid;
+	double		   *adj_weight;
+	double		   *adj_heuristic;	/* NULL if there is no heuristic */
+	int				adj_nedges;
+	int				adj_maxedges;
+	Size			adj_space;		/* memory used by the cache */
+	bool			adj_full;		/* the cache doesn't fit in work_mem */
+	bool			adj_complete;	/* all the edges have been cached */
+	bool			topology_tried;	/* tried to load the topology cache */
+	long			adj_hits;
+	long			adj_misses;
+	long			topology_edges;	/* edges from the topology cache */
+	/* k shortest loopless paths (Yen's algorithm) */
+	MemoryContext	yen_mcxt;
+	List		   *yen_paths;		/* paths returned so far */
+	pairingheap	   *yen_candidates;	/* candidates ordered by weight */
+	List		   *yen_seen;		/* all paths generated so far */
+	HTAB		   *banned_vertices;	/* NULL if no search is restricted */
+	HTAB		   *banned_edges;
+	long			spur_searches;
+	/* for EXPLAIN ANALYZE */
+	long			pq_pushes;
+	long			pq_pops;
+	long			pq_stale;		/* entries popped after a shorter path */
+	long			edges_relaxed;
+	long			max_visited;	/* peak size of visited_nodes */
+	long			searches_resumed;
 } DijkstraState;
 
+typedef struct ShortestpathState
+{
+	PlanState	ps;
+	MemoryContext sp_mcxt;		/* visited nodes, frontiers and paths */
+	HTAB	   *fwd_visited;	/* nodes reached from the source */
+	HTAB	   *bwd_visited;	/* nodes reached from the target */
+	List	   *fwd_frontier;
+	List	   *bwd_frontier;
+	int			fwd_hops;
+	int			bwd_hops;
+	ExprState  *source;
+	ExprState  *target;
+	List	   *meets;			/* edges where the two searches met */
+	ListCell   *curr_meet;
+	struct spchain *fwd_chain;	/* current path from the source */
+	struct spchain *bwd_chain;	/* current path to the target */
+	int16		elemlength;		/* typlen of graphid */
+	bool		elembyval;		/* is graphid pass-by-value? */
+	char		elemalign;		/* typalign of graphid */
+	bool		is_executed;
+	/* for EXPLAIN ANALYZE, indexed by the number of hops */
+	TraversalDepthStats *fwd_stats;
+	int			fwd_nstats;
+	TraversalDepthStats *bwd_stats;
+	int			bwd_nstats;
+} ShortestpathState;
+
 #endif							/* EXECNODES_H */
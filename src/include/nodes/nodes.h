@@ -88,6 +88,7 @@ typedef enum NodeTag
 	T_Eager,
 	T_ModifyGraph,
 	T_Dijkstra,
+	T_Shortestpath,
 	/* these aren't subclasses of Plan: */
 	T_NestLoopParam,
 	T_PlanRowMark,
@@ -144,6 +145,7 @@ typedef enum NodeTag
 	T_LimitState,
 	T_ModifyGraphState,
 	T_DijkstraState,
+	T_ShortestpathState,
 
 	/*
 	 * TAGS FOR PRIMITIVE NODES (primnodes.h)
@@ -269,6 +271,7 @@ typedef enum NodeTag
 	T_EagerPath,
 	T_ModifyGraphPath,
 	T_DijkstraPath,
+	T_ShortestpathPath,
 	/* these aren't subclasses of Path: */
 	T_EquivalenceClass,
 	T_EquivalenceMember,
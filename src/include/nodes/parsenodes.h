@@ -186,6 +186,19 @@ typedef struct Query
 	Node	   *dijkstraSource;
 	Node	   *dijkstraTarget;
 	Node	   *dijkstraLimit;
+	bool		dijkstraLoopless;
+	Node	   *dijkstraHeuristic;	/* NULL if there is no heuristic */
+	Oid			dijkstraTopology;	/* edge label if the edges to expand are
+									 * given by its topology only */
+	bool		dijkstraReverse;	/* expand from "end" to "start" */
+
+	Node	   *shortestpathEndId;
+	Node	   *shortestpathEdgeId;
+	Node	   *shortestpathSource;
+	Node	   *shortestpathTarget;
+	int			shortestpathMinHops;
+	int			shortestpathMaxHops;	/* -1 if unbounded */
+	bool		shortestpathAll;		/* allshortestpaths() */
 
 	struct {
 		GraphWriteOp writeOp;
@@ -3687,7 +3700,10 @@ typedef struct CypherPath
 	Node	   *weight;
 	Node	   *qual;
 	Node	   *limit;
+	bool		loopless;	/* k shortest loopless paths */
 	Node	   *weight_var;
+	Node	   *heuristic;
+	Node	   *heuristic_var;	/* CypherName of the candidate vertex */
 } CypherPath;
 
 typedef struct CypherNode
@@ -248,6 +248,9 @@ typedef struct Append
 	/* RT indexes of non-leaf tables in a partition tree */
 	List	   *partitioned_rels;
 	List	   *appendplans;
+	/* run-time pruning of labels, see ExecAppend() */
+	Expr	   *labid_expr;		/* graphid probing the id of the labels */
+	List	   *labids;			/* label ID of each subplan */
 } Append;
 
 /* ----------------
@@ -700,6 +703,9 @@ typedef struct NestLoopVLE
 	NestLoop	nl;
 	int			minHops;
 	int			maxHops;
+	bool		skipIds;		/* leave the ids column NULL */
+	bool		skipEdges;		/* leave the edges column NULL */
+	Oid			graphOid;		/* graph to fetch property maps of edges */
 } NestLoopVLE;
 
 /* ----------------
@@ -1079,6 +1085,24 @@ typedef struct Dijkstra
 	Node	   *source;
 	Node	   *target;
 	Node	   *limit;
+	bool		loopless;		/* k shortest loopless paths (Yen) */
+	AttrNumber	heuristic;		/* 0 if there is no heuristic */
+	Oid			topology;		/* edge label whose topology gives the edges
+								 * to expand, or InvalidOid */
+	bool		topology_reverse;	/* expand from "end" to "start" */
+	double		topology_weight;	/* weight of every edge */
 } Dijkstra;
 
+typedef struct Shortestpath
+{
+	Plan		plan;
+	AttrNumber	end_id;
+	AttrNumber	edge_id;
+	Node	   *source;
+	Node	   *target;
+	int			min_hops;
+	int			max_hops;		/* -1 if unbounded */
+	bool		all_paths;		/* find all shortest paths */
+} Shortestpath;
+
 #endif							/* PLANNODES_H */
@@ -1456,6 +1456,9 @@ typedef struct JoinExpr
 	int			rtindex;		/* RT index assigned for join, or 0 */
 	int         minHops;
 	int         maxHops;
+	bool		skipIds;		/* VLE: nobody reads the ids column */
+	bool		skipEdges;		/* VLE: nobody reads the edges column */
+	Oid			graphOid;		/* VLE: graph that the edges belong to */
 } JoinExpr;
 
 /*----------
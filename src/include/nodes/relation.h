@@ -76,6 +76,7 @@ typedef enum UpperRelationKind
 	UPPERREL_DISTINCT,			/* result of "SELECT DISTINCT", if any */
 	UPPERREL_ORDERED,			/* result of ORDER BY, if any */
 	UPPERREL_DIJKSTRA,			/* result of dijkstra */
+	UPPERREL_SHORTESTPATH,		/* result of shortestpath */
 	UPPERREL_FINAL				/* result of any remaining top-level actions */
 	/* NB: UPPERREL_FINAL must be last enum entry; it's used to size arrays */
 } UpperRelationKind;
@@ -305,6 +306,8 @@ typedef struct PlannerInfo
 										 * pseudoconstant = true */
 	bool		hasRecursion;	/* true if planning a recursive WITH item */
 	bool		hasVLEJoinRTE;  /* has VLE join or a child node of VLE join */
+	bool		hasGraphTraversal;	/* has VLE join, Dijkstra or shortestpath,
+									 * or a child node of them */
 
 	/* These fields are used only when hasRecursion is true: */
 	int			wt_param_id;	/* PARAM_EXEC ID for the work table */
@@ -1309,6 +1312,9 @@ typedef struct JoinPath
 
 	int			minhops;
 	int			maxhops;
+	bool		skipids;
+	bool		skipedges;
+	Oid			graphoid;
 } JoinPath;
 
 /*
@@ -1648,8 +1654,23 @@ typedef struct DijkstraPath
 	Node	   *source;
 	Node	   *target;
 	Node	   *limit;
+	bool		loopless;
+	Node	   *heuristic;
 } DijkstraPath;
 
+typedef struct ShortestpathPath
+{
+	Path		path;
+	Path	   *subpath;
+	Node	   *end_id;
+	Node	   *edge_id;
+	Node	   *source;
+	Node	   *target;
+	int			min_hops;
+	int			max_hops;
+	bool		all_paths;
+} ShortestpathPath;
+
 /*
  * Restriction clause info.
  *
@@ -1978,6 +1999,9 @@ typedef struct SpecialJoinInfo
 	/* Fields for JOIN_VLE */
 	int			min_hops;
 	int			max_hops;
+	bool		skip_ids;		/* don't materialize the ids column */
+	bool		skip_edges;		/* don't materialize the edges column */
+	Oid			graph_oid;		/* graph that the edges belong to */
 } SpecialJoinInfo;
 
 /*
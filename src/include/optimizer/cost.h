@@ -113,9 +113,12 @@ extern void cost_merge_append(Path *path, PlannerInfo *root,
 extern void cost_material(Path *path,
 			  Cost input_startup_cost, Cost input_total_cost,
 			  double tuples, int width);
-extern void cost_dijkstra(Path *path,
+extern void cost_dijkstra(Path *path, PlannerInfo *root,
 			  Cost input_startup_cost, Cost input_total_cost,
 			  double tuples, int width);
+extern void cost_shortestpath(Path *path, PlannerInfo *root,
+				  Cost input_startup_cost, Cost input_total_cost,
+				  double tuples, bool all_paths);
 extern void cost_agg(Path *path, PlannerInfo *root,
 		 AggStrategy aggstrategy, const AggClauseCosts *aggcosts,
 		 int numGroupCols, double numGroups,
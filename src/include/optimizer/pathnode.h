@@ -263,7 +263,16 @@ extern DijkstraPath *create_dijkstra_path(PlannerInfo *root, RelOptInfo *rel,
 										  int weight, bool weight_out,
 										  Node *end_id, Node *edge_id,
 										  Node *source, Node *target,
-										  Node *limit);
+										  Node *limit, bool loopless,
+										  Node *heuristic);
+extern ShortestpathPath *create_shortestpath_path(PlannerInfo *root,
+												  RelOptInfo *rel,
+												  Path *subpath,
+												  PathTarget *path_target,
+												  Node *end_id, Node *edge_id,
+												  Node *source, Node *target,
+												  int min_hops, int max_hops,
+												  bool all_paths);
 
 /*
  * prototypes for relnode.c
@@ -37,6 +37,9 @@ extern int32 get_relation_data_width(Oid relid, int32 *attr_widths);
 
 extern bool relation_excluded_by_constraints(PlannerInfo *root,
 								 RelOptInfo *rel, RangeTblEntry *rte);
+extern bool relation_excluded_by_labid(PlannerInfo *root,
+						   RelOptInfo *rel, RangeTblEntry *rte);
+extern Expr *label_id_probe(Expr *clause, Index varno, AttrNumber id_attno);
 
 extern List *build_physical_tlist(PlannerInfo *root, RelOptInfo *rel);
 
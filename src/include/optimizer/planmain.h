@@ -63,7 +63,15 @@ extern ModifyGraph *make_modifygraph(PlannerInfo *root, GraphWriteOp operation,
 extern Dijkstra *make_dijkstra(PlannerInfo *root, List *tlist, Plan *subplan,
 							   AttrNumber weight, bool weight_out,
 							   AttrNumber end_id, AttrNumber edge_id,
-							   Node *source, Node *target, Node *limit);
+							   Node *source, Node *target, Node *limit,
+							   bool loopless, AttrNumber heuristic,
+							   Oid topology, bool topology_reverse,
+							   double topology_weight);
+extern Shortestpath *make_shortestpath(PlannerInfo *root, List *tlist,
+									   Plan *subplan, AttrNumber end_id,
+									   AttrNumber edge_id, Node *source,
+									   Node *target, int min_hops,
+									   int max_hops, bool all_paths);
 
 /* External use of these functions is deprecated: */
 extern Sort *make_sort_from_sortclauses(List *sortcls, Plan *lefttree);
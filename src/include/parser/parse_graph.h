@@ -13,6 +13,10 @@
 
 #include "parser/parse_node.h"
 
+/* path arrays of the subquery for a variable length edge */
+#define VLE_COLNAME_IDS			"ids"
+#define VLE_COLNAME_EDGES		"edges"
+
 extern bool enable_eager;
 
 extern Query *transformCypherSubPattern(ParseState *pstate,
@@ -229,7 +229,6 @@ struct ParseState
 	bool		p_is_optional_match;
 	uint32		p_nr_modify_clause;
 	List	   *p_target_labels;		/* relation Oid's of target labels */
-	char	   *p_delete_edges_resname;
 };
 
 /*
@@ -13,6 +13,8 @@
 
 #include "parser/parse_node.h"
 
+extern bool enable_shortestpath;
+
 extern Query *transformShortestPath(ParseState *pstate, CypherPath *cpath);
 extern Query *transformShortestPathInMatch(ParseState *parentParseState,
 										   CypherPath *cpath);
@@ -17,6 +17,8 @@
 
 #include "parser/parse_node.h"
 
+/* GUC parameter */
+extern int	label_id_cache;
 
 extern List *transformCreateStmt(CreateStmt *stmt, const char *queryString);
 extern List *transformAlterTableStmt(Oid relid, AlterTableStmt *stmt,
@@ -1,6 +1,6 @@
 /*
  * dijkstra.h
- *	  Declarations for dijkstra
+ *	  Declarations for dijkstra and shortestpath
  *
  * Copyright (c) 2017 by Bitnine Global, Inc.
  *
@@ -16,5 +16,7 @@
 
 extern Datum dijkstra_vids(PG_FUNCTION_ARGS);
 extern Datum dijkstra_eids(PG_FUNCTION_ARGS);
+extern Datum shortestpath_vids(PG_FUNCTION_ARGS);
+extern Datum shortestpath_eids(PG_FUNCTION_ARGS);
 
 #endif	/* DIJKSTRA_H */
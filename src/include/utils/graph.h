@@ -69,6 +69,7 @@ extern Datum graphid_send(PG_FUNCTION_ARGS);
 extern Datum graphid_labid(PG_FUNCTION_ARGS);
 extern Datum graphid_locid(PG_FUNCTION_ARGS);
 extern Datum graph_labid(PG_FUNCTION_ARGS);
+extern Datum graphid_typanalyze(PG_FUNCTION_ARGS);
 /* graphid - comparison */
 extern Datum graphid_eq(PG_FUNCTION_ARGS);
 extern Datum graphid_ne(PG_FUNCTION_ARGS);
@@ -101,6 +102,8 @@ extern Datum btrowidcmp(PG_FUNCTION_ARGS);
 /* vertex */
 extern Datum vertex_out(PG_FUNCTION_ARGS);
 extern Datum _vertex_out(PG_FUNCTION_ARGS);
+extern Datum vertex_recv(PG_FUNCTION_ARGS);
+extern Datum vertex_send(PG_FUNCTION_ARGS);
 extern Datum vertex_label(PG_FUNCTION_ARGS);
 extern Datum _vertex_length(PG_FUNCTION_ARGS);
 extern Datum vtojb(PG_FUNCTION_ARGS);
@@ -115,6 +118,8 @@ extern Datum vertex_ge(PG_FUNCTION_ARGS);
 /* edge */
 extern Datum edge_out(PG_FUNCTION_ARGS);
 extern Datum _edge_out(PG_FUNCTION_ARGS);
+extern Datum edge_recv(PG_FUNCTION_ARGS);
+extern Datum edge_send(PG_FUNCTION_ARGS);
 extern Datum edge_label(PG_FUNCTION_ARGS);
 extern Datum _edge_length(PG_FUNCTION_ARGS);
 extern Datum etojb(PG_FUNCTION_ARGS);
@@ -128,6 +133,8 @@ extern Datum edge_ge(PG_FUNCTION_ARGS);
 
 /* graphpath */
 extern Datum graphpath_out(PG_FUNCTION_ARGS);
+extern Datum graphpath_recv(PG_FUNCTION_ARGS);
+extern Datum graphpath_send(PG_FUNCTION_ARGS);
 extern Datum _graphpath_length(PG_FUNCTION_ARGS);
 extern Datum graphpath_length(PG_FUNCTION_ARGS);
 extern Datum graphpath_vertices(PG_FUNCTION_ARGS);
@@ -154,6 +161,17 @@ extern Datum makeGraphVertexDatum(Datum id, Datum prop_map, Datum tid);
 extern Datum makeGraphEdgeDatum(Datum id, Datum start, Datum end,
 								Datum prop_map, Datum tid);
 
+/* graph algorithms */
+extern Datum graph_pagerank(PG_FUNCTION_ARGS);
+extern Datum graph_wcc(PG_FUNCTION_ARGS);
+extern Datum graph_triangle_count(PG_FUNCTION_ARGS);
+extern Datum graph_degree_centrality(PG_FUNCTION_ARGS);
+extern Datum graph_topology_cache_load(PG_FUNCTION_ARGS);
+
+/* bulk load */
+extern Datum graph_load_vertices(PG_FUNCTION_ARGS);
+extern Datum graph_load_edges(PG_FUNCTION_ARGS);
+
 /* index support - BTree */
 extern Datum btgraphidcmp(PG_FUNCTION_ARGS);
 /* index support - Hash */
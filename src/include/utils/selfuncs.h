@@ -63,6 +63,17 @@
 	} while (0)
 
 
+/* Return data from get_graph_degree_stats */
+typedef struct GraphDegreeStats
+{
+	double		nedges;			/* number of edges */
+	double		nvertices;		/* number of vertices having an edge */
+	double		avg_degree;		/* see STATISTIC_KIND_DEGREE */
+	double		sb_degree;
+	double		max_degree;
+	bool		isdefault;		/* true if there are no degree statistics */
+} GraphDegreeStats;
+
 /* Return data from examine_variable and friends */
 typedef struct VariableStatData
 {
@@ -209,6 +220,9 @@ extern double estimate_num_groups(PlannerInfo *root, List *groupExprs,
 extern Selectivity estimate_hash_bucketsize(PlannerInfo *root, Node *hashkey,
 						 double nbuckets);
 
+extern bool get_graph_degree_stats(PlannerInfo *root,
+					   GraphDegreeStats *degree);
+
 extern List *deconstruct_indexquals(IndexPath *path);
 extern void genericcostestimate(PlannerInfo *root, IndexPath *path,
 					double loop_count,
@@ -0,0 +1,88 @@
+--
+-- Graph Topology Cache
+--
+SHOW graph_topology_cache_size;
+
+-- lines of EXPLAIN ANALYZE VERBOSE of `query` that match `pattern`
+CREATE FUNCTION explain_analyze(query text, pattern text)
+RETURNS SETOF text AS $$
+DECLARE
+  ln text;
+BEGIN
+  FOR ln IN EXECUTE
+    'EXPLAIN (ANALYZE, VERBOSE, COSTS OFF, TIMING OFF, SUMMARY OFF) ' || query
+  LOOP
+    IF ln ~ pattern THEN
+      RETURN NEXT regexp_replace(btrim(ln), '\d+kB', 'NkB', 'g');
+    END IF;
+  END LOOP;
+END;
+$$ LANGUAGE plpgsql;
+
+CREATE GRAPH topo;
+SET graph_path = topo;
+
+CREATE VLABEL v;
+CREATE ELABEL e;
+CREATE ELABEL f INHERITS (e);
+
+CREATE (:v {id: 1});
+CREATE (:v {id: 2});
+CREATE (:v {id: 3});
+CREATE (:v {id: 4});
+CREATE (:v {id: 5});
+CREATE (:v {id: 6});
+
+-- 1 -> 2 -> 3 -> 4 -> 6, 1 -> 5 -> 4 (through the child label)
+MATCH (a:v {id: 1}), (b:v {id: 2}) CREATE (a)-[:e {w: 1}]->(b);
+MATCH (a:v {id: 2}), (b:v {id: 3}) CREATE (a)-[:e {w: 1}]->(b);
+MATCH (a:v {id: 3}), (b:v {id: 4}) CREATE (a)-[:e {w: 1}]->(b);
+MATCH (a:v {id: 4}), (b:v {id: 6}) CREATE (a)-[:e {w: 1}]->(b);
+MATCH (a:v {id: 1}), (b:v {id: 5}) CREATE (a)-[:f {w: 1}]->(b);
+MATCH (a:v {id: 5}), (b:v {id: 4}) CREATE (a)-[:f {w: 1}]->(b);
+
+-- not cached yet, the subplan gives the edges
+MATCH (a:v {id: 1}), (b:v), (p, x)=dijkstra((a)-[:e]->(b), 1)
+RETURN b.id, x, nodes(p) ORDER BY 1;
+MATCH (a:v {id: 6}), (b:v), (p, x)=dijkstra((a)<-[:e]-(b), 1)
+RETURN b.id, x, nodes(p) ORDER BY 1;
+SELECT explain_analyze($$
+MATCH (a:v {id: 1}), (b:v), (p, x)=dijkstra((a)-[:e]->(b), 1)
+RETURN x$$, 'Adjacency Cache|Topology Cache');
+
+SELECT topology_cache_load('e');
+
+-- the same paths from the cached edges
+MATCH (a:v {id: 1}), (b:v), (p, x)=dijkstra((a)-[:e]->(b), 1)
+RETURN b.id, x, nodes(p) ORDER BY 1;
+MATCH (a:v {id: 6}), (b:v), (p, x)=dijkstra((a)<-[:e]-(b), 1)
+RETURN b.id, x, nodes(p) ORDER BY 1;
+SELECT explain_analyze($$
+MATCH (a:v {id: 1}), (b:v), (p, x)=dijkstra((a)-[:e]->(b), 1)
+RETURN x$$, 'Adjacency Cache|Topology Cache');
+
+-- edges that are not given by the topology alone are not taken from it
+SELECT explain_analyze($$
+MATCH (a:v {id: 1}), (b:v), (p, x)=dijkstra((a)-[r:e]->(b), r.w)
+RETURN x$$, 'Topology Cache');
+SELECT explain_analyze($$
+MATCH (a:v {id: 1}), (b:v), (p, x)=dijkstra((a)-[r:e]->(b), 1, r.w = 1)
+RETURN x$$, 'Topology Cache');
+
+-- a write discards the label, so the new edge is seen
+MATCH (a:v {id: 1}), (b:v {id: 4}) CREATE (a)-[:e {w: 1}]->(b);
+MATCH (a:v {id: 1}), (b:v), (p, x)=dijkstra((a)-[:e]->(b), 1)
+RETURN b.id, x, nodes(p) ORDER BY 1;
+SELECT explain_analyze($$
+MATCH (a:v {id: 1}), (b:v), (p, x)=dijkstra((a)-[:e]->(b), 1)
+RETURN x$$, 'Topology Cache');
+
+SELECT topology_cache_load('e');
+MATCH (a:v {id: 1}), (b:v), (p, x)=dijkstra((a)-[:e]->(b), 1)
+RETURN b.id, x, nodes(p) ORDER BY 1;
+SELECT explain_analyze($$
+MATCH (a:v {id: 1}), (b:v), (p, x)=dijkstra((a)-[:e]->(b), 1)
+RETURN x$$, 'Topology Cache');
+
+DROP GRAPH topo CASCADE;
+DROP FUNCTION explain_analyze(text, text);
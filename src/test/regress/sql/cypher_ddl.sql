@@ -114,6 +114,10 @@ REINDEX VLABEL g.vdi;
 SELECT attname, attstattarget FROM pg_attribute
 WHERE attrelid = 'g.e1'::regclass;
 
+-- check default indexes of edge label
+SELECT pg_get_indexdef(indexrelid) FROM pg_index
+WHERE indrelid = 'g.e1'::regclass ORDER BY indexrelid;
+
 --
 -- COMMENT and \dG commands
 --
@@ -371,6 +375,61 @@ CREATE CONSTRAINT ON regv8 ASSERT ($1).c IS NOT NULL;
 
 DROP VLABEL regv8;
 
+--
+-- Property columns
+--
+
+CREATE VLABEL regv9 WITH (property_columns = 'name, age');
+SELECT attname, format_type(atttypid, atttypmod) AS type
+FROM pg_attribute
+WHERE attrelid = 'g.regv9'::regclass AND attnum > 0
+ORDER BY attnum;
+
+CREATE (:regv9 {name: 'agens', age: 3});
+CREATE (:regv9 {name: 'graph'});
+SELECT name, age FROM g.regv9 ORDER BY id;
+
+MATCH (n:regv9 {name: 'graph'}) SET n.name = 'bitnine', n.age = 1;
+SELECT name, age FROM g.regv9 ORDER BY id;
+
+EXPLAIN (COSTS OFF) MATCH (n:regv9) WHERE n.name = 'agens' RETURN n.age AS age;
+MATCH (n:regv9) WHERE n.name = 'agens' RETURN n.age AS age;
+
+-- the columns must agree with the property map
+SELECT pg_get_constraintdef(oid) AS def FROM pg_constraint
+WHERE conrelid = 'g.regv9'::regclass AND contype = 'c'
+ORDER BY def;
+
+-- property keys are case sensitive
+CREATE VLABEL regv12 WITH (property_columns = 'firstName, Age');
+SELECT attname FROM pg_attribute
+WHERE attrelid = 'g.regv12'::regclass AND attnum > 2
+ORDER BY attnum;
+CREATE (:regv12 {'firstName': 'agens', 'Age': 3, age: 4});
+SELECT "firstName", "Age" FROM g.regv12;
+EXPLAIN (COSTS OFF)
+MATCH (n:regv12) WHERE n.'firstName' = 'agens' RETURN n.'Age' AS age;
+MATCH (n:regv12) WHERE n.'firstName' = 'agens'
+RETURN n.'Age' AS upper, n.age AS lower;
+DROP VLABEL regv12;
+
+-- wrong case
+CREATE VLABEL regv10 WITH (property_columns = 'properties');
+CREATE VLABEL regv10 WITH (property_columns = 'name, name');
+
+DROP VLABEL regv9;
+
+--
+-- Label ID cache
+--
+
+SET label_id_cache = 100;
+CREATE VLABEL regv11;
+RESET label_id_cache;
+SELECT seqcache FROM pg_sequence
+WHERE seqrelid = 'g.regv11_id_seq'::regclass;
+DROP VLABEL regv11;
+
 --
 -- DROP GRAPH
 --
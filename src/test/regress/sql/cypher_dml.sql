@@ -10,6 +10,25 @@ CREATE TABLE history (year, event) AS VALUES
 (1996, 'PostgreSQL'),
 (2016, 'Graph');
 
+-- lines of EXPLAIN (or EXPLAIN ANALYZE VERBOSE) of `query` that match `pattern`
+CREATE FUNCTION explain_plan(query text, pattern text, do_analyze bool = false)
+RETURNS SETOF text AS $$
+DECLARE
+  opts text := 'COSTS OFF';
+  ln text;
+BEGIN
+  IF do_analyze THEN
+    opts := 'ANALYZE, VERBOSE, COSTS OFF, TIMING OFF, SUMMARY OFF';
+  END IF;
+  FOR ln IN EXECUTE 'EXPLAIN (' || opts || ') ' || query
+  LOOP
+    IF ln ~ pattern THEN
+      RETURN NEXT regexp_replace(btrim(ln), '\d+kB', 'NkB', 'g');
+    END IF;
+  END LOOP;
+END;
+$$ LANGUAGE plpgsql;
+
 DROP GRAPH agens CASCADE;
 CREATE GRAPH agens;
 
@@ -323,6 +342,25 @@ CREATE (:time {sec: 11})-[:goes {int: 1}]->
 MATCH (a:time)-[x:goes*1..2 {int: 1}]->(b:time)
 RETURN a.sec AS a, length(x) AS x, b.sec AS b;
 
+-- 21->22->23->24->25->26->27->28->29->30->31->32
+--                                     +<-------+
+CREATE (:time {sec: 21})-[:goes]->
+       (:time {sec: 22})-[:goes]->
+       (:time {sec: 23})-[:goes]->
+       (:time {sec: 24})-[:goes]->
+       (:time {sec: 25})-[:goes]->
+       (:time {sec: 26})-[:goes]->
+       (:time {sec: 27})-[:goes]->
+       (:time {sec: 28})-[:goes]->
+       (:time {sec: 29})-[:goes]->
+       (:time {sec: 30})-[:goes]->
+       (:time {sec: 31})-[:goes]->
+       (:time {sec: 32});
+MATCH (a:time {sec: 32}), (b:time {sec: 30}) CREATE (a)-[:goes]->(b);
+
+MATCH (a:time {sec: 21})-[x:goes*]->(b:time)
+RETURN length(x) AS l, b.sec AS b ORDER BY l;
+
 CREATE VLABEL person;
 CREATE ELABEL knows;
 
@@ -457,6 +495,21 @@ SELECT * FROM (
   RETURN x[1]
 ) AS foo;
 
+-- each worker expands the paths from the start vertices it scans
+SET force_parallel_mode = on;
+SET max_parallel_workers_per_gather = 1;
+SET min_parallel_table_scan_size = 0;
+SET parallel_setup_cost = 0;
+SET parallel_tuple_cost = 0;
+EXPLAIN (COSTS OFF)
+MATCH (a:person)-[x:knows*1..2]->(b) RETURN a.id, x;
+MATCH (a:person)-[x:knows*1..2]->(b) RETURN a.id AS id, x ORDER BY id, x;
+RESET force_parallel_mode;
+RESET max_parallel_workers_per_gather;
+RESET min_parallel_table_scan_size;
+RESET parallel_setup_cost;
+RESET parallel_tuple_cost;
+
 -- shortestpath(), allshortestpaths()
 
 CREATE OR REPLACE FUNCTION ids(vertex[]) RETURNS int[] AS $$
@@ -512,6 +565,12 @@ CREATE (p)-[:knows]->(:person {id: 6})-[:knows]->(f);
 MATCH (p:person), (f:person) WHERE p.id = 1 AND f.id = 5
 RETURN length(allshortestpaths((p)-[:knows*]-(f))) AS cnt;
 
+-- the same as above without the bidirectional search
+SET enable_shortestpath = off;
+MATCH (p:person), (f:person) WHERE p.id = 1 AND f.id = 5
+RETURN length(allshortestpaths((p)-[:knows*]-(f))) AS cnt;
+RESET enable_shortestpath;
+
 CREATE VLABEL v;
 CREATE ELABEL e;
 
@@ -612,6 +671,11 @@ MATCH (v1:v {id: 0}), (v2:v {id: 3}),
       p=dijkstra((v1)-[:e]->(v2), 1, LIMIT 10)
 RETURN nodes(p);
 
+MATCH (v1:v {id: 0}), (v2:v {id: 3}),
+      (path, x)=dijkstra((v1)-[e:e]->(v2), e.weight,
+                         HEURISTIC n | (n.id - v2.id) * (n.id - v2.id) / 10)
+RETURN nodes(path), x;
+
 MATCH (:v {id: 4})-[e:e]-(:v {id: 6})
 SET e.weight = 4;
 
@@ -626,6 +690,61 @@ RETURN nodes(path), x;
 MATCH (v1:v {id: 0}), (v2:v {id: 3})
 RETURN dijkstra((v1)-[e:e]->(v2), e.weight, LIMIT 2);
 
+MATCH (v1:v {id: 0}), (v2:v {id: 3}),
+	  (path, x)=dijkstra((v1)-[e:e]->(v2), e.weight + 0.5, LIMIT 10 LOOPLESS)
+RETURN nodes(path), x;
+
+MATCH (v1:v {id: 0}), (v2:v),
+	  (path, x)=dijkstra((v1)-[e:e]->(v2), e.weight)
+RETURN v2.id AS id, x ORDER BY x;
+
+-- each worker searches from the sources it scans
+SET force_parallel_mode = on;
+SET max_parallel_workers_per_gather = 1;
+SET min_parallel_table_scan_size = 0;
+SET parallel_setup_cost = 0;
+SET parallel_tuple_cost = 0;
+EXPLAIN (COSTS OFF)
+MATCH (v1:v), (v2:v {id: 3}),
+	  (path, x)=dijkstra((v1)-[e:e]->(v2), e.weight)
+RETURN v1.id AS id, x;
+MATCH (v1:v), (v2:v {id: 3}),
+	  (path, x)=dijkstra((v1)-[e:e]->(v2), e.weight)
+RETURN v1.id AS id, x ORDER BY id;
+RESET force_parallel_mode;
+RESET max_parallel_workers_per_gather;
+RESET min_parallel_table_scan_size;
+RESET parallel_setup_cost;
+RESET parallel_tuple_cost;
+
+-- the search from the source goes on toward each next target
+SELECT substring(ln from 'Resumed Searches: \d+') AS resumed
+FROM explain_plan($$
+MATCH (v1:v {id: 0}), (v2:v),
+	  (path, x)=dijkstra((v1)-[e:e]->(v2), e.weight)
+RETURN x$$, 'Resumed Searches', true) AS ln;
+
+-- edges cached by the searches from the other sources
+SELECT explain_plan($$
+MATCH (v1:v), (v2:v {id: 3}),
+	  (path, x)=dijkstra((v1)-[e:e]->(v2), e.weight * e.weight)
+RETURN x$$, 'Adjacency Cache', true);
+
+-- nothing is cached if the cache is disabled
+SET enable_dijkstra_cache = off;
+SELECT explain_plan($$
+MATCH (v1:v), (v2:v {id: 3}),
+	  (path, x)=dijkstra((v1)-[e:e]->(v2), e.weight * e.weight)
+RETURN x$$, 'Adjacency Cache', true);
+RESET enable_dijkstra_cache;
+
+-- the heuristic depends on the target, so each target needs a new cache
+SELECT explain_plan($$
+MATCH (v1:v {id: 0}), (v2:v),
+	  (path, x)=dijkstra((v1)-[e:e]->(v2), e.weight * e.weight,
+						 HEURISTIC n | (n.id - v2.id) * 0)
+RETURN x$$, 'Adjacency Cache', true);
+
 MATCH (v1:v {id: 0}), (v2:v {id: 3}),
 	  (path, x)=dijkstra((v1)-[e:e]->(v2), e.weight, LIMIT 0)
 RETURN nodes(path), x;
@@ -637,6 +756,27 @@ MATCH (v1:v {id: 0}), (v2:v {id: 3}),
 	  (path, x)=dijkstra((v1)-[e:e]->(v2), e.weight, LIMIT 10)
 return nodes(path), x;
 
+-- A* goes on after the target while the estimated cost of a vertex is not
+-- larger than the weight of the target, to find every path of that weight
+CREATE GRAPH astar;
+SET graph_path = astar;
+CREATE VLABEL v;
+CREATE ELABEL e;
+CREATE (:v {name: 's', h: 0});
+CREATE (:v {name: 'a', h: 0});
+CREATE (:v {name: 'c', h: 1});
+CREATE (:v {name: 'b', h: 1});
+CREATE (:v {name: 't', h: 0});
+MATCH (s:v {name: 's'}), (a:v {name: 'a'}), (t:v {name: 't'})
+CREATE (s)-[:e {w: 1}]->(a)-[:e {w: 1}]->(t);
+MATCH (s:v {name: 's'}), (c:v {name: 'c'}), (b:v {name: 'b'}), (t:v {name: 't'})
+CREATE (s)-[:e {w: 0.5}]->(c)-[:e {w: 0.5}]->(b)-[:e {w: 1}]->(t);
+MATCH (s:v {name: 's'}), (t:v {name: 't'}),
+	  (path, x)=dijkstra((s)-[e:e]->(t), e.w, LIMIT 2, HEURISTIC n | n.h)
+RETURN nodes(path), x;
+
+DROP GRAPH astar CASCADE;
+
 SET graph_path = agens;
 
 --
@@ -757,6 +897,19 @@ DELETE r;
 
 MATCH (a) DETACH DELETE a;
 
+-- vertex having edges in several labels and a self-loop
+
+CREATE (h {name: 'hub'})-[:made_by]->({name: 'a'}),
+       (h)<-[:lib]-({name: 'b'}),
+       (h)-[:lib]->(h);
+
+MATCH (h {name: 'hub'})-[r:made_by]->() DETACH DELETE h, r;
+MATCH (a) RETURN a.name AS a ORDER BY a;
+
+SELECT count(*) FROM agens.ag_edge;
+
+MATCH (a) DETACH DELETE a;
+
 --
 -- Uniqueness
 --
@@ -933,6 +1086,11 @@ MATCH (a:person {name: 'agens'})
 
 MATCH (a:person {name: 'agens'}) RETURN properties(a);
 
+-- the properties of an element are read from one detoasted property map
+SELECT explain_plan($$
+  MATCH (a:person) RETURN a.name, a.age, a.key1
+$$, 'Detoasts', true);
+
 --
 -- MERGE
 --
@@ -1018,6 +1176,27 @@ MERGE (a)-[:hometown]->(b:city {name: a.bornin});
 
 MATCH (a:city) DETACH DELETE a;
 
+-- vertices created in the same statement
+MATCH (a:person)
+MERGE (:city {name: a.bornin});
+MATCH (c:city) RETURN c.name ORDER BY name;
+
+MATCH (a:city) DETACH DELETE a;
+
+-- the same, looked up through a hash join
+CREATE (:city {name: 'jeju'});
+
+SET enable_nestloop = off;
+EXPLAIN (COSTS OFF)
+MATCH (a:person)
+MERGE (c:city {name: a.bornin});
+MATCH (a:person)
+MERGE (c:city {name: a.bornin});
+RESET enable_nestloop;
+MATCH (c:city) RETURN c.name ORDER BY name;
+
+MATCH (a:city) DETACH DELETE a;
+
 -- unspecified direction
 CREATE (a {id: 2}), (b {id: 1});
 
@@ -1191,8 +1370,214 @@ LOAD FROM external_table AS r CREATE (=r);
 
 MATCH (n) RETURN n;
 
+-- elements are inserted in batches if CREATE returns nothing
+
+CREATE TABLE bulk_table AS SELECT i AS id FROM generate_series(1, 2500) AS i;
+
+LOAD FROM bulk_table AS r
+CREATE (:v {id: r.id})-[:e]->(:v {id: -r.id});
+
+MATCH (a:v)-[:e]->(b:v) WHERE a.id = -b.id RETURN count(*) AS c;
+
+DROP TABLE bulk_table;
+
+-- degree statistics of edges
+
+MATCH (a:v {id: 1}), (b:v) WHERE b.id > 1 AND b.id <= 10 CREATE (a)-[:e]->(b);
+
+ANALYZE impload.e;
+
+SELECT CASE 10000 WHEN stakind1 THEN stanumbers1
+              WHEN stakind2 THEN stanumbers2
+              WHEN stakind3 THEN stanumbers3
+              WHEN stakind4 THEN stanumbers4
+              WHEN stakind5 THEN stanumbers5 END AS degree
+FROM pg_statistic s JOIN pg_attribute a
+     ON a.attrelid = s.starelid AND a.attnum = s.staattnum
+WHERE s.starelid = 'impload.e'::regclass AND a.attname = 'start';
+
+-- DETACH DELETE probes the indexes of a large label for a few vertices
+-- (the counters may include the scans of earlier statements, so compare)
+BEGIN;
+SELECT seq_scan AS seq_before, idx_scan AS idx_before
+FROM pg_stat_xact_user_tables WHERE relid = 'impload.e'::regclass \gset
+MATCH (a:v {id: 1}) DETACH DELETE a;
+SELECT seq_scan - :seq_before AS seq_scan, idx_scan > :idx_before AS probed
+FROM pg_stat_xact_user_tables WHERE relid = 'impload.e'::regclass;
+COMMIT;
+
+MATCH (a:v)-[:e]->(b:v) RETURN count(*) AS c;
+SELECT count(*) FROM pg_stat_progress_detach_delete
+WHERE pid = pg_backend_pid();
+
+--
+-- pruning labels by the label ID of graphids
+--
+
+CREATE GRAPH prune;
+SET GRAPH_PATH = prune;
+
+CREATE VLABEL animal;
+CREATE VLABEL dog INHERITS (animal);
+CREATE VLABEL cat INHERITS (animal);
+
+CREATE (:animal {name: 'a'}), (:dog {name: 'd'}), (:cat {name: 'c'});
+
+-- a constant graphid leaves only the label having its label ID
+EXPLAIN (COSTS OFF)
+SELECT * FROM prune.animal WHERE id = graphid(4, 1);
+
+-- nothing stops a graphid of another label from being stored, so labels are
+-- pruned only while constraint exclusion is on
+SET constraint_exclusion = off;
+EXPLAIN (COSTS OFF)
+SELECT * FROM prune.animal WHERE id = graphid(4, 1);
+RESET constraint_exclusion;
+
+-- a graphid from the outer side skips the other labels at run time
+
+CREATE TABLE animal_ids (gid graphid);
+INSERT INTO animal_ids VALUES (graphid(4, 1)), (graphid(5, 1));
+ANALYZE animal_ids;
+
+SET enable_hashjoin = off;
+SET enable_mergejoin = off;
+EXPLAIN (ANALYZE, COSTS OFF, TIMING OFF, SUMMARY OFF)
+SELECT animal.id FROM animal_ids, prune.animal WHERE animal.id = gid;
+SELECT animal.id FROM animal_ids, prune.animal WHERE animal.id = gid;
+RESET enable_hashjoin;
+RESET enable_mergejoin;
+
+DROP TABLE animal_ids;
+
+--
+-- property maps of variable length edges
+--
+
+CREATE GRAPH vlep;
+SET GRAPH_PATH = vlep;
+
+CREATE VLABEL city;
+CREATE ELABEL road;
+
+CREATE (:city {name: 'a'})-[:road {km: 1}]->(:city {name: 'b'})
+       -[:road {km: 2}]->(:city {name: 'c'});
+
+MATCH (a:city {name: 'a'})-[x:road*1..2]->(b:city)
+RETURN b.name AS b, x ORDER BY b;
+
+-- the edges in the result have their final property maps
+MATCH (a:city {name: 'a'})-[x:road*1..1]->(b:city)
+MATCH (a)-[r:road]->(b)
+SET r.km = 11
+RETURN x, r;
+
+-- the edges keep the property maps that the query has scanned
+MATCH (a:city {name: 'b'})-[x:road*1..1]->(b:city)
+MATCH (a)-[r:road]->(b)
+DELETE r
+RETURN x;
+
+MATCH (a:city {name: 'a'})-[x:road*1..2]->(b:city)
+RETURN b.name AS b, x ORDER BY b;
+
+-- compact edges are never given out
+SELECT (graphid(4, 1), graphid(3, 1), graphid(3, 2), NULL, '(0,1)')::edge;
+
+-- what NestLoopVLE does at each depth, the last edge closes a cycle
+CREATE (:city {name: 'x'})-[:road]->(:city {name: 'y'})-[:road]->(:city {name: 'z'});
+MATCH (z:city {name: 'z'}), (x:city {name: 'x'}) CREATE (z)-[:road]->(x);
+SELECT explain_plan($$
+  MATCH (:city {name: 'x'})-[:road*1..4]->() RETURN count(*)
+$$, 'Depth \d|Max Path', true);
+
+-- the path arrays are built only for the columns the upper query reads
+SELECT explain_plan($$
+  MATCH (:city {name: 'x'})-[r:road*1..2]->() RETURN count(*)
+$$, 'Path Arrays', true);
+SELECT explain_plan($$
+  MATCH (:city {name: 'x'})-[r:road*1..2]->() RETURN r
+$$, 'Path Arrays', true);
+SELECT explain_plan($$
+  MATCH (:city {name: 'x'})-[r:road*1..2]->() WHERE length(r) = 2
+  RETURN count(*)
+$$, 'Path Arrays', true);
+SELECT explain_plan($$
+  MATCH (:city {name: 'x'})-[:road*1..2]->(m)-[:road*1..2]->()
+  RETURN count(*)
+$$, 'Path Arrays', true);
+MATCH (:city {name: 'x'})-[:road*1..2]->(m)-[:road*1..2]->()
+RETURN count(*);
+
+--
+-- property constraints and indexes
+--
+
+CREATE GRAPH pidx;
+SET graph_path = pidx;
+
+CREATE VLABEL pi;
+CREATE TABLE pi_src AS SELECT i AS k FROM generate_series(1, 1000) AS i;
+LOAD FROM pi_src AS r CREATE (:pi {k: r.k});
+DROP TABLE pi_src;
+CREATE INDEX pi_gin_idx ON pidx.pi USING gin (properties);
+ANALYZE pidx.pi;
+SET enable_seqscan = off;
+
+-- a GIN index on the property map is used for equality on a property
+SELECT explain_plan($$
+  MATCH (n:pi) WHERE n.k = 7 RETURN n
+$$, 'Scan');
+PREPARE pi_q(jsonb) AS MATCH (n:pi) WHERE n.k = $1 RETURN n;
+SELECT explain_plan($$EXECUTE pi_q('7')$$, 'Scan');
+
+-- a property index is cheaper, the prepared statement is planned again
+CREATE PROPERTY INDEX pi_k_idx ON pi (k);
+ANALYZE pidx.pi;
+SELECT explain_plan($$
+  MATCH (n:pi {k: 7}) RETURN n
+$$, 'Scan');
+SELECT explain_plan($$EXECUTE pi_q('7')$$, 'Scan');
+DROP PROPERTY INDEX pi_k_idx;
+SELECT explain_plan($$EXECUTE pi_q('7')$$, 'Scan');
+
+DEALLOCATE pi_q;
+RESET enable_seqscan;
+
+--
+-- bulk load
+--
+
+CREATE GRAPH bulkload;
+SET GRAPH_PATH = bulkload;
+
+CREATE VLABEL person;
+CREATE ELABEL knows;
+
+CREATE TABLE person_src (name text, age int);
+INSERT INTO person_src VALUES ('a', 1), ('b', 2), ('c', NULL);
+CREATE TABLE knows_src (src text, dst text, since int);
+INSERT INTO knows_src VALUES ('a', 'b', 2000), ('b', 'c', 2010), ('c', 'x', 2020);
+
+SELECT load_vertices('person', 'person_src');
+SELECT load_edges('knows', 'knows_src', 'person', 'name');
+
+MATCH (a:person)-[k:knows]->(b:person)
+RETURN a.name AS a, b.name AS b, k.since AS since ORDER BY a;
+MATCH (n:person {name: 'c'}) RETURN properties(n) AS p;
+
+-- wrong cases
+SELECT load_edges('knows', 'knows_src', 'knows', 'name');
+
+DROP TABLE knows_src;
+DROP TABLE person_src;
+
 -- cleanup
 
+DROP GRAPH pidx CASCADE;
+DROP GRAPH prune CASCADE;
+DROP GRAPH vlep CASCADE;
+DROP GRAPH bulkload CASCADE;
 DROP GRAPH impload CASCADE;
 DROP GRAPH gid CASCADE;
 DROP GRAPH np CASCADE;
@@ -1212,3 +1597,4 @@ DROP ELABEL doc;
 DROP GRAPH agens CASCADE;
 
 DROP TABLE history;
+DROP FUNCTION explain_plan(text, text, bool);
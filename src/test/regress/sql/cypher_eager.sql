@@ -368,6 +368,24 @@ MATCH (a), (b) WHERE a.no = 2
   RETURN properties(a) AS a, properties(b) AS b;
 MATCH (a) RETURN properties(a);
 
+-- elemTable that does not fit in eager_mem
+CREATE TABLE v4_src AS
+  SELECT i AS no, repeat('x', 200) AS pad FROM generate_series(1, 5000) AS i;
+LOAD FROM v4_src AS r CREATE (:v4 {no: r.no, pad: r.pad});
+DROP TABLE v4_src;
+
+SET eager_mem = 1024;
+MATCH (a:v4) SET a.no = a.no + 1;
+MATCH (a:v4) SET a.no = a.no + 1 RETURN a.no AS no ORDER BY no DESC LIMIT 1;
+-- elements SET again after elemTable has been spilled
+MATCH (b:v4) WHERE b.no <= 5 SET b.cnt = 0;
+MATCH (a:v4), (b:v4) WHERE a.no > 5 AND b.no <= 5
+SET a.no = a.no + 1, b.cnt = b.cnt + 1;
+MATCH (b:v4) WHERE b.no <= 5 RETURN b.no AS no, b.cnt AS cnt ORDER BY no;
+RESET eager_mem;
+
+SELECT count(*), sum((properties->>'no')::int) FROM eager_graph.v4;
+
 -- wrong case
 MERGE (a:v1) MERGE (b:v2 {name: a.notexistent});
 MERGE (a:v1) ON MATCH SET a.matched = true
@@ -121,3 +121,62 @@ MATCH (n) RETURN n.name, label(n), labels(n);
 DROP GRAPH vertex_labels_complex2 CASCADE;
 DROP GRAPH vertex_labels_complex1 CASCADE;
 DROP GRAPH vertex_labels_simple CASCADE;
+
+--
+-- graph algorithms
+--
+
+CREATE GRAPH algo;
+SET graph_path = algo;
+CREATE VLABEL node;
+CREATE ELABEL link;
+
+-- a -> b -> c -> a, c -> d, e
+CREATE (:node {name: 'a'});
+CREATE (:node {name: 'b'});
+CREATE (:node {name: 'c'});
+CREATE (:node {name: 'd'});
+CREATE (:node {name: 'e'});
+MATCH (a:node {name: 'a'}), (b:node {name: 'b'}) CREATE (a)-[:link]->(b);
+MATCH (b:node {name: 'b'}), (c:node {name: 'c'}) CREATE (b)-[:link]->(c);
+MATCH (c:node {name: 'c'}), (a:node {name: 'a'}) CREATE (c)-[:link]->(a);
+MATCH (c:node {name: 'c'}), (d:node {name: 'd'}) CREATE (c)-[:link]->(d);
+
+SELECT round(sum(rank)::numeric, 6) FROM pagerank('node', 'link');
+SELECT count(DISTINCT component) FROM weakly_connected_components('node', 'link');
+SELECT n.properties->>'name' AS name, t.triangles
+FROM triangle_count('node', 'link') t JOIN algo.node n ON n.id = t.id
+ORDER BY 1;
+SELECT n.properties->>'name' AS name, d.indegree, d.outdegree,
+       round(d.centrality::numeric, 2) AS centrality
+FROM degree_centrality('node', 'link') d JOIN algo.node n ON n.id = d.id
+ORDER BY 1;
+
+-- the snapshot does not grow with the local IDs of vertices
+SET graph_algorithm_work_mem = 1024;
+SELECT setval('algo.node_id_seq', 281474976710654) IS NOT NULL AS ok;
+CREATE (:node {name: 'f'});
+SELECT graphid_locid(id) FROM algo.node WHERE properties->>'name' = 'f';
+MATCH (e:node {name: 'e'}), (f:node {name: 'f'}) CREATE (e)-[:link]->(f);
+SELECT n.properties->>'name' AS name, d.indegree, d.outdegree
+FROM degree_centrality('node', 'link') d JOIN algo.node n ON n.id = d.id
+ORDER BY 1;
+RESET graph_algorithm_work_mem;
+
+-- wrong cases
+SELECT * FROM pagerank('link', 'link');
+SELECT * FROM pagerank('node', 'link', 1.5);
+SELECT topology_cache_load('link');
+
+-- rows filtered by row-level security are not read
+CREATE ROLE regress_algo_user;
+GRANT USAGE ON SCHEMA algo TO regress_algo_user;
+GRANT SELECT ON algo.node, algo.link TO regress_algo_user;
+ALTER TABLE algo.link ENABLE ROW LEVEL SECURITY;
+SET ROLE regress_algo_user;
+SELECT * FROM pagerank('node', 'link');
+RESET ROLE;
+SELECT count(*) FROM pagerank('node', 'link');
+
+DROP GRAPH algo CASCADE;
+DROP ROLE regress_algo_user;
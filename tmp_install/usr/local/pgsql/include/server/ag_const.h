@@ -0,0 +1,23 @@
+/*
+ * ag_const.h
+ *	  constants used in the graph implementation
+ *
+ * Copyright (c) 2016 by Bitnine Global, Inc.
+ *
+ * src/include/ag_const.h
+ */
+
+#ifndef AG_CONST_H
+#define AG_CONST_H
+
+#define AG_LABEL_SEQ		"ag_label_seq"
+#define AG_VERTEX			"ag_vertex"
+#define AG_EDGE				"ag_edge"
+#define AG_ELEM_LOCAL_ID	"id"
+#define AG_ELEM_ID			"id"
+#define AG_START_ID			"start"
+#define AG_END_ID			"end"
+#define AG_ELEM_PROP_MAP	"properties"
+#define AG_PROP_COLUMNS		"property_columns"
+
+#endif	/* AG_CONST_H */
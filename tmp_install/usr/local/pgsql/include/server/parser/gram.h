@@ -0,0 +1,610 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison interface for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+#ifndef YY_BASE_YY_GRAM_H_INCLUDED
+# define YY_BASE_YY_GRAM_H_INCLUDED
+/* Debug traces.  */
+#ifndef YYDEBUG
+# define YYDEBUG 0
+#endif
+#if YYDEBUG
+extern int base_yydebug;
+#endif
+
+/* Token kinds.  */
+#ifndef YYTOKENTYPE
+# define YYTOKENTYPE
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    IDENT = 258,                   /* IDENT  */
+    FCONST = 259,                  /* FCONST  */
+    SCONST = 260,                  /* SCONST  */
+    BCONST = 261,                  /* BCONST  */
+    XCONST = 262,                  /* XCONST  */
+    Op = 263,                      /* Op  */
+    ICONST = 264,                  /* ICONST  */
+    PARAM = 265,                   /* PARAM  */
+    TYPECAST = 266,                /* TYPECAST  */
+    DOT_DOT = 267,                 /* DOT_DOT  */
+    COLON_EQUALS = 268,            /* COLON_EQUALS  */
+    EQUALS_GREATER = 269,          /* EQUALS_GREATER  */
+    LESS_EQUALS = 270,             /* LESS_EQUALS  */
+    GREATER_EQUALS = 271,          /* GREATER_EQUALS  */
+    NOT_EQUALS = 272,              /* NOT_EQUALS  */
+    ADD_EQUALS = 273,              /* ADD_EQUALS  */
+    ABORT_P = 274,                 /* ABORT_P  */
+    ABSOLUTE_P = 275,              /* ABSOLUTE_P  */
+    ACCESS = 276,                  /* ACCESS  */
+    ACTION = 277,                  /* ACTION  */
+    ADD_P = 278,                   /* ADD_P  */
+    ADMIN = 279,                   /* ADMIN  */
+    AFTER = 280,                   /* AFTER  */
+    AGGREGATE = 281,               /* AGGREGATE  */
+    ALL = 282,                     /* ALL  */
+    ALLSHORTESTPATHS = 283,        /* ALLSHORTESTPATHS  */
+    ALSO = 284,                    /* ALSO  */
+    ALTER = 285,                   /* ALTER  */
+    ALWAYS = 286,                  /* ALWAYS  */
+    ANALYSE = 287,                 /* ANALYSE  */
+    ANALYZE = 288,                 /* ANALYZE  */
+    AND = 289,                     /* AND  */
+    ANY = 290,                     /* ANY  */
+    ARRAY = 291,                   /* ARRAY  */
+    AS = 292,                      /* AS  */
+    ASC = 293,                     /* ASC  */
+    ASSERT = 294,                  /* ASSERT  */
+    ASSERTION = 295,               /* ASSERTION  */
+    ASSIGNMENT = 296,              /* ASSIGNMENT  */
+    ASYMMETRIC = 297,              /* ASYMMETRIC  */
+    AT = 298,                      /* AT  */
+    ATTACH = 299,                  /* ATTACH  */
+    ATTRIBUTE = 300,               /* ATTRIBUTE  */
+    AUTHORIZATION = 301,           /* AUTHORIZATION  */
+    BACKWARD = 302,                /* BACKWARD  */
+    BEFORE = 303,                  /* BEFORE  */
+    BEGIN_P = 304,                 /* BEGIN_P  */
+    BETWEEN = 305,                 /* BETWEEN  */
+    BIGINT = 306,                  /* BIGINT  */
+    BINARY = 307,                  /* BINARY  */
+    BIT = 308,                     /* BIT  */
+    BOOLEAN_P = 309,               /* BOOLEAN_P  */
+    BOTH = 310,                    /* BOTH  */
+    BY = 311,                      /* BY  */
+    CACHE = 312,                   /* CACHE  */
+    CALLED = 313,                  /* CALLED  */
+    CASCADE = 314,                 /* CASCADE  */
+    CASCADED = 315,                /* CASCADED  */
+    CASE = 316,                    /* CASE  */
+    CAST = 317,                    /* CAST  */
+    CATALOG_P = 318,               /* CATALOG_P  */
+    CHAIN = 319,                   /* CHAIN  */
+    CHAR_P = 320,                  /* CHAR_P  */
+    CHARACTER = 321,               /* CHARACTER  */
+    CHARACTERISTICS = 322,         /* CHARACTERISTICS  */
+    CHECK = 323,                   /* CHECK  */
+    CHECKPOINT = 324,              /* CHECKPOINT  */
+    CLASS = 325,                   /* CLASS  */
+    CLOSE = 326,                   /* CLOSE  */
+    CLUSTER = 327,                 /* CLUSTER  */
+    COALESCE = 328,                /* COALESCE  */
+    COLLATE = 329,                 /* COLLATE  */
+    COLLATION = 330,               /* COLLATION  */
+    COLUMN = 331,                  /* COLUMN  */
+    COLUMNS = 332,                 /* COLUMNS  */
+    COMMENT = 333,                 /* COMMENT  */
+    COMMENTS = 334,                /* COMMENTS  */
+    COMMIT = 335,                  /* COMMIT  */
+    COMMITTED = 336,               /* COMMITTED  */
+    CONCURRENTLY = 337,            /* CONCURRENTLY  */
+    CONFIGURATION = 338,           /* CONFIGURATION  */
+    CONFLICT = 339,                /* CONFLICT  */
+    CONNECTION = 340,              /* CONNECTION  */
+    CONSTRAINT = 341,              /* CONSTRAINT  */
+    CONSTRAINTS = 342,             /* CONSTRAINTS  */
+    CONTAINS = 343,                /* CONTAINS  */
+    CONTENT_P = 344,               /* CONTENT_P  */
+    CONTINUE_P = 345,              /* CONTINUE_P  */
+    CONVERSION_P = 346,            /* CONVERSION_P  */
+    COPY = 347,                    /* COPY  */
+    COST = 348,                    /* COST  */
+    CREATE = 349,                  /* CREATE  */
+    CROSS = 350,                   /* CROSS  */
+    CSV = 351,                     /* CSV  */
+    CUBE = 352,                    /* CUBE  */
+    CURRENT_P = 353,               /* CURRENT_P  */
+    CURRENT_CATALOG = 354,         /* CURRENT_CATALOG  */
+    CURRENT_DATE = 355,            /* CURRENT_DATE  */
+    CURRENT_ROLE = 356,            /* CURRENT_ROLE  */
+    CURRENT_SCHEMA = 357,          /* CURRENT_SCHEMA  */
+    CURRENT_TIME = 358,            /* CURRENT_TIME  */
+    CURRENT_TIMESTAMP = 359,       /* CURRENT_TIMESTAMP  */
+    CURRENT_USER = 360,            /* CURRENT_USER  */
+    CURSOR = 361,                  /* CURSOR  */
+    CYCLE = 362,                   /* CYCLE  */
+    DATA_P = 363,                  /* DATA_P  */
+    DATABASE = 364,                /* DATABASE  */
+    DAY_P = 365,                   /* DAY_P  */
+    DEALLOCATE = 366,              /* DEALLOCATE  */
+    DEC = 367,                     /* DEC  */
+    DECIMAL_P = 368,               /* DECIMAL_P  */
+    DECLARE = 369,                 /* DECLARE  */
+    DEFAULT = 370,                 /* DEFAULT  */
+    DEFAULTS = 371,                /* DEFAULTS  */
+    DEFERRABLE = 372,              /* DEFERRABLE  */
+    DEFERRED = 373,                /* DEFERRED  */
+    DEFINER = 374,                 /* DEFINER  */
+    DELETE_P = 375,                /* DELETE_P  */
+    DELIMITER = 376,               /* DELIMITER  */
+    DELIMITERS = 377,              /* DELIMITERS  */
+    DEPENDS = 378,                 /* DEPENDS  */
+    DESC = 379,                    /* DESC  */
+    DETACH = 380,                  /* DETACH  */
+    DICTIONARY = 381,              /* DICTIONARY  */
+    DIJKSTRA = 382,                /* DIJKSTRA  */
+    DISABLE_P = 383,               /* DISABLE_P  */
+    DISCARD = 384,                 /* DISCARD  */
+    DISTINCT = 385,                /* DISTINCT  */
+    DO = 386,                      /* DO  */
+    DOCUMENT_P = 387,              /* DOCUMENT_P  */
+    DOMAIN_P = 388,                /* DOMAIN_P  */
+    DOUBLE_P = 389,                /* DOUBLE_P  */
+    DROP = 390,                    /* DROP  */
+    EACH = 391,                    /* EACH  */
+    ELABEL = 392,                  /* ELABEL  */
+    ELSE = 393,                    /* ELSE  */
+    ENABLE_P = 394,                /* ENABLE_P  */
+    ENCODING = 395,                /* ENCODING  */
+    ENCRYPTED = 396,               /* ENCRYPTED  */
+    END_P = 397,                   /* END_P  */
+    ENDS = 398,                    /* ENDS  */
+    ENUM_P = 399,                  /* ENUM_P  */
+    ESCAPE = 400,                  /* ESCAPE  */
+    EVENT = 401,                   /* EVENT  */
+    EXCEPT = 402,                  /* EXCEPT  */
+    EXCLUDE = 403,                 /* EXCLUDE  */
+    EXCLUDING = 404,               /* EXCLUDING  */
+    EXCLUSIVE = 405,               /* EXCLUSIVE  */
+    EXECUTE = 406,                 /* EXECUTE  */
+    EXISTS = 407,                  /* EXISTS  */
+    EXPLAIN = 408,                 /* EXPLAIN  */
+    EXTENSION = 409,               /* EXTENSION  */
+    EXTERNAL = 410,                /* EXTERNAL  */
+    EXTRACT = 411,                 /* EXTRACT  */
+    FALSE_P = 412,                 /* FALSE_P  */
+    FAMILY = 413,                  /* FAMILY  */
+    FETCH = 414,                   /* FETCH  */
+    FILTER = 415,                  /* FILTER  */
+    FIRST_P = 416,                 /* FIRST_P  */
+    FLOAT_P = 417,                 /* FLOAT_P  */
+    FOLLOWING = 418,               /* FOLLOWING  */
+    FOR = 419,                     /* FOR  */
+    FORCE = 420,                   /* FORCE  */
+    FOREIGN = 421,                 /* FOREIGN  */
+    FORWARD = 422,                 /* FORWARD  */
+    FREEZE = 423,                  /* FREEZE  */
+    FROM = 424,                    /* FROM  */
+    FULL = 425,                    /* FULL  */
+    FUNCTION = 426,                /* FUNCTION  */
+    FUNCTIONS = 427,               /* FUNCTIONS  */
+    GENERATED = 428,               /* GENERATED  */
+    GLOBAL = 429,                  /* GLOBAL  */
+    GRANT = 430,                   /* GRANT  */
+    GRANTED = 431,                 /* GRANTED  */
+    GRAPH = 432,                   /* GRAPH  */
+    GREATEST = 433,                /* GREATEST  */
+    GROUP_P = 434,                 /* GROUP_P  */
+    GROUPING = 435,                /* GROUPING  */
+    HANDLER = 436,                 /* HANDLER  */
+    HAVING = 437,                  /* HAVING  */
+    HEADER_P = 438,                /* HEADER_P  */
+    HEURISTIC = 439,               /* HEURISTIC  */
+    HOLD = 440,                    /* HOLD  */
+    HOUR_P = 441,                  /* HOUR_P  */
+    IDENTITY_P = 442,              /* IDENTITY_P  */
+    IF_P = 443,                    /* IF_P  */
+    ILIKE = 444,                   /* ILIKE  */
+    IMMEDIATE = 445,               /* IMMEDIATE  */
+    IMMUTABLE = 446,               /* IMMUTABLE  */
+    IMPLICIT_P = 447,              /* IMPLICIT_P  */
+    IMPORT_P = 448,                /* IMPORT_P  */
+    IN_P = 449,                    /* IN_P  */
+    INCLUDING = 450,               /* INCLUDING  */
+    INCREMENT = 451,               /* INCREMENT  */
+    INDEX = 452,                   /* INDEX  */
+    INDEXES = 453,                 /* INDEXES  */
+    INHERIT = 454,                 /* INHERIT  */
+    INHERITS = 455,                /* INHERITS  */
+    INITIALLY = 456,               /* INITIALLY  */
+    INLINE_P = 457,                /* INLINE_P  */
+    INNER_P = 458,                 /* INNER_P  */
+    INOUT = 459,                   /* INOUT  */
+    INPUT_P = 460,                 /* INPUT_P  */
+    INSENSITIVE = 461,             /* INSENSITIVE  */
+    INSERT = 462,                  /* INSERT  */
+    INSTEAD = 463,                 /* INSTEAD  */
+    INT_P = 464,                   /* INT_P  */
+    INTEGER = 465,                 /* INTEGER  */
+    INTERSECT = 466,               /* INTERSECT  */
+    INTERVAL = 467,                /* INTERVAL  */
+    INTO = 468,                    /* INTO  */
+    INVOKER = 469,                 /* INVOKER  */
+    IS = 470,                      /* IS  */
+    ISNULL = 471,                  /* ISNULL  */
+    ISOLATION = 472,               /* ISOLATION  */
+    JOIN = 473,                    /* JOIN  */
+    KEY = 474,                     /* KEY  */
+    LABEL = 475,                   /* LABEL  */
+    LANGUAGE = 476,                /* LANGUAGE  */
+    LARGE_P = 477,                 /* LARGE_P  */
+    LAST_P = 478,                  /* LAST_P  */
+    LATERAL_P = 479,               /* LATERAL_P  */
+    LEADING = 480,                 /* LEADING  */
+    LEAKPROOF = 481,               /* LEAKPROOF  */
+    LEAST = 482,                   /* LEAST  */
+    LEFT = 483,                    /* LEFT  */
+    LEVEL = 484,                   /* LEVEL  */
+    LIKE = 485,                    /* LIKE  */
+    LIMIT = 486,                   /* LIMIT  */
+    LISTEN = 487,                  /* LISTEN  */
+    LOAD = 488,                    /* LOAD  */
+    LOCAL = 489,                   /* LOCAL  */
+    LOCALTIME = 490,               /* LOCALTIME  */
+    LOCALTIMESTAMP = 491,          /* LOCALTIMESTAMP  */
+    LOCATION = 492,                /* LOCATION  */
+    LOCK_P = 493,                  /* LOCK_P  */
+    LOCKED = 494,                  /* LOCKED  */
+    LOGGED = 495,                  /* LOGGED  */
+    LOOPLESS = 496,                /* LOOPLESS  */
+    MAPPING = 497,                 /* MAPPING  */
+    MATCH = 498,                   /* MATCH  */
+    MATERIALIZED = 499,            /* MATERIALIZED  */
+    MAXVALUE = 500,                /* MAXVALUE  */
+    MERGE = 501,                   /* MERGE  */
+    METHOD = 502,                  /* METHOD  */
+    MINUTE_P = 503,                /* MINUTE_P  */
+    MINVALUE = 504,                /* MINVALUE  */
+    MODE = 505,                    /* MODE  */
+    MONTH_P = 506,                 /* MONTH_P  */
+    MOVE = 507,                    /* MOVE  */
+    NAME_P = 508,                  /* NAME_P  */
+    NAMES = 509,                   /* NAMES  */
+    NATIONAL = 510,                /* NATIONAL  */
+    NATURAL = 511,                 /* NATURAL  */
+    NCHAR = 512,                   /* NCHAR  */
+    NEW = 513,                     /* NEW  */
+    NEXT = 514,                    /* NEXT  */
+    NO = 515,                      /* NO  */
+    NONE = 516,                    /* NONE  */
+    NOT = 517,                     /* NOT  */
+    NOTHING = 518,                 /* NOTHING  */
+    NOTIFY = 519,                  /* NOTIFY  */
+    NOTNULL = 520,                 /* NOTNULL  */
+    NOWAIT = 521,                  /* NOWAIT  */
+    NULL_P = 522,                  /* NULL_P  */
+    NULLIF = 523,                  /* NULLIF  */
+    NULLS_P = 524,                 /* NULLS_P  */
+    NUMERIC = 525,                 /* NUMERIC  */
+    OBJECT_P = 526,                /* OBJECT_P  */
+    OF = 527,                      /* OF  */
+    OFF = 528,                     /* OFF  */
+    OFFSET = 529,                  /* OFFSET  */
+    OIDS = 530,                    /* OIDS  */
+    OLD = 531,                     /* OLD  */
+    ON = 532,                      /* ON  */
+    ONLY = 533,                    /* ONLY  */
+    OPERATOR = 534,                /* OPERATOR  */
+    OPTION = 535,                  /* OPTION  */
+    OPTIONAL_P = 536,              /* OPTIONAL_P  */
+    OPTIONS = 537,                 /* OPTIONS  */
+    OR = 538,                      /* OR  */
+    ORDER = 539,                   /* ORDER  */
+    ORDINALITY = 540,              /* ORDINALITY  */
+    OUT_P = 541,                   /* OUT_P  */
+    OUTER_P = 542,                 /* OUTER_P  */
+    OVER = 543,                    /* OVER  */
+    OVERLAPS = 544,                /* OVERLAPS  */
+    OVERLAY = 545,                 /* OVERLAY  */
+    OVERRIDING = 546,              /* OVERRIDING  */
+    OWNED = 547,                   /* OWNED  */
+    OWNER = 548,                   /* OWNER  */
+    PARALLEL = 549,                /* PARALLEL  */
+    PARSER = 550,                  /* PARSER  */
+    PARTIAL = 551,                 /* PARTIAL  */
+    PARTITION = 552,               /* PARTITION  */
+    PASSING = 553,                 /* PASSING  */
+    PASSWORD = 554,                /* PASSWORD  */
+    PLACING = 555,                 /* PLACING  */
+    PLANS = 556,                   /* PLANS  */
+    POLICY = 557,                  /* POLICY  */
+    POSITION = 558,                /* POSITION  */
+    PRECEDING = 559,               /* PRECEDING  */
+    PRECISION = 560,               /* PRECISION  */
+    PRESERVE = 561,                /* PRESERVE  */
+    PREPARE = 562,                 /* PREPARE  */
+    PREPARED = 563,                /* PREPARED  */
+    PRIMARY = 564,                 /* PRIMARY  */
+    PRIOR = 565,                   /* PRIOR  */
+    PRIVILEGES = 566,              /* PRIVILEGES  */
+    PROCEDURAL = 567,              /* PROCEDURAL  */
+    PROCEDURE = 568,               /* PROCEDURE  */
+    PROPERTY = 569,                /* PROPERTY  */
+    PROGRAM = 570,                 /* PROGRAM  */
+    PUBLICATION = 571,             /* PUBLICATION  */
+    QUOTE = 572,                   /* QUOTE  */
+    RANGE = 573,                   /* RANGE  */
+    READ = 574,                    /* READ  */
+    REAL = 575,                    /* REAL  */
+    REASSIGN = 576,                /* REASSIGN  */
+    RECHECK = 577,                 /* RECHECK  */
+    RECURSIVE = 578,               /* RECURSIVE  */
+    REF = 579,                     /* REF  */
+    REFERENCES = 580,              /* REFERENCES  */
+    REFERENCING = 581,             /* REFERENCING  */
+    REFRESH = 582,                 /* REFRESH  */
+    REINDEX = 583,                 /* REINDEX  */
+    RELATIVE_P = 584,              /* RELATIVE_P  */
+    RELEASE = 585,                 /* RELEASE  */
+    REMOVE = 586,                  /* REMOVE  */
+    RENAME = 587,                  /* RENAME  */
+    REPEATABLE = 588,              /* REPEATABLE  */
+    REPLACE = 589,                 /* REPLACE  */
+    REPLICA = 590,                 /* REPLICA  */
+    RESET = 591,                   /* RESET  */
+    RESTART = 592,                 /* RESTART  */
+    RESTRICT = 593,                /* RESTRICT  */
+    RETURN = 594,                  /* RETURN  */
+    RETURNING = 595,               /* RETURNING  */
+    RETURNS = 596,                 /* RETURNS  */
+    REVOKE = 597,                  /* REVOKE  */
+    RIGHT = 598,                   /* RIGHT  */
+    ROLE = 599,                    /* ROLE  */
+    ROLLBACK = 600,                /* ROLLBACK  */
+    ROLLUP = 601,                  /* ROLLUP  */
+    ROW = 602,                     /* ROW  */
+    ROWS = 603,                    /* ROWS  */
+    RULE = 604,                    /* RULE  */
+    SAVEPOINT = 605,               /* SAVEPOINT  */
+    SCHEMA = 606,                  /* SCHEMA  */
+    SCHEMAS = 607,                 /* SCHEMAS  */
+    SCROLL = 608,                  /* SCROLL  */
+    SEARCH = 609,                  /* SEARCH  */
+    SECOND_P = 610,                /* SECOND_P  */
+    SECURITY = 611,                /* SECURITY  */
+    SELECT = 612,                  /* SELECT  */
+    SEQUENCE = 613,                /* SEQUENCE  */
+    SEQUENCES = 614,               /* SEQUENCES  */
+    SERIALIZABLE = 615,            /* SERIALIZABLE  */
+    SERVER = 616,                  /* SERVER  */
+    SESSION = 617,                 /* SESSION  */
+    SESSION_USER = 618,            /* SESSION_USER  */
+    SET = 619,                     /* SET  */
+    SETS = 620,                    /* SETS  */
+    SETOF = 621,                   /* SETOF  */
+    SHARE = 622,                   /* SHARE  */
+    SHORTESTPATH = 623,            /* SHORTESTPATH  */
+    SHOW = 624,                    /* SHOW  */
+    SIMILAR = 625,                 /* SIMILAR  */
+    SIMPLE = 626,                  /* SIMPLE  */
+    SINGLE = 627,                  /* SINGLE  */
+    SIZE_P = 628,                  /* SIZE_P  */
+    SKIP = 629,                    /* SKIP  */
+    SMALLINT = 630,                /* SMALLINT  */
+    SNAPSHOT = 631,                /* SNAPSHOT  */
+    SOME = 632,                    /* SOME  */
+    SQL_P = 633,                   /* SQL_P  */
+    STABLE = 634,                  /* STABLE  */
+    STANDALONE_P = 635,            /* STANDALONE_P  */
+    START = 636,                   /* START  */
+    STARTS = 637,                  /* STARTS  */
+    STATEMENT = 638,               /* STATEMENT  */
+    STATISTICS = 639,              /* STATISTICS  */
+    STDIN = 640,                   /* STDIN  */
+    STDOUT = 641,                  /* STDOUT  */
+    STORAGE = 642,                 /* STORAGE  */
+    STRICT_P = 643,                /* STRICT_P  */
+    STRIP_P = 644,                 /* STRIP_P  */
+    SUBSCRIPTION = 645,            /* SUBSCRIPTION  */
+    SUBSTRING = 646,               /* SUBSTRING  */
+    SYMMETRIC = 647,               /* SYMMETRIC  */
+    SYSID = 648,                   /* SYSID  */
+    SYSTEM_P = 649,                /* SYSTEM_P  */
+    TABLE = 650,                   /* TABLE  */
+    TABLES = 651,                  /* TABLES  */
+    TABLESAMPLE = 652,             /* TABLESAMPLE  */
+    TABLESPACE = 653,              /* TABLESPACE  */
+    TEMP = 654,                    /* TEMP  */
+    TEMPLATE = 655,                /* TEMPLATE  */
+    TEMPORARY = 656,               /* TEMPORARY  */
+    TEXT_P = 657,                  /* TEXT_P  */
+    THEN = 658,                    /* THEN  */
+    TIME = 659,                    /* TIME  */
+    TIMESTAMP = 660,               /* TIMESTAMP  */
+    TO = 661,                      /* TO  */
+    TRAILING = 662,                /* TRAILING  */
+    TRANSACTION = 663,             /* TRANSACTION  */
+    TRANSFORM = 664,               /* TRANSFORM  */
+    TREAT = 665,                   /* TREAT  */
+    TRIGGER = 666,                 /* TRIGGER  */
+    TRIM = 667,                    /* TRIM  */
+    TRUE_P = 668,                  /* TRUE_P  */
+    TRUNCATE = 669,                /* TRUNCATE  */
+    TRUSTED = 670,                 /* TRUSTED  */
+    TYPE_P = 671,                  /* TYPE_P  */
+    TYPES_P = 672,                 /* TYPES_P  */
+    UNBOUNDED = 673,               /* UNBOUNDED  */
+    UNCOMMITTED = 674,             /* UNCOMMITTED  */
+    UNENCRYPTED = 675,             /* UNENCRYPTED  */
+    UNION = 676,                   /* UNION  */
+    UNIQUE = 677,                  /* UNIQUE  */
+    UNKNOWN = 678,                 /* UNKNOWN  */
+    UNLISTEN = 679,                /* UNLISTEN  */
+    UNLOGGED = 680,                /* UNLOGGED  */
+    UNTIL = 681,                   /* UNTIL  */
+    UPDATE = 682,                  /* UPDATE  */
+    USER = 683,                    /* USER  */
+    USING = 684,                   /* USING  */
+    VACUUM = 685,                  /* VACUUM  */
+    VALID = 686,                   /* VALID  */
+    VALIDATE = 687,                /* VALIDATE  */
+    VALIDATOR = 688,               /* VALIDATOR  */
+    VALUE_P = 689,                 /* VALUE_P  */
+    VALUES = 690,                  /* VALUES  */
+    VARCHAR = 691,                 /* VARCHAR  */
+    VARIADIC = 692,                /* VARIADIC  */
+    VARYING = 693,                 /* VARYING  */
+    VERBOSE = 694,                 /* VERBOSE  */
+    VERSION_P = 695,               /* VERSION_P  */
+    VIEW = 696,                    /* VIEW  */
+    VIEWS = 697,                   /* VIEWS  */
+    VLABEL = 698,                  /* VLABEL  */
+    VOLATILE = 699,                /* VOLATILE  */
+    WHEN = 700,                    /* WHEN  */
+    WHERE = 701,                   /* WHERE  */
+    WHITESPACE_P = 702,            /* WHITESPACE_P  */
+    WINDOW = 703,                  /* WINDOW  */
+    WITH = 704,                    /* WITH  */
+    WITHIN = 705,                  /* WITHIN  */
+    WITHOUT = 706,                 /* WITHOUT  */
+    WORK = 707,                    /* WORK  */
+    WRAPPER = 708,                 /* WRAPPER  */
+    WRITE = 709,                   /* WRITE  */
+    XML_P = 710,                   /* XML_P  */
+    XMLATTRIBUTES = 711,           /* XMLATTRIBUTES  */
+    XMLCONCAT = 712,               /* XMLCONCAT  */
+    XMLELEMENT = 713,              /* XMLELEMENT  */
+    XMLEXISTS = 714,               /* XMLEXISTS  */
+    XMLFOREST = 715,               /* XMLFOREST  */
+    XMLNAMESPACES = 716,           /* XMLNAMESPACES  */
+    XMLPARSE = 717,                /* XMLPARSE  */
+    XMLPI = 718,                   /* XMLPI  */
+    XMLROOT = 719,                 /* XMLROOT  */
+    XMLSERIALIZE = 720,            /* XMLSERIALIZE  */
+    XMLTABLE = 721,                /* XMLTABLE  */
+    YEAR_P = 722,                  /* YEAR_P  */
+    YES_P = 723,                   /* YES_P  */
+    ZONE = 724,                    /* ZONE  */
+    NOT_LA = 725,                  /* NOT_LA  */
+    NULLS_LA = 726,                /* NULLS_LA  */
+    WITH_LA = 727,                 /* WITH_LA  */
+    POSTFIXOP = 728,               /* POSTFIXOP  */
+    UMINUS = 729,                  /* UMINUS  */
+    EQUALS_TILDE = 730             /* EQUALS_TILDE  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
+#endif
+
+/* Value type.  */
+#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
+union YYSTYPE
+{
+#line 214 "gram.y"
+
+	core_YYSTYPE		core_yystype;
+	/* these fields must match core_YYSTYPE: */
+	int					ival;
+	char				*str;
+	const char			*keyword;
+
+	char				chr;
+	bool				boolean;
+	JoinType			jtype;
+	DropBehavior		dbehavior;
+	OnCommitAction		oncommit;
+	List				*list;
+	Node				*node;
+	Value				*value;
+	ObjectType			objtype;
+	TypeName			*typnam;
+	FunctionParameter   *fun_param;
+	FunctionParameterMode fun_param_mode;
+	ObjectWithArgs		*objwithargs;
+	DefElem				*defelt;
+	SortBy				*sortby;
+	WindowDef			*windef;
+	JoinExpr			*jexpr;
+	IndexElem			*ielem;
+	Alias				*alias;
+	RangeVar			*range;
+	IntoClause			*into;
+	WithClause			*with;
+	InferClause			*infer;
+	OnConflictClause	*onconflict;
+	A_Indices			*aind;
+	ResTarget			*target;
+	struct PrivTarget	*privtarget;
+	AccessPriv			*accesspriv;
+	struct ImportQual	*importqual;
+	InsertStmt			*istmt;
+	VariableSetStmt		*vsetstmt;
+	PartitionElem		*partelem;
+	PartitionSpec		*partspec;
+	PartitionBoundSpec	*partboundspec;
+	RoleSpec			*rolespec;
+
+#line 583 "gram.h"
+
+};
+typedef union YYSTYPE YYSTYPE;
+# define YYSTYPE_IS_TRIVIAL 1
+# define YYSTYPE_IS_DECLARED 1
+#endif
+
+/* Location type.  */
+#if ! defined YYLTYPE && ! defined YYLTYPE_IS_DECLARED
+typedef struct YYLTYPE YYLTYPE;
+struct YYLTYPE
+{
+  int first_line;
+  int first_column;
+  int last_line;
+  int last_column;
+};
+# define YYLTYPE_IS_DECLARED 1
+# define YYLTYPE_IS_TRIVIAL 1
+#endif
+
+
+
+
+int base_yyparse (core_yyscan_t yyscanner);
+
+
+#endif /* !YY_BASE_YY_GRAM_H_INCLUDED  */
@@ -0,0 +1,3 @@
+/* src/include/port/hpux.h */
+
+/* nothing needed */
@@ -0,0 +1,29 @@
+/*
+ * topocache.h
+ *	  Shared-memory cache of the topology of edge labels
+ *
+ * Copyright (c) 2017 by Bitnine Global, Inc.
+ *
+ * IDENTIFICATION
+ *	  src/include/utils/topocache.h
+ */
+
+#ifndef TOPOCACHE_H
+#define TOPOCACHE_H
+
+#include "utils/graph.h"
+#include "utils/snapshot.h"
+
+/* called for each edge of a cached edge label */
+typedef void (*TopologyCacheEdgeCallback) (Graphid id, Graphid start,
+										   Graphid end, void *arg);
+
+extern Size TopologyCacheShmemSize(void);
+extern void TopologyCacheShmemInit(void);
+
+extern int64 TopologyCacheLoad(Oid relid);
+extern void TopologyCacheInvalidate(Oid relid);
+extern bool TopologyCacheScanEdges(Oid relid, Snapshot snapshot,
+					   TopologyCacheEdgeCallback callback, void *arg);
+
+#endif							/* TOPOCACHE_H */